@@ -123,3 +123,33 @@ workspace "tm-virtual-machine"
         links {
             "tomboy", "tm", "SDL2", "m"
         }
+
+    -- "tests" - Regression Tests for TM and TOMBOY
+    project "tests"
+
+        -- Console Application
+        kind "ConsoleApp"
+
+        -- Project Location
+        location "./generated/tests"
+        targetdir "./build/bin/tests/%{cfg.buildcfg}"
+        objdir "./build/obj/tests/%{cfg.buildcfg}"
+
+        -- Project Files
+        includedirs {
+            "./projects/tm/include",
+            "./projects/tomboy/include",
+            "./projects/tests/include"
+        }
+        files {
+            "./projects/tests/src/**.c"
+        }
+
+        -- Library Dependencies
+        libdirs {
+            "./build/bin/tm/%{cfg.buildcfg}",
+            "./build/bin/tomboy/%{cfg.buildcfg}"
+        }
+        links {
+            "tomboy", "tm", "m"
+        }
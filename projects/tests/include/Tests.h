@@ -0,0 +1,114 @@
+/**
+ * @file  Tests.h
+ * @brief Contains the test cases run by the `tests` program, and helpers for writing them.
+ */
+
+#pragma once
+
+// Include Files ///////////////////////////////////////////////////////////////////////////////////
+
+#include <TM/CPU.h>
+
+// Helper Macros ///////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Fails the current test case, reporting the given message, if the given clause does not
+ *          hold.
+ */
+#define TEST_expect(p_Clause, ...) \
+    if (!(p_Clause)) \
+    { \
+        TM_error(__VA_ARGS__); \
+        return false; \
+    }
+
+// Test Case Prototypes ////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Checks the total number of cycles the CPU passes to its cycle function for one
+ *          instruction of each addressing mode, with cycle batching both enabled and disabled.
+ *
+ * @return  `true` if the test case passed; `false` otherwise.
+ */
+bool TEST_CPUCycleTiming (void);
+
+/**
+ * @brief   Runs random programs on two CPUs, one interpreting every instruction and the other
+ *          running hot blocks as JIT-compiled code, in step, and checks that their registers, flags,
+ *          memory and cycle counts agree after every compiled block, and after every slice of
+ *          cycles. Then runs a program which rewrites its own code in XRAM, and has the bus rewrite
+ *          it too, and checks that neither CPU runs a stale instruction.
+ *
+ * @return  `true` if the test case passed, or JIT compilation is not supported; `false` otherwise.
+ */
+bool TEST_CPUJITDifferential (void);
+
+/**
+ * @brief   Runs a program exercising the PPU, timer and their interrupts on two TOMBOY engines, one
+ *          bringing its components up to date by scheduled events and the other on every tick, and
+ *          checks that `LY`, `STAT`, `DIV`, `TIMA`, `IF` and the CPU's state agree after every frame.
+ *
+ * @return  `true` if the test case passed; `false` otherwise.
+ */
+bool TEST_EngineEventLockstep (void);
+
+/**
+ * @brief   Draws a blank background with a single solid tile on it, in each render mode, and checks
+ *          that frames which draw the same pixels again mark no scanlines dirty, and that changing
+ *          one row of the tile's data marks only the scanline that row shows on.
+ *
+ * @return  `true` if the test case passed; `false` otherwise.
+ */
+bool TEST_PPUDirtyScanlines (void);
+
+/**
+ * @brief   Hands frames off from a TOMBOY engine's PPU, and checks that acquiring a frame picks up
+ *          only the newest one handed off since the last acquire, that acquiring again before
+ *          another is handed off gives the same buffer and reports it as stale, that frames which
+ *          change nothing are not handed off, and that the buffer last acquired is never drawn
+ *          into.
+ *
+ * @return  `true` if the test case passed; `false` otherwise.
+ */
+bool TEST_PPUFrameHandoff (void);
+
+/**
+ * @brief   Runs a program taking the PPU's `STAT` and vertical blank interrupts on two TOMBOY
+ *          engines, one drawing every frame and the other only every third, in step, and checks
+ *          that `LY`, `STAT`, `IF` and the frame rendered callbacks agree after every instruction,
+ *          that each drawn frame matches, and that each skipped frame leaves the last drawn one in
+ *          the screen buffer.
+ *
+ * @return  `true` if the test case passed; `false` otherwise.
+ */
+bool TEST_PPUFrameSkip (void);
+
+/**
+ * @brief   Runs each of the PPU's tile decoding and color lookup kernels supported by the host on
+ *          random tiles, color indices and palettes, and checks that their output matches that of
+ *          the scalar kernels byte for byte.
+ *
+ * @return  `true` if the test case passed; `false` otherwise.
+ */
+bool TEST_PPUKernels (void);
+
+/**
+ * @brief   Draws a background in a known CRAM palette in each of the PPU's pixel formats, and checks
+ *          that every scanline holds the expected pixel values at the format's width, that the
+ *          screen pitch matches the format, and that the indexed format's palette gives the colors
+ *          its indices stand for.
+ *
+ * @return  `true` if the test case passed; `false` otherwise.
+ */
+bool TEST_PPUPixelFormats (void);
+
+/**
+ * @brief   Runs a program which scrolls the background, moves the window and switches the object
+ *          size between frames, over a scene of random tiles and objects, on two TOMBOY engines, one
+ *          drawing in the accurate render mode and the other in the fast one, in step, and checks
+ *          that `LY`, `STAT` and `IF` agree after every instruction, and that every frame drawn
+ *          matches byte for byte.
+ *
+ * @return  `true` if the test case passed; `false` otherwise.
+ */
+bool TEST_PPURenderModeLockstep (void);
@@ -0,0 +1,639 @@
+/**
+ * @file  CPUJIT.c
+ */
+
+#include <Tests.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_JIT_ROM_SIZE           0x10000     ///< @brief The size of the differential test bus's ROM.
+#define TEST_JIT_DRAM_SIZE          0x1000      ///< @brief The size of the differential test bus's DRAM.
+#define TEST_JIT_XRAM_SIZE          0x100       ///< @brief The size of the differential test bus's XRAM.
+#define TEST_JIT_STACK_SIZE         0x10000     ///< @brief The size of each of the differential test bus's stacks.
+#define TEST_JIT_INTERRUPT_PERIOD   1500        ///< @brief The number of cycles between the interrupts the bus requests.
+#define TEST_JIT_SEEDS              12          ///< @brief The number of random programs to run.
+#define TEST_JIT_CYCLES             400000      ///< @brief The number of cycles to run each program for.
+#define TEST_JIT_STEP_CYCLES        200         ///< @brief The most cycles the CPUs run for in a step, when stepping a block at a time.
+#define TEST_JIT_LOOPS              24          ///< @brief The number of loops in each random program.
+#define TEST_JIT_SUBROUTINES        4           ///< @brief The number of subroutines in each random program.
+#define TEST_JIT_SMC_ITERATIONS     100         ///< @brief The number of times each loop of the self-modifying program runs.
+#define TEST_JIT_SMC_CYCLES         40000       ///< @brief The number of cycles to run each half of the self-modifying program for.
+#define TEST_JIT_SMC_PATCH          0x5A        ///< @brief The byte the bus patches into the self-modifying program's subroutine.
+
+// JIT Bus Structure ///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   A bus made of plain memory, which requests an interrupt every so many cycles, and can say
+ *          exactly how many cycles remain until the next request.
+ */
+typedef struct TEST_JITBus
+{
+    uint8_t     m_ROM[TEST_JIT_ROM_SIZE];       ///< @brief The bus's ROM, holding the random program.
+    uint8_t     m_DRAM[TEST_JIT_DRAM_SIZE];     ///< @brief The start of the bus's DRAM.
+    uint8_t     m_XRAM[TEST_JIT_XRAM_SIZE];     ///< @brief The start of the bus's XRAM.
+    uint8_t     m_DataStack[TEST_JIT_STACK_SIZE];   ///< @brief The bus's data stack.
+    uint8_t     m_CallStack[TEST_JIT_STACK_SIZE];   ///< @brief The bus's call stack.
+    TM_CPU*     m_CPU;                          ///< @brief The CPU instance on the bus.
+    uint64_t    m_Cycles;                       ///< @brief The total number of cycles passed to the cycle function.
+    uint64_t    m_Calls;                        ///< @brief The number of times the cycle function was called.
+    bool        m_BreakOnEvent;                 ///< @brief Does the next event function break the CPU, so that it returns once its compiled block does?
+} TEST_JITBus;
+
+// Program Builder Structure ///////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Writes a random program into a JIT bus's ROM.
+ */
+typedef struct TEST_ProgramBuilder
+{
+    uint8_t*    m_ROM;          ///< @brief The ROM being written.
+    uint32_t    m_Address;      ///< @brief The address the next instruction is written to.
+    uint32_t    m_Seed;         ///< @brief The state of the random number generator.
+    uint32_t    m_Subroutines[TEST_JIT_SUBROUTINES];    ///< @brief The addresses of the program's subroutines.
+} TEST_ProgramBuilder;
+
+// Private Functions - Bus /////////////////////////////////////////////////////////////////////////
+
+static uint8_t* TEST_JITBusByte (TEST_JITBus* p_Bus, uint32_t p_Address)
+{
+    if (p_Address < TEST_JIT_ROM_SIZE)
+    {
+        return &p_Bus->m_ROM[p_Address];
+    }
+    else if (p_Address >= TM_DRAM_BEGIN && p_Address - TM_DRAM_BEGIN < TEST_JIT_DRAM_SIZE)
+    {
+        return &p_Bus->m_DRAM[p_Address - TM_DRAM_BEGIN];
+    }
+    else if (p_Address >= TM_XRAM_BEGIN && p_Address - TM_XRAM_BEGIN < TEST_JIT_XRAM_SIZE)
+    {
+        return &p_Bus->m_XRAM[p_Address - TM_XRAM_BEGIN];
+    }
+    else if (p_Address >= TM_DSTACK_BEGIN && p_Address <= TM_DSTACK_END)
+    {
+        return &p_Bus->m_DataStack[p_Address - TM_DSTACK_BEGIN];
+    }
+    else if (p_Address >= TM_CSTACK_BEGIN && p_Address <= TM_CSTACK_END)
+    {
+        return &p_Bus->m_CallStack[p_Address - TM_CSTACK_BEGIN];
+    }
+
+    return NULL;
+}
+
+static uint8_t TEST_JITBusRead (void* p_Context, uint32_t p_Address)
+{
+    uint8_t* l_Byte = TEST_JITBusByte((TEST_JITBus*) p_Context, p_Address);
+    return (l_Byte != NULL) ? *l_Byte : 0xFF;
+}
+
+static void TEST_JITBusWrite (void* p_Context, uint32_t p_Address, uint8_t p_Data)
+{
+    uint8_t* l_Byte = TEST_JITBusByte((TEST_JITBus*) p_Context, p_Address);
+    if (l_Byte != NULL)
+    {
+        *l_Byte = p_Data;
+    }
+}
+
+static bool TEST_JITCycle (void* p_Context, uint32_t p_Cycles)
+{
+    // Request interrupt 0 each time the total number of cycles passes a multiple of the period.
+    TEST_JITBus* l_Bus = (TEST_JITBus*) p_Context;
+    uint64_t l_Before = l_Bus->m_Cycles / TEST_JIT_INTERRUPT_PERIOD;
+    l_Bus->m_Cycles += p_Cycles;
+    l_Bus->m_Calls++;
+    if (l_Bus->m_Cycles / TEST_JIT_INTERRUPT_PERIOD != l_Before)
+    {
+        TM_RequestInterrupt(l_Bus->m_CPU, 0);
+    }
+
+    return true;
+}
+
+static uint32_t TEST_JITNextEvent (void* p_Context)
+{
+    // The CPU asks this as it enters compiled code, to open its quiet window. A break requested
+    // here is seen as soon as the block it is entering returns, or its window runs out.
+    TEST_JITBus* l_Bus = (TEST_JITBus*) p_Context;
+    if (l_Bus->m_BreakOnEvent == true)
+    {
+        TM_BreakCPU(l_Bus->m_CPU);
+    }
+
+    return TEST_JIT_INTERRUPT_PERIOD - (l_Bus->m_Cycles % TEST_JIT_INTERRUPT_PERIOD);
+}
+
+// Private Functions - Program Builder /////////////////////////////////////////////////////////////
+
+static uint32_t TEST_Random (TEST_ProgramBuilder* p_Builder, uint32_t p_Range)
+{
+    p_Builder->m_Seed = (p_Builder->m_Seed * 1103515245u) + 12345u;
+    return (p_Builder->m_Seed >> 8) % p_Range;
+}
+
+static void TEST_Emit (TEST_ProgramBuilder* p_Builder, uint8_t p_Opcode, uint8_t p_IP1, uint8_t p_IP2)
+{
+    p_Builder->m_ROM[p_Builder->m_Address++] = (uint8_t) ((p_IP1 << 4) | p_IP2);
+    p_Builder->m_ROM[p_Builder->m_Address++] = p_Opcode;
+}
+
+static void TEST_EmitOperand (TEST_ProgramBuilder* p_Builder, uint32_t p_Value, uint8_t p_Size)
+{
+    for (uint8_t i = 0; i < p_Size; ++i)
+    {
+        p_Builder->m_ROM[p_Builder->m_Address++] = (p_Value >> (8 * i)) & 0xFF;
+    }
+}
+
+static uint8_t TEST_RegisterSize (uint8_t p_Register)
+{
+    return ((p_Register & 0b11) >= 2) ? 1 : ((p_Register & 0b11) == 0b01) ? 2 : 4;
+}
+
+static uint32_t TEST_RandomValue (TEST_ProgramBuilder* p_Builder)
+{
+    // Favour values near the edges of each size, where the flags are most interesting.
+    static const uint32_t s_Values[] = {
+        0x00000000, 0x00000001, 0x0000000F, 0x00000010, 0x0000007F, 0x00000080, 0x000000FF,
+        0x00000100, 0x00007FFF, 0x0000FFFF, 0x00010000, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF
+    };
+
+    return (TEST_Random(p_Builder, 3) == 0) ?
+        (TEST_Random(p_Builder, 0x10000) | (TEST_Random(p_Builder, 0x10000) << 16)) :
+        s_Values[TEST_Random(p_Builder, sizeof(s_Values) / sizeof(s_Values[0]))];
+}
+
+static void TEST_EmitStraightLine (TEST_ProgramBuilder* p_Builder, bool p_Calls)
+{
+    // Registers `A`, `B` and `C` and their parts may be written; register `E` holds loop counters,
+    // so it is only read.
+    uint8_t l_Destination = TEST_Random(p_Builder, 12);
+    uint8_t l_Source = TEST_Random(p_Builder, 16);
+    uint8_t l_Accumulator = TEST_Random(p_Builder, 4);
+    uint8_t l_Whole = TEST_Random(p_Builder, 3) * 4;
+    uint32_t l_DataAddress = TM_DRAM_BEGIN + (TEST_Random(p_Builder, TEST_JIT_DRAM_SIZE / 4) * 4);
+
+    // Arithmetic and logic instructions, with immediate and register operands: `ADD`, `ADC`,
+    // `SUB`, `SBC`, `AND`, `OR`, `XOR` and `CMP`.
+    static const uint8_t s_Arithmetic[] = { 0x34, 0x37, 0x3A, 0x3D, 0x40, 0x43, 0x46, 0x50 };
+
+    switch (TEST_Random(p_Builder, p_Calls ? 20 : 19))
+    {
+        case 0: case 1:
+            TEST_Emit(p_Builder, 0x10, l_Destination, 0);
+            TEST_EmitOperand(p_Builder, TEST_RandomValue(p_Builder), TEST_RegisterSize(l_Destination));
+            break;
+
+        case 2:
+            TEST_Emit(p_Builder, 0x1D, l_Destination, l_Source);
+            break;
+
+        case 3: case 4:
+            TEST_Emit(p_Builder, (TEST_Random(p_Builder, 2) == 0) ? 0x30 : 0x32, l_Destination, 0);
+            break;
+
+        case 5: case 6: case 7: case 8:
+        {
+            uint8_t l_Opcode = s_Arithmetic[TEST_Random(p_Builder, 8)];
+            TEST_Emit(p_Builder, l_Opcode, l_Accumulator, 0);
+            TEST_EmitOperand(p_Builder, TEST_RandomValue(p_Builder), TEST_RegisterSize(l_Accumulator));
+        } break;
+
+        case 9: case 10: case 11:
+            TEST_Emit(p_Builder, s_Arithmetic[TEST_Random(p_Builder, 8)] + 1, l_Accumulator, l_Source);
+            break;
+
+        // `ST [ADDR32], X` and `LD X, [ADDR32]`
+        case 12:
+            TEST_Emit(p_Builder, 0x17, 0, l_Source);
+            TEST_EmitOperand(p_Builder, l_DataAddress, 4);
+            break;
+
+        case 13:
+            TEST_Emit(p_Builder, 0x11, l_Destination, 0);
+            TEST_EmitOperand(p_Builder, l_DataAddress, 4);
+            break;
+
+        // `PUSH X`, `POP Y`
+        case 14:
+            TEST_Emit(p_Builder, 0x1E, TEST_Random(p_Builder, 4) * 4, 0);
+            TEST_Emit(p_Builder, 0x1F, l_Whole, 0);
+            break;
+
+        // `SCF`, `CCF`, `NOT X`, the shifts and rotations, and `SWAP X`
+        case 15:
+            TEST_Emit(p_Builder, (TEST_Random(p_Builder, 2) == 0) ? 0x08 : 0x09, 0, 0);
+            break;
+
+        case 16:
+            TEST_Emit(p_Builder, 0x49, l_Destination, 0);
+            break;
+
+        case 17:
+            TEST_Emit(p_Builder, 0x60 + (TEST_Random(p_Builder, 7) * 2), l_Destination, 0);
+            break;
+
+        case 18:
+            TEST_Emit(p_Builder, 0x76, l_Destination, 0);
+            break;
+
+        // `CALL NC, ADDR32`
+        case 19:
+            TEST_Emit(p_Builder, 0x23, TM_COND_NC, 0);
+            TEST_EmitOperand(p_Builder,
+                p_Builder->m_Subroutines[TEST_Random(p_Builder, TEST_JIT_SUBROUTINES)], 4);
+            break;
+    }
+}
+
+static void TEST_EmitBody (TEST_ProgramBuilder* p_Builder, uint32_t p_Length, bool p_Calls)
+{
+    for (uint32_t i = 0; i < p_Length; ++i)
+    {
+        uint32_t l_Choice = TEST_Random(p_Builder, 40);
+
+        // A forward conditional jump, `JPB` or `JMP`, over a few instructions.
+        if (l_Choice < 4)
+        {
+            uint8_t l_Condition = TEST_Random(p_Builder, 5);
+            bool l_Relative = (l_Choice < 2);
+            uint32_t l_Jump = p_Builder->m_Address;
+            TEST_Emit(p_Builder, l_Relative ? 0x22 : 0x20, l_Condition, 0);
+            TEST_EmitOperand(p_Builder, 0, l_Relative ? 2 : 4);
+            uint32_t l_After = p_Builder->m_Address;
+
+            for (uint32_t j = TEST_Random(p_Builder, 3) + 1; j > 0; --j)
+            {
+                TEST_EmitStraightLine(p_Builder, p_Calls);
+            }
+
+            uint32_t l_Target = p_Builder->m_Address;
+            uint32_t l_Operand = l_Relative ? (l_Target - l_After) : l_Target;
+            for (uint8_t j = 0; j < (l_Relative ? 2 : 4); ++j)
+            {
+                p_Builder->m_ROM[l_Jump + 2 + j] = (l_Operand >> (8 * j)) & 0xFF;
+            }
+        }
+
+        // Rarely, `EI`, `DI` or `HALT`.
+        else if (l_Choice == 4)
+        {
+            static const uint8_t s_Control[] = { 0x06, 0x06, 0x05, 0x02 };
+            TEST_Emit(p_Builder, s_Control[TEST_Random(p_Builder, 4)], 0, 0);
+        }
+
+        else
+        {
+            TEST_EmitStraightLine(p_Builder, p_Calls);
+        }
+    }
+}
+
+static void TEST_BuildProgram (TEST_ProgramBuilder* p_Builder)
+{
+    // The interrupt handler, which leaves the loop counter in `E` alone.
+    p_Builder->m_Address = TM_INT_BEGIN;
+    TEST_EmitBody(p_Builder, 6, false);
+    TEST_Emit(p_Builder, 0x26, 0, 0);
+
+    // The subroutines go after the main program, in the upper half of the ROM.
+    p_Builder->m_Address = 0x9000;
+    for (uint32_t i = 0; i < TEST_JIT_SUBROUTINES; ++i)
+    {
+        p_Builder->m_Subroutines[i] = p_Builder->m_Address;
+        TEST_EmitBody(p_Builder, TEST_Random(p_Builder, 8) + 1, false);
+        TEST_Emit(p_Builder, 0x25, TM_COND_NC, 0);
+    }
+
+    // The main program: a series of counted loops, after which it starts over.
+    p_Builder->m_Address = TM_CODE_BEGIN;
+    TEST_Emit(p_Builder, 0x06, 0, 0);
+    for (uint32_t i = 0; i < TEST_JIT_LOOPS; ++i)
+    {
+        // `LD EL, n`, body, `DEC EL`, `JPB ZC, top`
+        TEST_Emit(p_Builder, 0x10, TM_REG_EL, 0);
+        TEST_EmitOperand(p_Builder, TEST_Random(p_Builder, 40) + 2, 1);
+
+        uint32_t l_Top = p_Builder->m_Address;
+        TEST_EmitBody(p_Builder, TEST_Random(p_Builder, 24) + 1, true);
+        TEST_Emit(p_Builder, 0x32, TM_REG_EL, 0);
+        TEST_Emit(p_Builder, 0x22, TM_COND_ZC, 0);
+        TEST_EmitOperand(p_Builder, l_Top - (p_Builder->m_Address + 2), 2);
+    }
+
+    // `JMP NC, start`
+    TEST_Emit(p_Builder, 0x20, TM_COND_NC, 0);
+    TEST_EmitOperand(p_Builder, TM_CODE_BEGIN, 4);
+}
+
+static void TEST_EmitSelfModifyingLoop (TEST_ProgramBuilder* p_Builder)
+{
+    // `LD EL, n`, then, `n` times: `INC BL`, `ST [sub + 2], BL`, `CALL NC, sub`, `ADD A, C`. The
+    // store rewrites the immediate of the subroutine's `LD CL, imm8`, which is in XRAM.
+    TEST_Emit(p_Builder, 0x10, TM_REG_EL, 0);
+    TEST_EmitOperand(p_Builder, TEST_JIT_SMC_ITERATIONS, 1);
+
+    uint32_t l_Top = p_Builder->m_Address;
+    TEST_Emit(p_Builder, 0x30, TM_REG_BL, 0);
+    TEST_Emit(p_Builder, 0x17, 0, TM_REG_BL);
+    TEST_EmitOperand(p_Builder, TM_XRAM_BEGIN + 2, 4);
+    TEST_Emit(p_Builder, 0x23, TM_COND_NC, 0);
+    TEST_EmitOperand(p_Builder, TM_XRAM_BEGIN, 4);
+    TEST_Emit(p_Builder, 0x35, TM_REG_A, TM_REG_C);
+    TEST_Emit(p_Builder, 0x32, TM_REG_EL, 0);
+    TEST_Emit(p_Builder, 0x22, TM_COND_ZC, 0);
+    TEST_EmitOperand(p_Builder, l_Top - (p_Builder->m_Address + 2), 2);
+}
+
+static void TEST_BuildSelfModifyingProgram (TEST_ProgramBuilder* p_Builder, uint8_t* p_XRAM)
+{
+    // The subroutine in XRAM: `LD CL, imm8`, `JPB NC, +0`, `LD CH, imm8`, `RET NC`. The CPU rewrites
+    // the first immediate on every call; the bus rewrites the second one between the program's two
+    // loops. The jump ends the first block, so that the CPU's own writes leave the second one be.
+    static const uint8_t s_Subroutine[] = {
+        0xB0, 0x10, 0x00, 0x00, 0x22, 0x00, 0x00, 0xA0, 0x10, 0x00, 0x00, 0x25
+    };
+    memcpy(p_XRAM, s_Subroutine, sizeof(s_Subroutine));
+
+    // The main program runs the loop once, spins until the bus sets the first byte of DRAM, runs
+    // the loop again, then spins for good.
+    p_Builder->m_Address = TM_CODE_BEGIN;
+    TEST_EmitSelfModifyingLoop(p_Builder);
+
+    uint32_t l_Wait = p_Builder->m_Address;
+    TEST_Emit(p_Builder, 0x11, TM_REG_EH, 0);
+    TEST_EmitOperand(p_Builder, TM_DRAM_BEGIN, 4);
+    TEST_Emit(p_Builder, 0x32, TM_REG_EH, 0);
+    TEST_Emit(p_Builder, 0x22, TM_COND_ZC, 0);
+    TEST_EmitOperand(p_Builder, l_Wait - (p_Builder->m_Address + 2), 2);
+
+    TEST_EmitSelfModifyingLoop(p_Builder);
+    TEST_Emit(p_Builder, 0x22, TM_COND_NC, 0);
+    TEST_EmitOperand(p_Builder, (uint32_t) -4, 2);
+}
+
+// Private Functions - Differential Test ///////////////////////////////////////////////////////////
+
+static bool TEST_CompareCPUs (const TM_CPU* p_Interpreted, const TEST_JITBus* p_InterpretedBus,
+    const TM_CPU* p_Compiled, const TEST_JITBus* p_CompiledBus, const char* p_Context)
+{
+    static const struct { TM_CPURegister m_Register; const char* m_Name; } s_Registers[] = {
+        { TM_REG_A, "A" }, { TM_REG_B, "B" }, { TM_REG_C, "C" }, { TM_REG_E, "E" }
+    };
+    static const struct { TM_CPUFlag m_Flag; const char* m_Name; } s_Flags[] = {
+        { TM_FLAG_Z, "Z" }, { TM_FLAG_N, "N" }, { TM_FLAG_H, "H" }, { TM_FLAG_C, "C" }
+    };
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        uint32_t l_Expected = TM_GetRegister(p_Interpreted, s_Registers[i].m_Register);
+        uint32_t l_Actual = TM_GetRegister(p_Compiled, s_Registers[i].m_Register);
+        TEST_expect(l_Expected == l_Actual, "%s: register %s is 0x%08X; expected 0x%08X.",
+            p_Context, s_Registers[i].m_Name, l_Actual, l_Expected);
+    }
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        bool l_Expected = TM_GetFlag(p_Interpreted, s_Flags[i].m_Flag);
+        bool l_Actual = TM_GetFlag(p_Compiled, s_Flags[i].m_Flag);
+        TEST_expect(l_Expected == l_Actual, "%s: flag %s is %d; expected %d.", p_Context,
+            s_Flags[i].m_Name, l_Actual, l_Expected);
+    }
+
+    TEST_expect(TM_GetProgramCounter(p_Interpreted) == TM_GetProgramCounter(p_Compiled),
+        "%s: PC is 0x%08X; expected 0x%08X.", p_Context, TM_GetProgramCounter(p_Compiled),
+        TM_GetProgramCounter(p_Interpreted));
+    TEST_expect(TM_GetDataStackPointer(p_Interpreted) == TM_GetDataStackPointer(p_Compiled),
+        "%s: the data stack pointers differ.", p_Context);
+    TEST_expect(TM_GetCallStackPointer(p_Interpreted) == TM_GetCallStackPointer(p_Compiled),
+        "%s: the call stack pointers differ.", p_Context);
+    TEST_expect(TM_GetInterruptEnable(p_Interpreted) == TM_GetInterruptEnable(p_Compiled) &&
+        TM_GetInterruptFlags(p_Interpreted) == TM_GetInterruptFlags(p_Compiled) &&
+        TM_GetInterruptMasterEnable(p_Interpreted) == TM_GetInterruptMasterEnable(p_Compiled),
+        "%s: the interrupt registers differ.", p_Context);
+    TEST_expect(TM_GetErrorCode(p_Interpreted) == TM_GetErrorCode(p_Compiled),
+        "%s: error code is 0x%02X; expected 0x%02X.", p_Context, TM_GetErrorCode(p_Compiled),
+        TM_GetErrorCode(p_Interpreted));
+    TEST_expect(TM_IsHalted(p_Interpreted) == TM_IsHalted(p_Compiled) &&
+        TM_IsStopped(p_Interpreted) == TM_IsStopped(p_Compiled),
+        "%s: the halt or stop states differ.", p_Context);
+    TEST_expect(p_InterpretedBus->m_Cycles == p_CompiledBus->m_Cycles,
+        "%s: the bus saw %llu cycles; expected %llu.", p_Context,
+        (unsigned long long) p_CompiledBus->m_Cycles,
+        (unsigned long long) p_InterpretedBus->m_Cycles);
+    TEST_expect(
+        memcmp(p_InterpretedBus->m_DRAM, p_CompiledBus->m_DRAM, TEST_JIT_DRAM_SIZE) == 0 &&
+        memcmp(p_InterpretedBus->m_XRAM, p_CompiledBus->m_XRAM, TEST_JIT_XRAM_SIZE) == 0 &&
+        memcmp(p_InterpretedBus->m_DataStack, p_CompiledBus->m_DataStack, TEST_JIT_STACK_SIZE) == 0 &&
+        memcmp(p_InterpretedBus->m_CallStack, p_CompiledBus->m_CallStack, TEST_JIT_STACK_SIZE) == 0,
+        "%s: memory differs.", p_Context);
+
+    return true;
+}
+
+static bool TEST_ResetCPUs (TEST_JITBus* p_Buses, TM_CPU** p_CPUs, bool p_Batching)
+{
+    // The first CPU is interpreted; the second runs its hot blocks as compiled code. Both buses
+    // must already hold the same ROM and XRAM.
+    for (int i = 0; i < 2; ++i)
+    {
+        memset(p_Buses[i].m_DRAM, 0, TEST_JIT_DRAM_SIZE);
+        memset(p_Buses[i].m_DataStack, 0, TEST_JIT_STACK_SIZE);
+        memset(p_Buses[i].m_CallStack, 0, TEST_JIT_STACK_SIZE);
+        p_Buses[i].m_Cycles = 0;
+        p_Buses[i].m_Calls = 0;
+        p_Buses[i].m_BreakOnEvent = false;
+        TM_ResetCPU(p_CPUs[i]);
+        TM_SetCycleBatching(p_CPUs[i], p_Batching);
+        TM_SetNextEventFunction(p_CPUs[i], TEST_JITNextEvent);
+        TM_SetInterruptEnable(p_CPUs[i], 0x01);
+    }
+
+    return TM_SetJITCompilation(p_CPUs[1], true);
+}
+
+static bool TEST_StepCPUs (TEST_JITBus* p_Buses, TM_CPU** p_CPUs, uint64_t p_Budget,
+    const char* p_Context, uint64_t* p_Cycles)
+{
+    // The compiled CPU runs first. The interpreter is then given exactly the cycles the compiled
+    // CPU ran. Every instruction takes at least one cycle, so that brings it to the same
+    // instruction boundary.
+    uint64_t l_Cycles[2] = { 0 }, l_Instructions[2] = { 0 };
+    bool l_Running[2];
+    l_Running[1] = TM_RunCPU(p_CPUs[1], p_Budget, &l_Cycles[1], &l_Instructions[1]);
+    l_Running[0] = TM_RunCPU(p_CPUs[0], l_Cycles[1], &l_Cycles[0], &l_Instructions[0]);
+
+    TEST_expect(l_Running[0] == l_Running[1] && l_Cycles[0] == l_Cycles[1] &&
+        l_Instructions[0] == l_Instructions[1],
+        "%s: ran %llu cycles and %llu instructions; expected %llu and %llu.", p_Context,
+        (unsigned long long) l_Cycles[1], (unsigned long long) l_Instructions[1],
+        (unsigned long long) l_Cycles[0], (unsigned long long) l_Instructions[0]);
+    if (TEST_CompareCPUs(p_CPUs[0], &p_Buses[0], p_CPUs[1], &p_Buses[1], p_Context) == false)
+    {
+        return false;
+    }
+
+    TEST_expect(l_Running[0] == true, "%s: the CPU stopped with error code 0x%02X.", p_Context,
+        TM_GetErrorCode(p_CPUs[0]));
+    *p_Cycles = l_Cycles[0];
+    return true;
+}
+
+static bool TEST_RunDifferential (TEST_JITBus* p_Buses, TM_CPU** p_CPUs, uint32_t p_Seed,
+    bool p_Batching, bool p_PerBlock, bool* p_Supported)
+{
+    TEST_ProgramBuilder l_Builder = { .m_ROM = p_Buses[0].m_ROM, .m_Seed = p_Seed };
+    memset(p_Buses[0].m_ROM, 0, TEST_JIT_ROM_SIZE);
+    TEST_BuildProgram(&l_Builder);
+    memcpy(p_Buses[1].m_ROM, p_Buses[0].m_ROM, TEST_JIT_ROM_SIZE);
+
+    if (TEST_ResetCPUs(p_Buses, p_CPUs, p_Batching) == false)
+    {
+        *p_Supported = false;
+        return true;
+    }
+
+    // Run both CPUs in step, comparing them after each step. Stepping a block at a time, the
+    // compiled CPU breaks as it enters compiled code, so it returns, and is compared, as soon as
+    // each compiled block does. A block which goes astray then cannot go unnoticed by setting
+    // things right again later. This needs cycle batching, without which the CPU opens no quiet
+    // window, and so never asks for the next event. Stepping through slices of cycles, most of them
+    // short, lets compiled code hold its cycles back through a quiet window spanning several blocks.
+    p_Buses[1].m_BreakOnEvent = p_PerBlock;
+    uint32_t l_Slice = p_Seed;
+    uint64_t l_Total = 0;
+    while (l_Total < TEST_JIT_CYCLES)
+    {
+        uint64_t l_Budget = TEST_JIT_STEP_CYCLES;
+        if (p_PerBlock == false)
+        {
+            l_Slice = (l_Slice * 1664525u) + 1013904223u;
+            l_Budget = ((l_Slice >> 16) % 8 == 0) ? ((l_Slice >> 8) % 4000) + 1 :
+                ((l_Slice >> 8) % 60) + 1;
+        }
+
+        char l_Context[112];
+        snprintf(l_Context, sizeof(l_Context), "Seed %u, batching %s, stepping by %s, at cycle %llu",
+            p_Seed, (p_Batching == true) ? "on" : "off", (p_PerBlock == true) ? "block" : "slice",
+            (unsigned long long) l_Total);
+
+        uint64_t l_Cycles = 0;
+        if (TEST_StepCPUs(p_Buses, p_CPUs, l_Budget, l_Context, &l_Cycles) == false)
+        {
+            return false;
+        }
+
+        l_Total += l_Cycles;
+    }
+
+    // With batching on, compiled code holds its cycles back through each quiet window, so it must
+    // have called the cycle function less often. If not, then no compiled code ever ran.
+    TEST_expect(p_Batching == false || p_Buses[1].m_Calls < p_Buses[0].m_Calls,
+        "Seed %u: compiled code called the cycle function %llu times; the interpreter, %llu.",
+        p_Seed, (unsigned long long) p_Buses[1].m_Calls, (unsigned long long) p_Buses[0].m_Calls);
+
+    return true;
+}
+
+static bool TEST_RunSelfModifying (TEST_JITBus* p_Buses, TM_CPU** p_CPUs, bool p_Batching)
+{
+    TEST_ProgramBuilder l_Builder = { .m_ROM = p_Buses[0].m_ROM };
+    memset(p_Buses[0].m_ROM, 0, TEST_JIT_ROM_SIZE);
+    memset(p_Buses[0].m_XRAM, 0, TEST_JIT_XRAM_SIZE);
+    TEST_BuildSelfModifyingProgram(&l_Builder, p_Buses[0].m_XRAM);
+    memcpy(p_Buses[1].m_ROM, p_Buses[0].m_ROM, TEST_JIT_ROM_SIZE);
+    memcpy(p_Buses[1].m_XRAM, p_Buses[0].m_XRAM, TEST_JIT_XRAM_SIZE);
+    TEST_expect(TEST_ResetCPUs(p_Buses, p_CPUs, p_Batching) == true,
+        "Could not enable JIT compilation for the self-modifying program.");
+    p_Buses[1].m_BreakOnEvent = true;
+
+    // Each call adds the subroutine's `C` to `A`: in the first loop, just the iteration count the
+    // CPU stored into it; in the second, also the byte the bus patched in, shifted into `CH`.
+    uint32_t l_Expected = 0;
+    for (uint32_t l_Half = 0; l_Half < 2; ++l_Half)
+    {
+        for (uint32_t i = 1; i <= TEST_JIT_SMC_ITERATIONS; ++i)
+        {
+            l_Expected += (l_Half * TEST_JIT_SMC_ITERATIONS) + i + (l_Half * (TEST_JIT_SMC_PATCH << 8));
+        }
+
+        char l_Context[96];
+        for (uint64_t l_Total = 0; l_Total < TEST_JIT_SMC_CYCLES; )
+        {
+            snprintf(l_Context, sizeof(l_Context),
+                "Self-modifying program, batching %s, loop %u, at cycle %llu",
+                (p_Batching == true) ? "on" : "off", l_Half + 1, (unsigned long long) l_Total);
+
+            uint64_t l_Cycles = 0;
+            if (TEST_StepCPUs(p_Buses, p_CPUs, TEST_JIT_STEP_CYCLES, l_Context, &l_Cycles) == false)
+            {
+                return false;
+            }
+
+            l_Total += l_Cycles;
+        }
+
+        for (int i = 0; i < 2; ++i)
+        {
+            TEST_expect(TM_GetRegister(p_CPUs[i], TM_REG_A) == l_Expected,
+                "%s: register A is 0x%08X; expected 0x%08X, so a stale instruction was run.",
+                l_Context, TM_GetRegister(p_CPUs[i], TM_REG_A), l_Expected);
+        }
+
+        // Between the loops, patch the subroutine's second immediate behind the CPUs' backs, tell
+        // them so, and let them out of their spin loops.
+        for (int i = 0; i < 2 && l_Half == 0; ++i)
+        {
+            p_Buses[i].m_XRAM[9] = TEST_JIT_SMC_PATCH;
+            TM_InvalidateCPUCode(p_CPUs[i], TM_XRAM_BEGIN + 9, 1);
+            p_Buses[i].m_DRAM[0] = 1;
+        }
+    }
+
+    return true;
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_CPUJITDifferential (void)
+{
+    TEST_JITBus* l_Buses = TM_calloc(2, TEST_JITBus);
+    TEST_expect(l_Buses != NULL, "Could not allocate the differential test's buses.");
+
+    TM_CPU* l_CPUs[2] = {
+        TM_CreateCPU(TEST_JITBusRead, TEST_JITBusWrite, TEST_JITCycle, &l_Buses[0]),
+        TM_CreateCPU(TEST_JITBusRead, TEST_JITBusWrite, TEST_JITCycle, &l_Buses[1])
+    };
+    l_Buses[0].m_CPU = l_CPUs[0];
+    l_Buses[1].m_CPU = l_CPUs[1];
+
+    // Run each random program stepping a block at a time, then through slices of cycles with cycle
+    // batching both enabled and disabled, then run the self-modifying program. If JIT compilation is
+    // not supported on this platform, then there is nothing to compare.
+    bool l_Passed = (l_CPUs[0] != NULL && l_CPUs[1] != NULL);
+    bool l_Supported = true;
+    for (uint32_t l_Seed = 1; l_Seed <= TEST_JIT_SEEDS && l_Passed == true && l_Supported == true;
+        ++l_Seed)
+    {
+        for (int j = 0; j < 3 && l_Passed == true; ++j)
+        {
+            l_Passed = TEST_RunDifferential(l_Buses, l_CPUs, l_Seed, (j < 2), (j == 0),
+                &l_Supported);
+        }
+    }
+
+    for (int j = 0; j < 2 && l_Passed == true && l_Supported == true; ++j)
+    {
+        l_Passed = TEST_RunSelfModifying(l_Buses, l_CPUs, (j == 0));
+    }
+
+    if (l_Supported == false)
+    {
+        printf("JIT compilation is not supported on this platform; skipping.\n");
+    }
+
+    TM_DestroyCPU(l_CPUs[0]);
+    TM_DestroyCPU(l_CPUs[1]);
+    TM_free(l_Buses);
+    return l_Passed;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file  CPUTiming.c
+ */
+
+#include <Tests.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_TIMING_MEMORY_SIZE     0x10000     ///< @brief The size of the timing test bus's memory. Every address is folded into it.
+#define TEST_TIMING_MAX_CODE_SIZE   16          ///< @brief The largest number of code bytes a timing case may run.
+
+// Timing Bus Structure ////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   A bus made of plain memory, which counts the cycles the CPU passes to it. The low 16 bits
+ *          of an address select its byte of memory, so the cases below keep their code, data and
+ *          stacks apart within those 16 bits.
+ */
+typedef struct TEST_TimingBus
+{
+    uint8_t     m_Memory[TEST_TIMING_MEMORY_SIZE];  ///< @brief The bus's memory.
+    uint64_t    m_Cycles;                           ///< @brief The total number of cycles passed to the cycle function.
+} TEST_TimingBus;
+
+// Timing Case Structure ///////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Describes a run of one or more instructions, placed at the start of the program code, and
+ *          the total number of cycles they are expected to take.
+ */
+typedef struct TEST_TimingCase
+{
+    const char* m_Name;                             ///< @brief The instructions' mnemonics.
+    uint8_t     m_Code[TEST_TIMING_MAX_CODE_SIZE];  ///< @brief The instructions' bytes.
+    uint8_t     m_Steps;                            ///< @brief The number of instructions to step through.
+    uint32_t    m_B;                                ///< @brief The value of register `B` beforehand, used as a pointer.
+    uint32_t    m_Cycles;                           ///< @brief The total number of cycles expected.
+} TEST_TimingCase;
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// Every instruction takes two cycles to fetch its opcode word, plus one cycle per byte of its
+// operand, plus one cycle per byte of memory it reads or writes. Stack accesses take one more cycle
+// to move the stack pointer, and taken jumps one more to move the program counter.
+static const TEST_TimingCase s_TimingCases[] = {
+    { "NOP",                    { 0x00, 0x00 },                                 1, 0,           2 },
+    { "LD A, IMM32",            { 0x00, 0x10, 0x78, 0x56, 0x34, 0x12 },         1, 0,           6 },
+    { "LD AW, IMM16",           { 0x10, 0x10, 0x34, 0x12 },                     1, 0,           4 },
+    { "LD AL, IMM8",            { 0x30, 0x10, 0x12 },                           1, 0,           3 },
+    { "LD A, [ADDR32]",         { 0x00, 0x11, 0x00, 0x01, 0x00, 0x80 },         1, 0,           10 },
+    { "LD AL, [ADDR32]",        { 0x30, 0x11, 0x00, 0x01, 0x00, 0x80 },         1, 0,           7 },
+    { "LD A, [B]",              { 0x04, 0x12 },                                 1, 0x80000100,  6 },
+    { "LDQ A, [ADDR16]",        { 0x00, 0x13, 0x00, 0x02 },                     1, 0,           8 },
+    { "LDQ AW, [BW]",           { 0x15, 0x14 },                                 1, 0x0200,      4 },
+    { "LDH AL, [ADDR8]",        { 0x30, 0x15, 0x10 },                           1, 0,           4 },
+    { "LDH AL, [BL]",           { 0x37, 0x16 },                                 1, 0x10,        3 },
+    { "ST [ADDR32], A",         { 0x00, 0x17, 0x00, 0x01, 0x00, 0x80 },         1, 0,           10 },
+    { "ST [B], A",              { 0x40, 0x18 },                                 1, 0x80000100,  6 },
+    { "STQ [ADDR16], AW",       { 0x01, 0x19, 0x00, 0x02 },                     1, 0,           6 },
+    { "STQ [BW], A",            { 0x50, 0x1A },                                 1, 0x0200,      6 },
+    { "STH [ADDR8], AL",        { 0x03, 0x1B, 0x10 },                           1, 0,           4 },
+    { "STH [BL], AL",           { 0x73, 0x1C },                                 1, 0x10,        3 },
+    { "MV A, B",                { 0x04, 0x1D },                                 1, 0,           2 },
+    { "PUSH A; POP B",          { 0x00, 0x1E, 0x40, 0x1F },                     2, 0,           14 },
+    { "JMP NC, ADDR32",         { 0x00, 0x20, 0x00, 0x31, 0x00, 0x00 },         1, 0,           7 },
+    { "JMP ZS, ADDR32 (not taken)", { 0x10, 0x20, 0x00, 0x31, 0x00, 0x00 },     1, 0,           6 },
+    { "JMP NC, B",              { 0x04, 0x21 },                                 1, 0x3100,      3 },
+    { "JPB NC, SIMM16",         { 0x00, 0x22, 0x10, 0x00 },                     1, 0,           5 },
+    { "CALL NC, ADDR32; RET NC", { 0x00, 0x23, 0x06, 0x30, 0x00, 0x00, 0x00, 0x25 }, 2, 0,      20 },
+    { "RST 1",                  { 0x01, 0x24 },                                 1, 0,           8 },
+    { "INC A",                  { 0x00, 0x30 },                                 1, 0,           2 },
+    { "INC [B]",                { 0x40, 0x31 },                                 1, 0x80000100,  7 },
+    { "ADD A, IMM32",           { 0x00, 0x34, 0x01, 0x00, 0x00, 0x00 },         1, 0,           6 },
+    { "ADD A, B",               { 0x04, 0x35 },                                 1, 0,           2 },
+    { "ADD A, [B]",             { 0x04, 0x36 },                                 1, 0x80000100,  6 },
+};
+
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static uint8_t TEST_TimingBusRead (void* p_Context, uint32_t p_Address)
+{
+    TEST_TimingBus* l_Bus = (TEST_TimingBus*) p_Context;
+    return l_Bus->m_Memory[p_Address % TEST_TIMING_MEMORY_SIZE];
+}
+
+static void TEST_TimingBusWrite (void* p_Context, uint32_t p_Address, uint8_t p_Data)
+{
+    TEST_TimingBus* l_Bus = (TEST_TimingBus*) p_Context;
+    l_Bus->m_Memory[p_Address % TEST_TIMING_MEMORY_SIZE] = p_Data;
+}
+
+static bool TEST_TimingCycle (void* p_Context, uint32_t p_Cycles)
+{
+    TEST_TimingBus* l_Bus = (TEST_TimingBus*) p_Context;
+    l_Bus->m_Cycles += p_Cycles;
+    return true;
+}
+
+static bool TEST_RunTimingCase (TEST_TimingBus* p_Bus, TM_CPU* p_CPU, const TEST_TimingCase* p_Case,
+    bool p_Batching, uint64_t* p_Cycles)
+{
+    // Start from a clean CPU and bus, with the case's code at the start of the program code.
+    TM_ResetCPU(p_CPU);
+    TM_SetCycleBatching(p_CPU, p_Batching);
+    memset(p_Bus->m_Memory, 0, sizeof(p_Bus->m_Memory));
+    memcpy(&p_Bus->m_Memory[TM_CODE_BEGIN % TEST_TIMING_MEMORY_SIZE], p_Case->m_Code,
+        TEST_TIMING_MAX_CODE_SIZE);
+    TM_SetRegister(p_CPU, TM_REG_B, p_Case->m_B);
+    p_Bus->m_Cycles = 0;
+
+    for (uint8_t i = 0; i < p_Case->m_Steps; ++i)
+    {
+        TEST_expect(TM_StepCPU(p_CPU) == true && TM_GetErrorCode(p_CPU) == TM_EC_OK,
+            "'%s' failed with error code 0x%02X (batching %s).", p_Case->m_Name,
+            TM_GetErrorCode(p_CPU), (p_Batching == true) ? "on" : "off");
+    }
+
+    *p_Cycles = p_Bus->m_Cycles;
+    return true;
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_CPUCycleTiming (void)
+{
+    TEST_TimingBus* l_Bus = TM_calloc(1, TEST_TimingBus);
+    TM_CPU* l_CPU = TM_CreateCPU(TEST_TimingBusRead, TEST_TimingBusWrite, TEST_TimingCycle, l_Bus);
+    TEST_expect(l_Bus != NULL && l_CPU != NULL, "Could not create the timing test's CPU.");
+
+    // Each instruction must pass exactly its own number of cycles to the cycle function, once
+    // each, whether or not the cycles are batched.
+    bool l_Passed = true;
+    size_t l_Count = sizeof(s_TimingCases) / sizeof(s_TimingCases[0]);
+    for (size_t i = 0; i < l_Count; ++i)
+    {
+        const TEST_TimingCase* l_Case = &s_TimingCases[i];
+        for (int j = 0; j < 2; ++j)
+        {
+            bool l_Batching = (j == 1);
+            uint64_t l_Cycles = 0;
+            if (TEST_RunTimingCase(l_Bus, l_CPU, l_Case, l_Batching, &l_Cycles) == false)
+            {
+                l_Passed = false;
+                continue;
+            }
+
+            if (l_Cycles != l_Case->m_Cycles)
+            {
+                TM_error("'%s' took %llu cycles with batching %s; expected %u.", l_Case->m_Name,
+                    (unsigned long long) l_Cycles, (l_Batching == true) ? "on" : "off",
+                    l_Case->m_Cycles);
+                l_Passed = false;
+            }
+        }
+    }
+
+    TM_DestroyCPU(l_CPU);
+    TM_free(l_Bus);
+    return l_Passed;
+}
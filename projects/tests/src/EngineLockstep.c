@@ -0,0 +1,255 @@
+/**
+ * @file  EngineLockstep.c
+ */
+
+#include <Tests.h>
+#include <TOMBOY/Engine.h>
+#include <TOMBOY/PPU.h>
+#include <TOMBOY/Program.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_LOCKSTEP_FILENAME      "tests-lockstep.tomboy" ///< @brief The file the lockstep test's program is written to, and removed afterwards.
+#define TEST_LOCKSTEP_PROGRAM_SIZE  0x3100      ///< @brief The size of the lockstep test's program.
+#define TEST_LOCKSTEP_FRAMES        300         ///< @brief The number of frames to run the program for.
+#define TEST_LOCKSTEP_FRAME_CYCLES  (TOMBOY_PPU_DOTS_PER_FRAME / 4) ///< @brief The number of CPU cycles in a frame, at normal speed.
+
+// Port Shorthands /////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_rDIV       (TOMBOY_HP_DIV & 0xFF)
+#define TEST_rTIMA      (TOMBOY_HP_TIMA & 0xFF)
+#define TEST_rTMA       (TOMBOY_HP_TMA & 0xFF)
+#define TEST_rTAC       (TOMBOY_HP_TAC & 0xFF)
+#define TEST_rLCDC      (TOMBOY_HP_LCDC & 0xFF)
+#define TEST_rSTAT      (TOMBOY_HP_STAT & 0xFF)
+#define TEST_rSCX       (TOMBOY_HP_SCX & 0xFF)
+#define TEST_rLY        (TOMBOY_HP_LY & 0xFF)
+#define TEST_rLYC       (TOMBOY_HP_LYC & 0xFF)
+#define TEST_rDMA1      (TOMBOY_HP_DMA1 & 0xFF)
+#define TEST_rDMA2      (TOMBOY_HP_DMA2 & 0xFF)
+#define TEST_rDMA3      (TOMBOY_HP_DMA3 & 0xFF)
+#define TEST_rDMA       (TOMBOY_HP_DMA & 0xFF)
+#define TEST_rKEY1      (TOMBOY_HP_KEY1 & 0xFF)
+#define TEST_rIE        (TOMBOY_HP_IE & 0xFF)
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// The vertical blank handler counts frames in `CL`, and from that count moves `LYC` and `SCX`,
+// changes the timer's frequency and the `STAT` interrupt sources, resets the divider and starts an
+// OAM DMA transfer every 8 frames, switches speed every 32 frames and turns the display off for
+// every 32nd frame.
+static const uint8_t s_VerticalBlankHandler[] = {
+    0xB0, 0x30,                         // INC CL
+    0x30, 0x15, TEST_rLYC,              // LDH AL, [rLYC]
+    0x30, 0x34, 37,                     // ADD AL, 37
+    0x03, 0x1B, TEST_rLYC,              // STH [rLYC], AL
+    0x03, 0x1B, TEST_rSCX,              // STH [rSCX], AL
+    0x3B, 0x1D,                         // MV AL, CL
+    0x30, 0x40, 0x03,                   // AND AL, $03
+    0x30, 0x43, 0x04,                   // OR AL, $04
+    0x03, 0x1B, TEST_rTAC,              // STH [rTAC], AL
+    0x3B, 0x1D,                         // MV AL, CL
+    0x30, 0x40, 0x78,                   // AND AL, $78
+    0x03, 0x1B, TEST_rSTAT,             // STH [rSTAT], AL
+    0x3B, 0x1D,                         // MV AL, CL
+    0x30, 0x40, 0x07,                   // AND AL, $07
+    0x20, 0x22, 0x0C, 0x00,             // JPB ZC, +12
+    0x03, 0x1B, TEST_rDIV,              // STH [rDIV], AL
+    0x30, 0x10, 0x30,                   // LD AL, $30
+    0x03, 0x1B, TEST_rDMA3,             // STH [rDMA3], AL
+    0x03, 0x1B, TEST_rDMA,              // STH [rDMA], AL
+    0x3B, 0x1D,                         // MV AL, CL
+    0x30, 0x40, 0x20,                   // AND AL, $20
+    0x03, 0x1B, TEST_rKEY1,             // STH [rKEY1], AL
+    0x3B, 0x1D,                         // MV AL, CL
+    0x30, 0x40, 0x1F,                   // AND AL, $1F
+    0x30, 0x50, 0x1F,                   // CMP AL, $1F
+    0x20, 0x22, 0x03, 0x00,             // JPB ZC, +3
+    0x03, 0x1B, TEST_rLCDC,             // STH [rLCDC], AL
+    0x00, 0x26,                         // RETI
+};
+
+// The `STAT` handler counts its interrupts in `BH`.
+static const uint8_t s_LCDStatusHandler[] = {
+    0x60, 0x30,                         // INC BH
+    0x30, 0x15, TEST_rSTAT,             // LDH AL, [rSTAT]
+    0x00, 0x26,                         // RETI
+};
+
+// The timer handler counts its interrupts in `BL`, turns the display back on, and reloads the timer
+// from the divider.
+static const uint8_t s_TimerHandler[] = {
+    0x70, 0x30,                         // INC BL
+    0x30, 0x10, 0x91,                   // LD AL, $91
+    0x03, 0x1B, TEST_rLCDC,             // STH [rLCDC], AL
+    0x30, 0x15, TEST_rDIV,              // LDH AL, [rDIV]
+    0x03, 0x1B, TEST_rTMA,              // STH [rTMA], AL
+    0x00, 0x26,                         // RETI
+};
+
+// The main routine enables the display, the timer and their interrupts, then loops: it spins for a
+// while, reads `LY`, `STAT` and `TIMA`, writes `TIMA` back and halts until the next interrupt.
+static const uint8_t s_MainRoutine[] = {
+    0x30, 0x10, 0x07,                   // LD AL, $07
+    0x03, 0x1B, TEST_rIE,               // STH [rIE], AL
+    0x30, 0x10, 0x00,                   // LD AL, $00
+    0x03, 0x1B, TEST_rDMA1,             // STH [rDMA1], AL
+    0x03, 0x1B, TEST_rDMA2,             // STH [rDMA2], AL
+    0x30, 0x10, 0x91,                   // LD AL, $91
+    0x03, 0x1B, TEST_rLCDC,             // STH [rLCDC], AL
+    0x30, 0x10, 0x78,                   // LD AL, $78
+    0x03, 0x1B, TEST_rSTAT,             // STH [rSTAT], AL
+    0x30, 0x10, 0x05,                   // LD AL, $05
+    0x03, 0x1B, TEST_rTAC,              // STH [rTAC], AL
+    0x30, 0x10, 0x40,                   // LD AL, $40
+    0x03, 0x1B, TEST_rLYC,              // STH [rLYC], AL
+    0x00, 0x06,                         // EI
+                                        // LOOP:
+    0xF0, 0x10, 0x40,                   //     LD EL, $40
+                                        // SPIN:
+    0xF0, 0x32,                         //     DEC EL
+    0x20, 0x22, 0xFA, 0xFF,             //     JPB ZC, SPIN
+    0x30, 0x15, TEST_rLY,               //     LDH AL, [rLY]
+    0x30, 0x15, TEST_rSTAT,             //     LDH AL, [rSTAT]
+    0x30, 0x15, TEST_rTIMA,             //     LDH AL, [rTIMA]
+    0x03, 0x1B, TEST_rTIMA,             //     STH [rTIMA], AL
+    0x00, 0x02,                         //     HALT
+    0x00, 0x22, 0xE5, 0xFF,             //     JPB NC, LOOP
+};
+
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static bool TEST_WriteLockstepProgram (void)
+{
+    // The program's header needs only its identifier: the rest of it may be left zeroed.
+    uint8_t* l_Data = TM_calloc(TEST_LOCKSTEP_PROGRAM_SIZE, uint8_t);
+    TEST_expect(l_Data != NULL, "Could not allocate the lockstep test's program.");
+    memcpy(l_Data, "TMBY", 4);
+    memcpy(&l_Data[TM_INT_BEGIN + 0x100 * TOMBOY_IT_VBLANK], s_VerticalBlankHandler,
+        sizeof(s_VerticalBlankHandler));
+    memcpy(&l_Data[TM_INT_BEGIN + 0x100 * TOMBOY_IT_LCDSTAT], s_LCDStatusHandler,
+        sizeof(s_LCDStatusHandler));
+    memcpy(&l_Data[TM_INT_BEGIN + 0x100 * TOMBOY_IT_TIMER], s_TimerHandler, sizeof(s_TimerHandler));
+    memcpy(&l_Data[TM_CODE_BEGIN], s_MainRoutine, sizeof(s_MainRoutine));
+
+    FILE* l_File = fopen(TEST_LOCKSTEP_FILENAME, "wb");
+    bool l_Written = (l_File != NULL) &&
+        (fwrite(l_Data, 1, TEST_LOCKSTEP_PROGRAM_SIZE, l_File) == TEST_LOCKSTEP_PROGRAM_SIZE);
+    if (l_File != NULL)
+    {
+        l_Written = (fclose(l_File) == 0) && l_Written;
+    }
+
+    TM_free(l_Data);
+    TEST_expect(l_Written == true, "Could not write the lockstep test's program to '%s'.",
+        TEST_LOCKSTEP_FILENAME);
+    return true;
+}
+
+static bool TEST_CompareEngines (TOMBOY_Engine* p_Scheduled, TOMBOY_Engine* p_Ticked,
+    uint32_t p_Frame)
+{
+    const TM_CPU* l_Scheduled = TOMBOY_GetCPU(p_Scheduled);
+    const TM_CPU* l_Ticked = TOMBOY_GetCPU(p_Ticked);
+
+    TEST_expect(TOMBOY_GetCycleCount(p_Scheduled) == TOMBOY_GetCycleCount(p_Ticked),
+        "Frame %u: the engines' cycle counts differ (%llu scheduled, %llu ticked).", p_Frame,
+        (unsigned long long) TOMBOY_GetCycleCount(p_Scheduled),
+        (unsigned long long) TOMBOY_GetCycleCount(p_Ticked));
+
+    // The ports are read through the bus, which brings the scheduled engine's components up to
+    // date first, just as a program's reads would.
+    static const struct { const char* m_Name; uint32_t m_Address; } s_Ports[] = {
+        { "LY",     TOMBOY_HP_LY },
+        { "STAT",   TOMBOY_HP_STAT },
+        { "DIV",    TOMBOY_HP_DIV },
+        { "TIMA",   TOMBOY_HP_TIMA },
+        { "IF",     TOMBOY_HP_IF },
+    };
+    for (size_t i = 0; i < sizeof(s_Ports) / sizeof(s_Ports[0]); ++i)
+    {
+        uint8_t l_Expected = TM_ReadByte(l_Ticked, s_Ports[i].m_Address);
+        uint8_t l_Actual = TM_ReadByte(l_Scheduled, s_Ports[i].m_Address);
+        TEST_expect(l_Actual == l_Expected,
+            "Frame %u: %s is 0x%02X with event scheduling; expected 0x%02X.", p_Frame,
+            s_Ports[i].m_Name, l_Actual, l_Expected);
+    }
+
+    TEST_expect(TM_GetInterruptFlags(l_Scheduled) == TM_GetInterruptFlags(l_Ticked),
+        "Frame %u: the interrupt flags differ (0x%02X scheduled, 0x%02X ticked).", p_Frame,
+        TM_GetInterruptFlags(l_Scheduled), TM_GetInterruptFlags(l_Ticked));
+    TEST_expect(TM_GetProgramCounter(l_Scheduled) == TM_GetProgramCounter(l_Ticked),
+        "Frame %u: the program counters differ (0x%08X scheduled, 0x%08X ticked).", p_Frame,
+        TM_GetProgramCounter(l_Scheduled), TM_GetProgramCounter(l_Ticked));
+
+    // The handlers' counters show that both engines took the same interrupts.
+    for (TM_CPURegister l_Register = TM_REG_A; l_Register <= TM_REG_E; l_Register += 4)
+    {
+        TEST_expect(TM_GetRegister(l_Scheduled, l_Register) == TM_GetRegister(l_Ticked, l_Register),
+            "Frame %u: register %u differs (0x%08X scheduled, 0x%08X ticked).", p_Frame,
+            l_Register, TM_GetRegister(l_Scheduled, l_Register),
+            TM_GetRegister(l_Ticked, l_Register));
+    }
+
+    return true;
+}
+
+static bool TEST_RunLockstep (const TOMBOY_Program* p_Program)
+{
+    TOMBOY_Engine* l_Scheduled = TOMBOY_CreateEngine(p_Program);
+    TOMBOY_Engine* l_Ticked = TOMBOY_CreateEngine(p_Program);
+    bool l_Passed = (l_Scheduled != NULL && l_Ticked != NULL);
+    if (l_Passed == false)
+    {
+        TM_error("Could not create the lockstep test's engines.");
+    }
+    else
+    {
+        TOMBOY_SetEventScheduling(l_Ticked, false);
+    }
+
+    // Run both engines a frame at a time, and compare them after each frame.
+    for (uint32_t i = 0; i < TEST_LOCKSTEP_FRAMES && l_Passed == true; ++i)
+    {
+        TOMBOY_RunEngine(l_Scheduled, TEST_LOCKSTEP_FRAME_CYCLES);
+        TOMBOY_RunEngine(l_Ticked, TEST_LOCKSTEP_FRAME_CYCLES);
+        l_Passed = TEST_CompareEngines(l_Scheduled, l_Ticked, i);
+    }
+
+    // Make sure the program did what it was meant to: take each of its interrupts.
+    if (l_Passed == true)
+    {
+        uint32_t l_B = TM_GetRegister(TOMBOY_GetCPU(l_Scheduled), TM_REG_B);
+        uint32_t l_C = TM_GetRegister(TOMBOY_GetCPU(l_Scheduled), TM_REG_C);
+        l_Passed = ((l_B & 0xFF) != 0 && (l_B & 0xFF00) != 0 && (l_C & 0xFF) != 0);
+        if (l_Passed == false)
+        {
+            TM_error("The lockstep test's program did not take all of its interrupts (B = 0x%08X, "
+                "C = 0x%08X).", l_B, l_C);
+        }
+    }
+
+    TOMBOY_DestroyEngine(l_Ticked);
+    TOMBOY_DestroyEngine(l_Scheduled);
+    return l_Passed;
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_EngineEventLockstep (void)
+{
+    if (TEST_WriteLockstepProgram() == false)
+    {
+        return false;
+    }
+
+    TOMBOY_Program* l_Program = TOMBOY_CreateProgram(TEST_LOCKSTEP_FILENAME);
+    remove(TEST_LOCKSTEP_FILENAME);
+    TEST_expect(l_Program != NULL, "Could not load the lockstep test's program.");
+
+    // The engine which updates its components on every tick is the reference for the one which
+    // schedules their events.
+    bool l_Passed = TEST_RunLockstep(l_Program);
+    TOMBOY_DestroyProgram(l_Program);
+    return l_Passed;
+}
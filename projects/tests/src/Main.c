@@ -0,0 +1,58 @@
+/**
+ * @file  Main.c
+ */
+
+#include <Tests.h>
+
+// Test Case Structure /////////////////////////////////////////////////////////////////////////////
+
+typedef struct TEST_Case
+{
+    const char* m_Name;             ///< @brief The name of the test case.
+    bool        (*m_Run) (void);    ///< @brief The function which runs the test case.
+} TEST_Case;
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+static const TEST_Case s_Cases[] = {
+    { "CPU Cycle Timing", TEST_CPUCycleTiming },
+    { "CPU JIT Differential", TEST_CPUJITDifferential },
+    { "Engine Event Lockstep", TEST_EngineEventLockstep },
+    { "PPU Dirty Scanlines", TEST_PPUDirtyScanlines },
+    { "PPU Frame Handoff", TEST_PPUFrameHandoff },
+    { "PPU Frame Skip", TEST_PPUFrameSkip },
+    { "PPU Kernels", TEST_PPUKernels },
+    { "PPU Pixel Formats", TEST_PPUPixelFormats },
+    { "PPU Render Mode Lockstep", TEST_PPURenderModeLockstep },
+};
+
+// Main Function ///////////////////////////////////////////////////////////////////////////////////
+
+int main (int argc, const char** argv)
+{
+    // If test case names are given, then run only those test cases. Otherwise, run them all.
+    size_t l_Count = sizeof(s_Cases) / sizeof(s_Cases[0]);
+    size_t l_Failed = 0;
+    size_t l_Run = 0;
+    for (size_t i = 0; i < l_Count; ++i)
+    {
+        bool l_Selected = (argc <= 1);
+        for (int j = 1; j < argc && l_Selected == false; ++j)
+        {
+            l_Selected = (strcmp(argv[j], s_Cases[i].m_Name) == 0);
+        }
+
+        if (l_Selected == false)
+        {
+            continue;
+        }
+
+        bool l_Passed = s_Cases[i].m_Run();
+        printf("[%s] %s\n", (l_Passed == true) ? "PASS" : "FAIL", s_Cases[i].m_Name);
+        l_Failed += (l_Passed == false);
+        l_Run++;
+    }
+
+    printf("%zu of %zu test case(s) passed.\n", l_Run - l_Failed, l_Run);
+    return (l_Failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
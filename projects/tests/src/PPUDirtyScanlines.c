@@ -0,0 +1,159 @@
+/**
+ * @file  PPUDirtyScanlines.c
+ */
+
+#include <Tests.h>
+#include <TOMBOY/Engine.h>
+#include <TOMBOY/PPU.h>
+#include <TOMBOY/Program.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_DIRTY_FILENAME         "tests-dirty-scanlines.tomboy"  ///< @brief The file the dirty scanline test's program is written to, and removed afterwards.
+#define TEST_DIRTY_PROGRAM_SIZE     0x3100      ///< @brief The size of the dirty scanline test's program.
+#define TEST_DIRTY_FRAME_CYCLES     (TOMBOY_PPU_DOTS_PER_FRAME * 2) ///< @brief More than enough cycles for a frame to be rendered.
+#define TEST_DIRTY_TILE_MAP_ROW     5           ///< @brief The tilemap row of the only tile which is not blank.
+#define TEST_DIRTY_TILE_MAP_COLUMN  3           ///< @brief The tilemap column of the only tile which is not blank.
+#define TEST_DIRTY_TILE_ROW         2           ///< @brief The row of that tile which the test changes.
+#define TEST_DIRTY_LINE             (TEST_DIRTY_TILE_MAP_ROW * 8 + TEST_DIRTY_TILE_ROW) ///< @brief The only scanline the change shows on.
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// The main routine does nothing but spin, leaving the display as the test sets it up.
+static const uint8_t s_MainRoutine[] = {
+                                        // LOOP:
+    0x00, 0x22, 0xFC, 0xFF,             //     JPB NC, LOOP
+};
+
+// Static Variables ////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t s_Frames = 0;                                       ///< @brief The number of frames rendered.
+static uint64_t s_DirtyLines[TOMBOY_PPU_DIRTY_LINE_WORDS] = { 0 };  ///< @brief The scanlines which changed in the last frame rendered.
+
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static void TEST_OnFrameRendered (TOMBOY_PPU* p_PPU)
+{
+    // The dirty scanlines are those which changed since the last call to this callback, so they
+    // must be taken from within it.
+    memcpy(s_DirtyLines, TOMBOY_GetDirtyScanlines(p_PPU), sizeof(s_DirtyLines));
+    s_Frames++;
+}
+
+static bool TEST_WriteDirtyProgram (void)
+{
+    // The program's header needs only its identifier: the rest of it may be left zeroed.
+    uint8_t* l_Data = TM_calloc(TEST_DIRTY_PROGRAM_SIZE, uint8_t);
+    TEST_expect(l_Data != NULL, "Could not allocate the dirty scanline test's program.");
+    memcpy(l_Data, "TMBY", 4);
+    memcpy(&l_Data[TM_CODE_BEGIN], s_MainRoutine, sizeof(s_MainRoutine));
+
+    FILE* l_File = fopen(TEST_DIRTY_FILENAME, "wb");
+    bool l_Written = (l_File != NULL) &&
+        (fwrite(l_Data, 1, TEST_DIRTY_PROGRAM_SIZE, l_File) == TEST_DIRTY_PROGRAM_SIZE);
+    if (l_File != NULL)
+    {
+        l_Written = (fclose(l_File) == 0) && l_Written;
+    }
+
+    TM_free(l_Data);
+    TEST_expect(l_Written == true, "Could not write the dirty scanline test's program to '%s'.",
+        TEST_DIRTY_FILENAME);
+    return true;
+}
+
+static bool TEST_RunFrame (TOMBOY_Engine* p_Engine)
+{
+    // Run the engine an instruction at a time until it renders a frame, which leaves the PPU at the
+    // start of vertical blank, where the test's writes cannot land part-way through a scanline.
+    uint32_t l_Frames = s_Frames;
+    uint64_t l_Limit = TOMBOY_GetCycleCount(p_Engine) + TEST_DIRTY_FRAME_CYCLES;
+    while (s_Frames == l_Frames && TOMBOY_GetCycleCount(p_Engine) < l_Limit)
+    {
+        TOMBOY_RunEngine(p_Engine, 1);
+    }
+
+    TEST_expect(s_Frames != l_Frames, "The dirty scanline test's engine did not render a frame.");
+    return true;
+}
+
+static bool TEST_CheckDirtyLines (const char* p_Mode, const char* p_Frame, int16_t p_Expected)
+{
+    for (uint8_t l_Line = 0; l_Line < TOMBOY_PPU_SCREEN_HEIGHT; ++l_Line)
+    {
+        bool l_Dirty = (s_DirtyLines[l_Line / 64] >> (l_Line % 64)) & 1;
+        TEST_expect(l_Dirty == (l_Line == p_Expected),
+            "In the %s render mode, scanline %u is %s after %s.", p_Mode, l_Line,
+            l_Dirty ? "dirty" : "clean", p_Frame);
+    }
+
+    return true;
+}
+
+static bool TEST_RunDirtyScanlines (const TOMBOY_Program* p_Program, TOMBOY_RenderMode p_Mode,
+    const char* p_ModeName)
+{
+    TOMBOY_Engine* l_Engine = TOMBOY_CreateEngine(p_Program);
+    TEST_expect(l_Engine != NULL, "Could not create the dirty scanline test's engine.");
+    TOMBOY_PPU* l_PPU = TOMBOY_GetPPU(l_Engine);
+    TOMBOY_SetRenderMode(l_PPU, p_Mode);
+    TOMBOY_SetCallbacks(l_Engine, TEST_OnFrameRendered, NULL);
+
+    // The background is blank but for one tile, solid in color 3, so that each of its rows shows on
+    // exactly one scanline.
+    TOMBOY_WriteVRAMByte(l_PPU, TOMBOY_SCRN0_START + TEST_DIRTY_TILE_MAP_ROW * 32 +
+        TEST_DIRTY_TILE_MAP_COLUMN, 0x01);
+    for (uint32_t i = 0; i < 16; ++i)
+    {
+        TOMBOY_WriteVRAMByte(l_PPU, TOMBOY_TDATA0_START + 16 + i, 0xFF);
+    }
+
+    // The first frame changes the screen buffer from its cleared state, but the frames after it draw
+    // the same pixels again, so they leave no scanline dirty.
+    bool l_Passed = TEST_RunFrame(l_Engine) && TEST_RunFrame(l_Engine) &&
+        TEST_CheckDirtyLines(p_ModeName, "a static frame", -1) &&
+        TEST_RunFrame(l_Engine) &&
+        TEST_CheckDirtyLines(p_ModeName, "a second static frame", -1);
+
+    // Changing a single row of the tile marks only the scanline it shows on, and only for the frame
+    // which first draws it.
+    if (l_Passed == true)
+    {
+        TOMBOY_WriteVRAMByte(l_PPU, TOMBOY_TDATA0_START + 16 + TEST_DIRTY_TILE_ROW * 2, 0x00);
+        l_Passed = TEST_RunFrame(l_Engine) &&
+            TEST_CheckDirtyLines(p_ModeName, "a change to one tile row", TEST_DIRTY_LINE) &&
+            TEST_RunFrame(l_Engine) &&
+            TEST_CheckDirtyLines(p_ModeName, "the frame after that change", -1);
+    }
+
+    // Writing a byte with the value it already holds changes no pixels, so marks no scanlines.
+    if (l_Passed == true)
+    {
+        TOMBOY_WriteVRAMByte(l_PPU, TOMBOY_TDATA0_START + 16, 0xFF);
+        l_Passed = TEST_RunFrame(l_Engine) &&
+            TEST_CheckDirtyLines(p_ModeName, "a write which changes nothing", -1);
+    }
+
+    TOMBOY_DestroyEngine(l_Engine);
+    return l_Passed;
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_PPUDirtyScanlines (void)
+{
+    if (TEST_WriteDirtyProgram() == false)
+    {
+        return false;
+    }
+
+    TOMBOY_Program* l_Program = TOMBOY_CreateProgram(TEST_DIRTY_FILENAME);
+    remove(TEST_DIRTY_FILENAME);
+    TEST_expect(l_Program != NULL, "Could not load the dirty scanline test's program.");
+
+    // Both render modes draw the scanlines by their own paths, so each must mark them alike.
+    bool l_Passed = TEST_RunDirtyScanlines(l_Program, TOMBOY_RM_ACCURATE, "accurate") &&
+        TEST_RunDirtyScanlines(l_Program, TOMBOY_RM_FAST, "fast");
+    TOMBOY_DestroyProgram(l_Program);
+    return l_Passed;
+}
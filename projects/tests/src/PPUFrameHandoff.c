@@ -0,0 +1,216 @@
+/**
+ * @file  PPUFrameHandoff.c
+ */
+
+#include <Tests.h>
+#include <TOMBOY/Engine.h>
+#include <TOMBOY/PPU.h>
+#include <TOMBOY/Program.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_HANDOFF_FILENAME       "tests-frame-handoff.tomboy"    ///< @brief The file the frame handoff test's program is written to, and removed afterwards.
+#define TEST_HANDOFF_PROGRAM_SIZE   0x3100      ///< @brief The size of the frame handoff test's program.
+#define TEST_HANDOFF_FRAMES         8           ///< @brief The number of frames the test keeps a copy of.
+#define TEST_HANDOFF_FRAME_CYCLES   (TOMBOY_PPU_DOTS_PER_FRAME * 2) ///< @brief More than enough cycles for a frame to be rendered.
+#define TEST_HANDOFF_SEED           0x48414E44  ///< @brief The random number generator's starting state.
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// The main routine does nothing but spin, leaving the display as the test sets it up.
+static const uint8_t s_MainRoutine[] = {
+                                        // LOOP:
+    0x00, 0x22, 0xFC, 0xFF,             //     JPB NC, LOOP
+};
+
+// Static Variables ////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t s_Frames = 0;           ///< @brief The number of frames rendered.
+static uint8_t* s_FrameCopies = NULL;   ///< @brief A copy of each frame rendered, taken from within the frame rendered callback.
+
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static uint32_t TEST_NextRandom (uint32_t* p_State)
+{
+    *p_State ^= *p_State << 13;
+    *p_State ^= *p_State >> 17;
+    *p_State ^= *p_State << 5;
+    return *p_State;
+}
+
+static void TEST_OnFrameRendered (TOMBOY_PPU* p_PPU)
+{
+    // The screen buffer the PPU draws into next starts out as the frame just handed off.
+    if (s_Frames < TEST_HANDOFF_FRAMES)
+    {
+        memcpy(&s_FrameCopies[s_Frames * TOMBOY_PPU_SCREEN_BUFFER_SIZE],
+            TOMBOY_GetScreenBuffer(p_PPU), TOMBOY_PPU_SCREEN_BUFFER_SIZE);
+    }
+
+    s_Frames++;
+}
+
+static const uint8_t* TEST_GetFrameCopy (uint32_t p_Frame)
+{
+    return &s_FrameCopies[p_Frame * TOMBOY_PPU_SCREEN_BUFFER_SIZE];
+}
+
+static bool TEST_WriteHandoffProgram (void)
+{
+    // The program's header needs only its identifier: the rest of it may be left zeroed.
+    uint8_t* l_Data = TM_calloc(TEST_HANDOFF_PROGRAM_SIZE, uint8_t);
+    TEST_expect(l_Data != NULL, "Could not allocate the frame handoff test's program.");
+    memcpy(l_Data, "TMBY", 4);
+    memcpy(&l_Data[TM_CODE_BEGIN], s_MainRoutine, sizeof(s_MainRoutine));
+
+    FILE* l_File = fopen(TEST_HANDOFF_FILENAME, "wb");
+    bool l_Written = (l_File != NULL) &&
+        (fwrite(l_Data, 1, TEST_HANDOFF_PROGRAM_SIZE, l_File) == TEST_HANDOFF_PROGRAM_SIZE);
+    if (l_File != NULL)
+    {
+        l_Written = (fclose(l_File) == 0) && l_Written;
+    }
+
+    TM_free(l_Data);
+    TEST_expect(l_Written == true, "Could not write the frame handoff test's program to '%s'.",
+        TEST_HANDOFF_FILENAME);
+    return true;
+}
+
+static bool TEST_RunFrame (TOMBOY_Engine* p_Engine, bool p_Scroll, const uint8_t* p_Held,
+    uint32_t p_HeldFrame)
+{
+    // Scroll the background to give the next frame different pixels from the last, unless the
+    // frame is meant to change nothing.
+    TM_CPU* l_CPU = TOMBOY_GetCPU(p_Engine);
+    if (p_Scroll == true)
+    {
+        TM_WriteByte(l_CPU, TOMBOY_HP_SCX, TM_ReadByte(l_CPU, TOMBOY_HP_SCX) + 8);
+    }
+
+    // Run the engine an instruction at a time until it renders a frame, which leaves the PPU at the
+    // start of vertical blank. While it runs, check on every scanline that the frame the test holds
+    // is left alone.
+    uint32_t l_Frames = s_Frames;
+    uint64_t l_Limit = TOMBOY_GetCycleCount(p_Engine) + TEST_HANDOFF_FRAME_CYCLES;
+    uint8_t l_LastLY = TM_ReadByte(l_CPU, TOMBOY_HP_LY);
+    while (s_Frames == l_Frames && TOMBOY_GetCycleCount(p_Engine) < l_Limit)
+    {
+        TOMBOY_RunEngine(p_Engine, 1);
+
+        uint8_t l_LY = TM_ReadByte(l_CPU, TOMBOY_HP_LY);
+        if (p_Held != NULL && l_LY != l_LastLY)
+        {
+            TEST_expect(memcmp(p_Held, TEST_GetFrameCopy(p_HeldFrame),
+                TOMBOY_PPU_SCREEN_BUFFER_SIZE) == 0,
+                "Frame %u was overwritten while acquired, on scanline %u of frame %u.",
+                p_HeldFrame, l_LY, s_Frames);
+        }
+
+        l_LastLY = l_LY;
+    }
+
+    TEST_expect(s_Frames != l_Frames, "The frame handoff test's engine did not render a frame.");
+    return true;
+}
+
+static bool TEST_CheckAcquire (TOMBOY_PPU* p_PPU, bool p_ExpectNew, uint32_t p_ExpectedFrame,
+    const uint8_t** p_Acquired)
+{
+    bool l_IsNew = !p_ExpectNew;
+    const uint8_t* l_Frame = TOMBOY_AcquireFrame(p_PPU, &l_IsNew);
+    TEST_expect(l_IsNew == p_ExpectNew, "After frame %u, acquiring a frame reported it as %s.",
+        s_Frames - 1, l_IsNew ? "new" : "stale");
+    TEST_expect(p_ExpectNew == true || l_Frame == *p_Acquired,
+        "After frame %u, acquiring a stale frame gave a different buffer.", s_Frames - 1);
+    TEST_expect(memcmp(l_Frame, TEST_GetFrameCopy(p_ExpectedFrame),
+        TOMBOY_PPU_SCREEN_BUFFER_SIZE) == 0,
+        "After frame %u, the frame acquired does not hold frame %u.", s_Frames - 1,
+        p_ExpectedFrame);
+
+    *p_Acquired = l_Frame;
+    return true;
+}
+
+static bool TEST_RunHandoff (TOMBOY_Engine* p_Engine)
+{
+    // Fill the tile data and tilemap with noise, so that each scroll of the background draws a
+    // frame unlike any before it.
+    TOMBOY_PPU* l_PPU = TOMBOY_GetPPU(p_Engine);
+    uint32_t l_State = TEST_HANDOFF_SEED;
+    for (uint32_t l_Address = TOMBOY_VRAM_START; l_Address <= TOMBOY_VRAM_END; ++l_Address)
+    {
+        TOMBOY_WriteVRAMByte(l_PPU, l_Address, (uint8_t) TEST_NextRandom(&l_State));
+    }
+
+    TOMBOY_SetFrameHandoff(l_PPU, true);
+    TOMBOY_SetCallbacks(p_Engine, TEST_OnFrameRendered, NULL);
+
+    // The first frame is new when acquired. Acquiring again, before another frame is handed off,
+    // gives the same buffer, still holding that frame.
+    const uint8_t* l_Acquired = NULL;
+    bool l_Passed = TEST_RunFrame(p_Engine, true, NULL, 0) &&
+        TEST_CheckAcquire(l_PPU, true, 0, &l_Acquired) &&
+        TEST_CheckAcquire(l_PPU, false, 0, &l_Acquired);
+
+    // Of two frames handed off between acquires, only the newer is picked up. Frame 0 stays in the
+    // reader's buffer throughout.
+    l_Passed = l_Passed &&
+        TEST_RunFrame(p_Engine, true, l_Acquired, 0) &&
+        TEST_RunFrame(p_Engine, true, l_Acquired, 0) &&
+        TEST_CheckAcquire(l_PPU, true, 2, &l_Acquired) &&
+        TEST_CheckAcquire(l_PPU, false, 2, &l_Acquired);
+    if (l_Passed == true && memcmp(TEST_GetFrameCopy(1), TEST_GetFrameCopy(2),
+        TOMBOY_PPU_SCREEN_BUFFER_SIZE) == 0)
+    {
+        TM_error("Frames 1 and 2 match, so the frame acquired cannot be told apart.");
+        l_Passed = false;
+    }
+
+    // While the reader holds frame 2, the PPU cycles the other two buffers through several frames
+    // without touching it, and the newest of those is picked up next.
+    for (uint32_t i = 3; i < TEST_HANDOFF_FRAMES - 1 && l_Passed == true; ++i)
+    {
+        l_Passed = TEST_RunFrame(p_Engine, true, l_Acquired, 2);
+    }
+
+    l_Passed = l_Passed && TEST_CheckAcquire(l_PPU, true, TEST_HANDOFF_FRAMES - 2, &l_Acquired);
+
+    // A frame which changes nothing is not handed off, so the last one acquired is still the latest.
+    return l_Passed &&
+        TEST_RunFrame(p_Engine, false, l_Acquired, TEST_HANDOFF_FRAMES - 2) &&
+        TEST_CheckAcquire(l_PPU, false, TEST_HANDOFF_FRAMES - 1, &l_Acquired);
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_PPUFrameHandoff (void)
+{
+    if (TEST_WriteHandoffProgram() == false)
+    {
+        return false;
+    }
+
+    TOMBOY_Program* l_Program = TOMBOY_CreateProgram(TEST_HANDOFF_FILENAME);
+    remove(TEST_HANDOFF_FILENAME);
+    TEST_expect(l_Program != NULL, "Could not load the frame handoff test's program.");
+
+    TOMBOY_Engine* l_Engine = TOMBOY_CreateEngine(l_Program);
+    s_FrameCopies = TM_calloc(TEST_HANDOFF_FRAMES * TOMBOY_PPU_SCREEN_BUFFER_SIZE, uint8_t);
+    s_Frames = 0;
+    bool l_Passed = (l_Engine != NULL && s_FrameCopies != NULL);
+    if (l_Passed == false)
+    {
+        TM_error("Could not create the frame handoff test's engine.");
+    }
+    else
+    {
+        l_Passed = TEST_RunHandoff(l_Engine);
+    }
+
+    TM_free(s_FrameCopies);
+    s_FrameCopies = NULL;
+    TOMBOY_DestroyEngine(l_Engine);
+    TOMBOY_DestroyProgram(l_Program);
+    return l_Passed;
+}
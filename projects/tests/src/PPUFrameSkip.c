@@ -0,0 +1,282 @@
+/**
+ * @file  PPUFrameSkip.c
+ */
+
+#include <Tests.h>
+#include <TOMBOY/Engine.h>
+#include <TOMBOY/PPU.h>
+#include <TOMBOY/Program.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_FRAME_SKIP_FILENAME        "tests-frame-skip.tomboy"   ///< @brief The file the frame skip test's program is written to, and removed afterwards.
+#define TEST_FRAME_SKIP_PROGRAM_SIZE    0x3100      ///< @brief The size of the frame skip test's program.
+#define TEST_FRAME_SKIP_FRAMES          12          ///< @brief The number of frames to run the program for.
+#define TEST_FRAME_SKIP_INTERVAL        3           ///< @brief The skipping engine draws only every this many frames.
+#define TEST_FRAME_SKIP_SEED            0x534B4950  ///< @brief The random number generator's starting state.
+
+// Port Shorthands /////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_rSTAT      (TOMBOY_HP_STAT & 0xFF)
+#define TEST_rSCX       (TOMBOY_HP_SCX & 0xFF)
+#define TEST_rLYC       (TOMBOY_HP_LYC & 0xFF)
+#define TEST_rIE        (TOMBOY_HP_IE & 0xFF)
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// The vertical blank handler counts frames in `CL`, and moves `SCX` and `LYC` by uneven steps, so
+// that the length of each pixel transfer, and the scanline the `LY` compare source fires on, change
+// from frame to frame.
+static const uint8_t s_VerticalBlankHandler[] = {
+    0xB0, 0x30,                         // INC CL
+    0x30, 0x15, TEST_rSCX,              // LDH AL, [rSCX]
+    0x30, 0x34, 5,                      // ADD AL, 5
+    0x03, 0x1B, TEST_rSCX,              // STH [rSCX], AL
+    0x30, 0x15, TEST_rLYC,              // LDH AL, [rLYC]
+    0x30, 0x34, 37,                     // ADD AL, 37
+    0x03, 0x1B, TEST_rLYC,              // STH [rLYC], AL
+    0x00, 0x26,                         // RETI
+};
+
+// The `STAT` handler counts its interrupts in `BH`.
+static const uint8_t s_LCDStatusHandler[] = {
+    0x60, 0x30,                         // INC BH
+    0x00, 0x26,                         // RETI
+};
+
+// The main routine enables the vertical blank and `STAT` interrupts, with the latter's horizontal
+// blank, object scan and `LY` compare sources, then reads `STAT` and halts until each interrupt in
+// turn.
+static const uint8_t s_MainRoutine[] = {
+    0x30, 0x10, 0x03,                   // LD AL, $03
+    0x03, 0x1B, TEST_rIE,               // STH [rIE], AL
+    0x30, 0x10, 0x68,                   // LD AL, $68
+    0x03, 0x1B, TEST_rSTAT,             // STH [rSTAT], AL
+    0x00, 0x06,                         // EI
+                                        // LOOP:
+    0x30, 0x15, TEST_rSTAT,             //     LDH AL, [rSTAT]
+    0x00, 0x02,                         //     HALT
+    0x00, 0x22, 0xF7, 0xFF,             //     JPB NC, LOOP
+};
+
+// Static Variables ////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t s_DrawnFrames = 0;      ///< @brief The number of frames the drawing engine has finished.
+static uint32_t s_SkippingFrames = 0;   ///< @brief The number of frames the skipping engine has finished.
+
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static uint32_t TEST_NextRandom (uint32_t* p_State)
+{
+    *p_State ^= *p_State << 13;
+    *p_State ^= *p_State >> 17;
+    *p_State ^= *p_State << 5;
+    return *p_State;
+}
+
+static void TEST_OnFrameDrawn (TOMBOY_PPU* p_PPU)
+{
+    (void) p_PPU;
+    s_DrawnFrames++;
+}
+
+static void TEST_OnFrameSkipped (TOMBOY_PPU* p_PPU)
+{
+    // Draw only every Nth frame, as a frontend which cannot keep up would.
+    s_SkippingFrames++;
+    TOMBOY_SetFrameSkip(p_PPU, (s_SkippingFrames % TEST_FRAME_SKIP_INTERVAL) != 0);
+}
+
+static bool TEST_WriteFrameSkipProgram (void)
+{
+    // The program's header needs only its identifier: the rest of it may be left zeroed.
+    uint8_t* l_Data = TM_calloc(TEST_FRAME_SKIP_PROGRAM_SIZE, uint8_t);
+    TEST_expect(l_Data != NULL, "Could not allocate the frame skip test's program.");
+    memcpy(l_Data, "TMBY", 4);
+    memcpy(&l_Data[TM_INT_BEGIN + 0x100 * TOMBOY_IT_VBLANK], s_VerticalBlankHandler,
+        sizeof(s_VerticalBlankHandler));
+    memcpy(&l_Data[TM_INT_BEGIN + 0x100 * TOMBOY_IT_LCDSTAT], s_LCDStatusHandler,
+        sizeof(s_LCDStatusHandler));
+    memcpy(&l_Data[TM_CODE_BEGIN], s_MainRoutine, sizeof(s_MainRoutine));
+
+    FILE* l_File = fopen(TEST_FRAME_SKIP_FILENAME, "wb");
+    bool l_Written = (l_File != NULL) &&
+        (fwrite(l_Data, 1, TEST_FRAME_SKIP_PROGRAM_SIZE, l_File) == TEST_FRAME_SKIP_PROGRAM_SIZE);
+    if (l_File != NULL)
+    {
+        l_Written = (fclose(l_File) == 0) && l_Written;
+    }
+
+    TM_free(l_Data);
+    TEST_expect(l_Written == true, "Could not write the frame skip test's program to '%s'.",
+        TEST_FRAME_SKIP_FILENAME);
+    return true;
+}
+
+static void TEST_SetUpScene (TOMBOY_Engine* p_Engine)
+{
+    // Fill the tile data and tilemaps with noise, and turn on the objects over them, so that each
+    // drawn frame differs from the last as the background scrolls.
+    TOMBOY_PPU* l_PPU = TOMBOY_GetPPU(p_Engine);
+    uint32_t l_State = TEST_FRAME_SKIP_SEED;
+    for (uint32_t l_Address = TOMBOY_VRAM_START; l_Address <= TOMBOY_VRAM_END; ++l_Address)
+    {
+        TOMBOY_WriteVRAMByte(l_PPU, l_Address, (uint8_t) TEST_NextRandom(&l_State));
+    }
+
+    for (uint32_t l_Address = TOMBOY_OAM_START; l_Address < TOMBOY_OAM_START + 160; ++l_Address)
+    {
+        TOMBOY_WriteOAMByte(l_PPU, l_Address, (uint8_t) TEST_NextRandom(&l_State));
+    }
+
+    TM_WriteByte(TOMBOY_GetCPU(p_Engine), TOMBOY_HP_LCDC, 0x93);
+}
+
+static bool TEST_CompareEngines (TOMBOY_Engine* p_Drawing, TOMBOY_Engine* p_Skipping)
+{
+    TM_CPU* l_Drawing = TOMBOY_GetCPU(p_Drawing);
+    TM_CPU* l_Skipping = TOMBOY_GetCPU(p_Skipping);
+    uint64_t l_Cycle = TOMBOY_GetCycleCount(p_Drawing);
+
+    TEST_expect(TOMBOY_GetCycleCount(p_Skipping) == l_Cycle,
+        "The engines' cycle counts differ (%llu drawing, %llu skipping).",
+        (unsigned long long) l_Cycle, (unsigned long long) TOMBOY_GetCycleCount(p_Skipping));
+
+    // The ports are read through the bus, which brings each engine's components up to date first.
+    static const struct { const char* m_Name; uint32_t m_Address; } s_Ports[] = {
+        { "LY",     TOMBOY_HP_LY },
+        { "STAT",   TOMBOY_HP_STAT },
+        { "IF",     TOMBOY_HP_IF },
+    };
+    for (size_t i = 0; i < sizeof(s_Ports) / sizeof(s_Ports[0]); ++i)
+    {
+        uint8_t l_Expected = TM_ReadByte(l_Drawing, s_Ports[i].m_Address);
+        uint8_t l_Actual = TM_ReadByte(l_Skipping, s_Ports[i].m_Address);
+        TEST_expect(l_Actual == l_Expected,
+            "Cycle %llu: %s is 0x%02X with frame skipping; expected 0x%02X.",
+            (unsigned long long) l_Cycle, s_Ports[i].m_Name, l_Actual, l_Expected);
+    }
+
+    TEST_expect(TM_GetInterruptFlags(l_Skipping) == TM_GetInterruptFlags(l_Drawing),
+        "Cycle %llu: the interrupt flags differ (0x%02X drawing, 0x%02X skipping).",
+        (unsigned long long) l_Cycle, TM_GetInterruptFlags(l_Drawing),
+        TM_GetInterruptFlags(l_Skipping));
+    TEST_expect(TM_GetProgramCounter(l_Skipping) == TM_GetProgramCounter(l_Drawing),
+        "Cycle %llu: the program counters differ (0x%08X drawing, 0x%08X skipping).",
+        (unsigned long long) l_Cycle, TM_GetProgramCounter(l_Drawing),
+        TM_GetProgramCounter(l_Skipping));
+    TEST_expect(s_SkippingFrames == s_DrawnFrames,
+        "Cycle %llu: the engines have called back for %u drawn and %u skipped frames.",
+        (unsigned long long) l_Cycle, s_DrawnFrames, s_SkippingFrames);
+
+    return true;
+}
+
+static bool TEST_CompareFrames (TOMBOY_Engine* p_Drawing, TOMBOY_Engine* p_Skipping,
+    uint8_t* p_LastDrawn, uint32_t p_Frame)
+{
+    const TOMBOY_PPU* l_Drawing = TOMBOY_GetPPU(p_Drawing);
+    const TOMBOY_PPU* l_Skipping = TOMBOY_GetPPU(p_Skipping);
+    const uint8_t* l_Expected = TOMBOY_GetScreenBuffer(l_Drawing);
+    const uint8_t* l_Actual = TOMBOY_GetScreenBuffer(l_Skipping);
+    bool l_Skipped = TOMBOY_IsFrameSkipped(l_Skipping);
+
+    // A drawn frame matches the other engine's, and a skipped one leaves the last drawn frame in
+    // the screen buffer.
+    TEST_expect(l_Skipped == ((p_Frame % TEST_FRAME_SKIP_INTERVAL) != 0),
+        "Frame %u was %s, but should have been %s.", p_Frame, l_Skipped ? "skipped" : "drawn",
+        l_Skipped ? "drawn" : "skipped");
+    if (l_Skipped == false)
+    {
+        TEST_expect(memcmp(l_Actual, l_Expected, TOMBOY_PPU_SCREEN_BUFFER_SIZE) == 0,
+            "Frame %u was drawn differently by the skipping engine.", p_Frame);
+        memcpy(p_LastDrawn, l_Actual, TOMBOY_PPU_SCREEN_BUFFER_SIZE);
+    }
+    else
+    {
+        TEST_expect(memcmp(l_Actual, p_LastDrawn, TOMBOY_PPU_SCREEN_BUFFER_SIZE) == 0,
+            "Frame %u was skipped, but the screen buffer changed.", p_Frame);
+        TEST_expect(memcmp(l_Expected, p_LastDrawn, TOMBOY_PPU_SCREEN_BUFFER_SIZE) != 0,
+            "Frame %u matches the last drawn frame, so its skip went unchecked.", p_Frame);
+    }
+
+    return true;
+}
+
+static bool TEST_RunFrameSkip (const TOMBOY_Program* p_Program)
+{
+    TOMBOY_Engine* l_Drawing = TOMBOY_CreateEngine(p_Program);
+    TOMBOY_Engine* l_Skipping = TOMBOY_CreateEngine(p_Program);
+    uint8_t* l_LastDrawn = TM_calloc(TOMBOY_PPU_SCREEN_BUFFER_SIZE, uint8_t);
+    bool l_Passed = (l_Drawing != NULL && l_Skipping != NULL && l_LastDrawn != NULL);
+    if (l_Passed == false)
+    {
+        TM_error("Could not create the frame skip test's engines.");
+    }
+    else
+    {
+        s_DrawnFrames = 0;
+        s_SkippingFrames = 0;
+        TOMBOY_SetCallbacks(l_Drawing, TEST_OnFrameDrawn, NULL);
+        TOMBOY_SetCallbacks(l_Skipping, TEST_OnFrameSkipped, NULL);
+        TEST_SetUpScene(l_Drawing);
+        TEST_SetUpScene(l_Skipping);
+    }
+
+    // Step both engines in lockstep, and check the frames they drew each time they enter vertical
+    // blank.
+    uint32_t l_Frame = 0;
+    uint8_t l_LastLY = 0;
+    while (l_Passed == true && l_Frame < TEST_FRAME_SKIP_FRAMES)
+    {
+        TOMBOY_RunEngine(l_Drawing, 1);
+        TOMBOY_RunEngine(l_Skipping, 1);
+        l_Passed = TEST_CompareEngines(l_Drawing, l_Skipping);
+
+        uint8_t l_LY = TM_ReadByte(TOMBOY_GetCPU(l_Drawing), TOMBOY_HP_LY);
+        if (l_Passed == true && l_LY == TOMBOY_PPU_SCREEN_HEIGHT && l_LastLY != l_LY)
+        {
+            l_Passed = TEST_CompareFrames(l_Drawing, l_Skipping, l_LastDrawn, l_Frame++);
+        }
+
+        l_LastLY = l_LY;
+    }
+
+    // Make sure the program did what it was meant to: take each of its interrupts.
+    if (l_Passed == true)
+    {
+        uint32_t l_B = TM_GetRegister(TOMBOY_GetCPU(l_Skipping), TM_REG_B);
+        uint32_t l_C = TM_GetRegister(TOMBOY_GetCPU(l_Skipping), TM_REG_C);
+        l_Passed = ((l_B & 0xFF00) != 0 && (l_C & 0xFF) != 0);
+        if (l_Passed == false)
+        {
+            TM_error("The frame skip test's program did not take all of its interrupts "
+                "(B = 0x%08X, C = 0x%08X).", l_B, l_C);
+        }
+    }
+
+    TM_free(l_LastDrawn);
+    TOMBOY_DestroyEngine(l_Skipping);
+    TOMBOY_DestroyEngine(l_Drawing);
+    return l_Passed;
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_PPUFrameSkip (void)
+{
+    if (TEST_WriteFrameSkipProgram() == false)
+    {
+        return false;
+    }
+
+    TOMBOY_Program* l_Program = TOMBOY_CreateProgram(TEST_FRAME_SKIP_FILENAME);
+    remove(TEST_FRAME_SKIP_FILENAME);
+    TEST_expect(l_Program != NULL, "Could not load the frame skip test's program.");
+
+    // The engine which draws every frame is the reference for the one which skips all but every
+    // Nth of them.
+    bool l_Passed = TEST_RunFrameSkip(l_Program);
+    TOMBOY_DestroyProgram(l_Program);
+    return l_Passed;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file  PPUKernels.c
+ */
+
+#include <Tests.h>
+#include <TOMBOY/PPU.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_KERNEL_ROUNDS      20000       ///< @brief The number of random inputs each kernel is given.
+#define TEST_KERNEL_SEED        0x50505500  ///< @brief The random number generator's starting state.
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+static const char* s_KernelSetNames[TOMBOY_PKS_COUNT] = {
+    [TOMBOY_PKS_SCALAR] = "scalar",
+    [TOMBOY_PKS_SSE2]   = "SSE2",
+    [TOMBOY_PKS_BMI2]   = "BMI2",
+    [TOMBOY_PKS_AVX2]   = "AVX2",
+};
+
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static uint32_t TEST_NextRandom (uint32_t* p_State)
+{
+    // A 32-bit xorshift generator, which is plenty for picking test inputs.
+    *p_State ^= *p_State << 13;
+    *p_State ^= *p_State >> 17;
+    *p_State ^= *p_State << 5;
+    return *p_State;
+}
+
+static bool TEST_CheckDecodeTile (TOMBOY_PPUKernelSet p_Set, uint32_t* p_State, bool* p_Ran)
+{
+    for (uint32_t i = 0; i < TEST_KERNEL_ROUNDS; ++i)
+    {
+        uint8_t l_Data[16];
+        for (uint8_t j = 0; j < sizeof(l_Data); ++j)
+        {
+            l_Data[j] = (uint8_t) TEST_NextRandom(p_State);
+        }
+
+        // Fill both tiles with different garbage first, so that a kernel which misses a byte is
+        // caught.
+        TOMBOY_DecodedTile l_Expected, l_Actual;
+        memset(&l_Expected, 0xAA, sizeof(l_Expected));
+        memset(&l_Actual, 0x55, sizeof(l_Actual));
+        TOMBOY_DecodeTileWithKernel(TOMBOY_PKS_SCALAR, l_Data, &l_Expected);
+        if (TOMBOY_DecodeTileWithKernel(p_Set, l_Data, &l_Actual) == false)
+        {
+            return true;
+        }
+
+        *p_Ran = true;
+        TEST_expect(memcmp(&l_Expected, &l_Actual, sizeof(l_Expected)) == 0,
+            "The %s tile decoding kernel disagrees with the scalar one on round %u.",
+            s_KernelSetNames[p_Set], i);
+    }
+
+    return true;
+}
+
+static bool TEST_CheckLookupColors (TOMBOY_PPUKernelSet p_Set, uint32_t* p_State, bool* p_Ran)
+{
+    for (uint32_t i = 0; i < TEST_KERNEL_ROUNDS; ++i)
+    {
+        uint8_t l_Row[8];
+        uint32_t l_Palette[4];
+        for (uint8_t j = 0; j < 8; ++j)
+        {
+            l_Row[j] = TEST_NextRandom(p_State) & 0b11;
+        }
+
+        for (uint8_t j = 0; j < 4; ++j)
+        {
+            l_Palette[j] = TEST_NextRandom(p_State);
+        }
+
+        uint32_t l_Expected[8], l_Actual[8];
+        memset(l_Expected, 0xAA, sizeof(l_Expected));
+        memset(l_Actual, 0x55, sizeof(l_Actual));
+        TOMBOY_LookupColorsWithKernel(TOMBOY_PKS_SCALAR, l_Row, l_Palette, l_Expected);
+        if (TOMBOY_LookupColorsWithKernel(p_Set, l_Row, l_Palette, l_Actual) == false)
+        {
+            return true;
+        }
+
+        *p_Ran = true;
+        TEST_expect(memcmp(l_Expected, l_Actual, sizeof(l_Expected)) == 0,
+            "The %s color lookup kernel disagrees with the scalar one on round %u.",
+            s_KernelSetNames[p_Set], i);
+    }
+
+    return true;
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_PPUKernels (void)
+{
+    // Every kernel the host supports must give the same output as the scalar kernel, byte for byte.
+    uint32_t l_State = TEST_KERNEL_SEED;
+    bool l_Passed = true;
+    for (uint8_t i = TOMBOY_PKS_SCALAR + 1; i < TOMBOY_PKS_COUNT; ++i)
+    {
+        bool l_Ran = false;
+        l_Passed = TEST_CheckDecodeTile(i, &l_State, &l_Ran) && l_Passed;
+        l_Passed = TEST_CheckLookupColors(i, &l_State, &l_Ran) && l_Passed;
+        if (l_Ran == false)
+        {
+            TM_info("The %s kernels are not supported here; skipping them.", s_KernelSetNames[i]);
+        }
+    }
+
+    return l_Passed;
+}
@@ -0,0 +1,221 @@
+/**
+ * @file  PPUPixelFormats.c
+ */
+
+#include <Tests.h>
+#include <TOMBOY/Engine.h>
+#include <TOMBOY/PPU.h>
+#include <TOMBOY/Program.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_FORMAT_FILENAME        "tests-pixel-formats.tomboy"    ///< @brief The file the pixel format test's program is written to, and removed afterwards.
+#define TEST_FORMAT_PROGRAM_SIZE    0x3100      ///< @brief The size of the pixel format test's program.
+#define TEST_FORMAT_FRAME_CYCLES    (TOMBOY_PPU_DOTS_PER_FRAME * 2) ///< @brief More than enough cycles for a frame to be rendered.
+#define TEST_FORMAT_COUNT           (TOMBOY_PF_INDEXED8 + 1)        ///< @brief The number of pixel formats.
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// The main routine does nothing but spin, leaving the display as the test sets it up.
+static const uint8_t s_MainRoutine[] = {
+                                        // LOOP:
+    0x00, 0x22, 0xFC, 0xFF,             //     JPB NC, LOOP
+};
+
+// The colors of the first background palette, as the red, green and blue channels of RGB555. Each
+// channel is scaled up to 8 bits by multiplying it by 8.
+static const uint8_t s_PaletteRGB555[4][3] = {
+    { 31,  0,  0 },
+    {  0, 21,  0 },
+    {  0,  0, 17 },
+    {  4, 12, 31 },
+};
+
+// The value each of those colors should be drawn as, in each pixel format. These are integers of
+// the pixel's width, and so are laid out in the screen buffer in the host's byte order.
+static const uint32_t s_ExpectedPixels[TEST_FORMAT_COUNT][4] = {
+    [TOMBOY_PF_RGBA8888] = { 0xF80000FF, 0x00A800FF, 0x000088FF, 0x2060F8FF },
+    [TOMBOY_PF_ARGB8888] = { 0xFFF80000, 0xFF00A800, 0xFF000088, 0xFF2060F8 },
+    [TOMBOY_PF_BGRA8888] = { 0x0000F8FF, 0x00A800FF, 0x880000FF, 0xF86020FF },
+    [TOMBOY_PF_RGB565]   = { 0xF800, 0x0540, 0x0011, 0x231F },
+    [TOMBOY_PF_INDEXED8] = { 0, 1, 2, 3 },
+};
+
+static const struct { const char* m_Name; size_t m_PixelSize; } s_Formats[TEST_FORMAT_COUNT] = {
+    [TOMBOY_PF_RGBA8888] = { "RGBA8888", 4 },
+    [TOMBOY_PF_ARGB8888] = { "ARGB8888", 4 },
+    [TOMBOY_PF_BGRA8888] = { "BGRA8888", 4 },
+    [TOMBOY_PF_RGB565]   = { "RGB565", 2 },
+    [TOMBOY_PF_INDEXED8] = { "INDEXED8", 1 },
+};
+
+// Static Variables ////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t s_Frames = 0;           ///< @brief The number of frames rendered.
+
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static void TEST_OnFrameRendered (TOMBOY_PPU* p_PPU)
+{
+    (void) p_PPU;
+    s_Frames++;
+}
+
+static bool TEST_WriteFormatProgram (void)
+{
+    // The program's header needs only its identifier: the rest of it may be left zeroed.
+    uint8_t* l_Data = TM_calloc(TEST_FORMAT_PROGRAM_SIZE, uint8_t);
+    TEST_expect(l_Data != NULL, "Could not allocate the pixel format test's program.");
+    memcpy(l_Data, "TMBY", 4);
+    memcpy(&l_Data[TM_CODE_BEGIN], s_MainRoutine, sizeof(s_MainRoutine));
+
+    FILE* l_File = fopen(TEST_FORMAT_FILENAME, "wb");
+    bool l_Written = (l_File != NULL) &&
+        (fwrite(l_Data, 1, TEST_FORMAT_PROGRAM_SIZE, l_File) == TEST_FORMAT_PROGRAM_SIZE);
+    if (l_File != NULL)
+    {
+        l_Written = (fclose(l_File) == 0) && l_Written;
+    }
+
+    TM_free(l_Data);
+    TEST_expect(l_Written == true, "Could not write the pixel format test's program to '%s'.",
+        TEST_FORMAT_FILENAME);
+    return true;
+}
+
+static bool TEST_RunFrame (TOMBOY_Engine* p_Engine)
+{
+    // Run the engine an instruction at a time until it renders a frame, which leaves the PPU at the
+    // start of vertical blank, where the pixel format can be changed between two whole frames.
+    uint32_t l_Frames = s_Frames;
+    uint64_t l_Limit = TOMBOY_GetCycleCount(p_Engine) + TEST_FORMAT_FRAME_CYCLES;
+    while (s_Frames == l_Frames && TOMBOY_GetCycleCount(p_Engine) < l_Limit)
+    {
+        TOMBOY_RunEngine(p_Engine, 1);
+    }
+
+    TEST_expect(s_Frames != l_Frames, "The pixel format test's engine did not render a frame.");
+    return true;
+}
+
+static void TEST_SetUpScene (TOMBOY_Engine* p_Engine)
+{
+    // Switch the PPU to CGB graphics mode, which it allows only while the display is off, so that
+    // the background is colored from CRAM.
+    TM_CPU* l_CPU = TOMBOY_GetCPU(p_Engine);
+    TOMBOY_PPU* l_PPU = TOMBOY_GetPPU(p_Engine);
+    TM_WriteByte(l_CPU, TOMBOY_HP_LCDC, 0x11);
+    TM_WriteByte(l_CPU, TOMBOY_HP_GRPM, 0x01);
+    TM_WriteByte(l_CPU, TOMBOY_HP_LCDC, 0x91);
+
+    // Store the known palette in the first background palette, as `0bRRRRRGGG` `0bGGBBBBB0`.
+    for (uint8_t i = 0; i < 4; ++i)
+    {
+        uint8_t l_Red = s_PaletteRGB555[i][0];
+        uint8_t l_Green = s_PaletteRGB555[i][1];
+        uint8_t l_Blue = s_PaletteRGB555[i][2];
+        TOMBOY_WriteCRAMByte(l_PPU, TOMBOY_CRAM_START + i * 2, (l_Red << 3) | (l_Green >> 2));
+        TOMBOY_WriteCRAMByte(l_PPU, TOMBOY_CRAM_START + i * 2 + 1,
+            ((l_Green & 0b11) << 6) | (l_Blue << 1));
+    }
+
+    // The whole background is tile 0, each of whose rows runs through color indices 0, 1, 2 and 3
+    // twice over.
+    for (uint8_t i = 0; i < 16; i += 2)
+    {
+        TOMBOY_WriteVRAMByte(l_PPU, TOMBOY_TDATA0_START + i, 0b01010101);
+        TOMBOY_WriteVRAMByte(l_PPU, TOMBOY_TDATA0_START + i + 1, 0b00110011);
+    }
+}
+
+static bool TEST_CheckFormat (TOMBOY_Engine* p_Engine, TOMBOY_PixelFormat p_Format)
+{
+    // Change the format between frames, and let the next frame draw every scanline in it.
+    TOMBOY_PPU* l_PPU = TOMBOY_GetPPU(p_Engine);
+    TOMBOY_SetPixelFormat(l_PPU, p_Format);
+    if (TEST_RunFrame(p_Engine) == false)
+    {
+        return false;
+    }
+
+    const char* l_Name = s_Formats[p_Format].m_Name;
+    size_t l_Size = s_Formats[p_Format].m_PixelSize;
+    TEST_expect(TOMBOY_GetPixelFormat(l_PPU) == p_Format, "The PPU did not take up the %s format.",
+        l_Name);
+    TEST_expect(TOMBOY_GetScreenPitch(l_PPU) == TOMBOY_PPU_SCREEN_WIDTH * l_Size,
+        "The %s format's pitch is %zu bytes; expected %zu.", l_Name, TOMBOY_GetScreenPitch(l_PPU),
+        TOMBOY_PPU_SCREEN_WIDTH * l_Size);
+
+    // Build the scanline every scanline should match, at the format's width, and compare each one,
+    // so that a wrong pitch shows up as well as a wrong pixel.
+    uint8_t l_Expected[TOMBOY_PPU_SCREEN_WIDTH * sizeof(uint32_t)];
+    for (uint8_t x = 0; x < TOMBOY_PPU_SCREEN_WIDTH; ++x)
+    {
+        uint32_t l_Pixel32 = s_ExpectedPixels[p_Format][x % 4];
+        uint16_t l_Pixel16 = (uint16_t) l_Pixel32;
+        uint8_t l_Pixel8 = (uint8_t) l_Pixel32;
+        memcpy(&l_Expected[x * l_Size], (l_Size == 4) ? (const void*) &l_Pixel32 :
+            (l_Size == 2) ? (const void*) &l_Pixel16 : (const void*) &l_Pixel8, l_Size);
+    }
+
+    const uint8_t* l_Screen = TOMBOY_GetScreenBuffer(l_PPU);
+    for (uint8_t l_Line = 0; l_Line < TOMBOY_PPU_SCREEN_HEIGHT; ++l_Line)
+    {
+        TEST_expect(memcmp(&l_Screen[l_Line * TOMBOY_PPU_SCREEN_WIDTH * l_Size], l_Expected,
+            TOMBOY_PPU_SCREEN_WIDTH * l_Size) == 0,
+            "Scanline %u was not drawn as expected in the %s format.", l_Line, l_Name);
+    }
+
+    // The indexed format's palette gives the RGBA8888 colors its indices stand for.
+    if (p_Format == TOMBOY_PF_INDEXED8)
+    {
+        uint32_t l_Colors[TOMBOY_PPU_INDEXED_COLOR_COUNT];
+        TOMBOY_GetIndexedPalette(l_PPU, l_Colors);
+        for (uint8_t i = 0; i < 4; ++i)
+        {
+            TEST_expect(l_Colors[i] == s_ExpectedPixels[TOMBOY_PF_RGBA8888][i],
+                "Index %u of the indexed palette is 0x%08X; expected 0x%08X.", i, l_Colors[i],
+                s_ExpectedPixels[TOMBOY_PF_RGBA8888][i]);
+        }
+    }
+
+    return true;
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_PPUPixelFormats (void)
+{
+    if (TEST_WriteFormatProgram() == false)
+    {
+        return false;
+    }
+
+    TOMBOY_Program* l_Program = TOMBOY_CreateProgram(TEST_FORMAT_FILENAME);
+    remove(TEST_FORMAT_FILENAME);
+    TEST_expect(l_Program != NULL, "Could not load the pixel format test's program.");
+
+    TOMBOY_Engine* l_Engine = TOMBOY_CreateEngine(l_Program);
+    bool l_Passed = (l_Engine != NULL);
+    if (l_Passed == false)
+    {
+        TM_error("Could not create the pixel format test's engine.");
+    }
+    else
+    {
+        s_Frames = 0;
+        TOMBOY_SetCallbacks(l_Engine, TEST_OnFrameRendered, NULL);
+        TEST_SetUpScene(l_Engine);
+        l_Passed = TEST_RunFrame(l_Engine);
+    }
+
+    // Go through every format, then back to the first, which must come back as it was.
+    for (uint32_t i = 0; i <= TEST_FORMAT_COUNT && l_Passed == true; ++i)
+    {
+        l_Passed = TEST_CheckFormat(l_Engine, (TOMBOY_PixelFormat) (i % TEST_FORMAT_COUNT));
+    }
+
+    TOMBOY_DestroyEngine(l_Engine);
+    TOMBOY_DestroyProgram(l_Program);
+    return l_Passed;
+}
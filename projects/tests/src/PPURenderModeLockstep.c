@@ -0,0 +1,278 @@
+/**
+ * @file  PPURenderModeLockstep.c
+ */
+
+#include <Tests.h>
+#include <TOMBOY/Engine.h>
+#include <TOMBOY/PPU.h>
+#include <TOMBOY/Program.h>
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_RENDER_MODE_FILENAME       "tests-render-mode.tomboy"  ///< @brief The file the render mode test's program is written to, and removed afterwards.
+#define TEST_RENDER_MODE_PROGRAM_SIZE   0x3100      ///< @brief The size of the render mode test's program.
+#define TEST_RENDER_MODE_FRAMES         12          ///< @brief The number of frames to run the program for.
+#define TEST_RENDER_MODE_SEED           0x46415354  ///< @brief The random number generator's starting state.
+
+// Port Shorthands /////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_rLCDC      (TOMBOY_HP_LCDC & 0xFF)
+#define TEST_rSTAT      (TOMBOY_HP_STAT & 0xFF)
+#define TEST_rSCY       (TOMBOY_HP_SCY & 0xFF)
+#define TEST_rSCX       (TOMBOY_HP_SCX & 0xFF)
+#define TEST_rWY        (TOMBOY_HP_WY & 0xFF)
+#define TEST_rWX        (TOMBOY_HP_WX & 0xFF)
+#define TEST_rIE        (TOMBOY_HP_IE & 0xFF)
+
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+// The vertical blank handler counts frames in `CL`, moves the background and window by uneven
+// steps, so that `SCX`'s fine scroll and the window's column both change from frame to frame, and
+// switches between 8x8 and 8x16 objects every 4 frames. It writes only while the PPU is in vertical
+// blank, where both render modes see the same registers.
+static const uint8_t s_VerticalBlankHandler[] = {
+    0xB0, 0x30,                         // INC CL
+    0x30, 0x15, TEST_rSCX,              // LDH AL, [rSCX]
+    0x30, 0x34, 13,                     // ADD AL, 13
+    0x03, 0x1B, TEST_rSCX,              // STH [rSCX], AL
+    0x30, 0x15, TEST_rSCY,              // LDH AL, [rSCY]
+    0x30, 0x34, 7,                      // ADD AL, 7
+    0x03, 0x1B, TEST_rSCY,              // STH [rSCY], AL
+    0x30, 0x15, TEST_rWX,               // LDH AL, [rWX]
+    0x30, 0x34, 29,                     // ADD AL, 29
+    0x03, 0x1B, TEST_rWX,               // STH [rWX], AL
+    0x30, 0x15, TEST_rWY,               // LDH AL, [rWY]
+    0x30, 0x34, 11,                     // ADD AL, 11
+    0x03, 0x1B, TEST_rWY,               // STH [rWY], AL
+    0x3B, 0x1D,                         // MV AL, CL
+    0x30, 0x40, 0x04,                   // AND AL, $04
+    0x30, 0x43, 0xF3,                   // OR AL, $F3
+    0x03, 0x1B, TEST_rLCDC,             // STH [rLCDC], AL
+    0x00, 0x26,                         // RETI
+};
+
+// The `STAT` handler counts its interrupts in `BH`. Its horizontal blank source fires as each
+// scanline's pixel transfer ends, so its timing follows the length of that transfer.
+static const uint8_t s_LCDStatusHandler[] = {
+    0x60, 0x30,                         // INC BH
+    0x00, 0x26,                         // RETI
+};
+
+// The main routine enables the vertical blank and `STAT` interrupts, with the latter's horizontal
+// blank and `LY` compare sources, then halts until each interrupt in turn.
+static const uint8_t s_MainRoutine[] = {
+    0x30, 0x10, 0x03,                   // LD AL, $03
+    0x03, 0x1B, TEST_rIE,               // STH [rIE], AL
+    0x30, 0x10, 0x48,                   // LD AL, $48
+    0x03, 0x1B, TEST_rSTAT,             // STH [rSTAT], AL
+    0x00, 0x06,                         // EI
+                                        // LOOP:
+    0x00, 0x02,                         //     HALT
+    0x00, 0x22, 0xFA, 0xFF,             //     JPB NC, LOOP
+};
+
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static uint32_t TEST_NextRandom (uint32_t* p_State)
+{
+    *p_State ^= *p_State << 13;
+    *p_State ^= *p_State >> 17;
+    *p_State ^= *p_State << 5;
+    return *p_State;
+}
+
+static bool TEST_WriteRenderModeProgram (void)
+{
+    // The program's header needs only its identifier: the rest of it may be left zeroed.
+    uint8_t* l_Data = TM_calloc(TEST_RENDER_MODE_PROGRAM_SIZE, uint8_t);
+    TEST_expect(l_Data != NULL, "Could not allocate the render mode test's program.");
+    memcpy(l_Data, "TMBY", 4);
+    memcpy(&l_Data[TM_INT_BEGIN + 0x100 * TOMBOY_IT_VBLANK], s_VerticalBlankHandler,
+        sizeof(s_VerticalBlankHandler));
+    memcpy(&l_Data[TM_INT_BEGIN + 0x100 * TOMBOY_IT_LCDSTAT], s_LCDStatusHandler,
+        sizeof(s_LCDStatusHandler));
+    memcpy(&l_Data[TM_CODE_BEGIN], s_MainRoutine, sizeof(s_MainRoutine));
+
+    FILE* l_File = fopen(TEST_RENDER_MODE_FILENAME, "wb");
+    bool l_Written = (l_File != NULL) &&
+        (fwrite(l_Data, 1, TEST_RENDER_MODE_PROGRAM_SIZE, l_File) == TEST_RENDER_MODE_PROGRAM_SIZE);
+    if (l_File != NULL)
+    {
+        l_Written = (fclose(l_File) == 0) && l_Written;
+    }
+
+    TM_free(l_Data);
+    TEST_expect(l_Written == true, "Could not write the render mode test's program to '%s'.",
+        TEST_RENDER_MODE_FILENAME);
+    return true;
+}
+
+static void TEST_SetUpScene (TOMBOY_Engine* p_Engine)
+{
+    // Fill the tile data and both tilemaps with noise, and scatter the objects over the screen and
+    // just off its edges, with random tiles, palettes, flips and priorities. The same seed gives
+    // both engines the same scene.
+    TOMBOY_PPU* l_PPU = TOMBOY_GetPPU(p_Engine);
+    uint32_t l_State = TEST_RENDER_MODE_SEED;
+    for (uint32_t l_Address = TOMBOY_VRAM_START; l_Address <= TOMBOY_VRAM_END; ++l_Address)
+    {
+        TOMBOY_WriteVRAMByte(l_PPU, l_Address, (uint8_t) TEST_NextRandom(&l_State));
+    }
+
+    for (uint32_t l_Address = TOMBOY_OAM_START; l_Address < TOMBOY_OAM_START + 160; l_Address += 4)
+    {
+        TOMBOY_WriteOAMByte(l_PPU, l_Address + 0, (uint8_t) (TEST_NextRandom(&l_State) % 176));
+        TOMBOY_WriteOAMByte(l_PPU, l_Address + 1, (uint8_t) (TEST_NextRandom(&l_State) % 176));
+        TOMBOY_WriteOAMByte(l_PPU, l_Address + 2, (uint8_t) TEST_NextRandom(&l_State));
+        TOMBOY_WriteOAMByte(l_PPU, l_Address + 3, (uint8_t) TEST_NextRandom(&l_State));
+    }
+
+    // Turn on the background, the window and the objects, with the window on the second tilemap
+    // and a fine scroll on the background.
+    TM_CPU* l_CPU = TOMBOY_GetCPU(p_Engine);
+    TM_WriteByte(l_CPU, TOMBOY_HP_SCX, 0x05);
+    TM_WriteByte(l_CPU, TOMBOY_HP_SCY, 0x03);
+    TM_WriteByte(l_CPU, TOMBOY_HP_WX, 0x30);
+    TM_WriteByte(l_CPU, TOMBOY_HP_WY, 0x28);
+    TM_WriteByte(l_CPU, TOMBOY_HP_LCDC, 0xF3);
+}
+
+static bool TEST_CompareEngines (TOMBOY_Engine* p_Accurate, TOMBOY_Engine* p_Fast)
+{
+    TM_CPU* l_Accurate = TOMBOY_GetCPU(p_Accurate);
+    TM_CPU* l_Fast = TOMBOY_GetCPU(p_Fast);
+    uint64_t l_Cycle = TOMBOY_GetCycleCount(p_Accurate);
+
+    TEST_expect(TOMBOY_GetCycleCount(p_Fast) == l_Cycle,
+        "The engines' cycle counts differ (%llu accurate, %llu fast).",
+        (unsigned long long) l_Cycle, (unsigned long long) TOMBOY_GetCycleCount(p_Fast));
+
+    static const struct { const char* m_Name; uint32_t m_Address; } s_Ports[] = {
+        { "LY",     TOMBOY_HP_LY },
+        { "STAT",   TOMBOY_HP_STAT },
+        { "IF",     TOMBOY_HP_IF },
+    };
+    for (size_t i = 0; i < sizeof(s_Ports) / sizeof(s_Ports[0]); ++i)
+    {
+        uint8_t l_Expected = TM_ReadByte(l_Accurate, s_Ports[i].m_Address);
+        uint8_t l_Actual = TM_ReadByte(l_Fast, s_Ports[i].m_Address);
+        TEST_expect(l_Actual == l_Expected,
+            "Cycle %llu: %s is 0x%02X in the fast render mode; expected 0x%02X.",
+            (unsigned long long) l_Cycle, s_Ports[i].m_Name, l_Actual, l_Expected);
+    }
+
+    TEST_expect(TM_GetInterruptFlags(l_Fast) == TM_GetInterruptFlags(l_Accurate),
+        "Cycle %llu: the interrupt flags differ (0x%02X accurate, 0x%02X fast).",
+        (unsigned long long) l_Cycle, TM_GetInterruptFlags(l_Accurate),
+        TM_GetInterruptFlags(l_Fast));
+    TEST_expect(TM_GetProgramCounter(l_Fast) == TM_GetProgramCounter(l_Accurate),
+        "Cycle %llu: the program counters differ (0x%08X accurate, 0x%08X fast).",
+        (unsigned long long) l_Cycle, TM_GetProgramCounter(l_Accurate),
+        TM_GetProgramCounter(l_Fast));
+
+    return true;
+}
+
+static bool TEST_CompareFrames (TOMBOY_Engine* p_Accurate, TOMBOY_Engine* p_Fast, uint32_t p_Frame)
+{
+    const TOMBOY_PPU* l_Accurate = TOMBOY_GetPPU(p_Accurate);
+    const TOMBOY_PPU* l_Fast = TOMBOY_GetPPU(p_Fast);
+    const uint8_t* l_Expected = TOMBOY_GetScreenBuffer(l_Accurate);
+    const uint8_t* l_Actual = TOMBOY_GetScreenBuffer(l_Fast);
+    size_t l_Pitch = TOMBOY_GetScreenPitch(l_Accurate);
+
+    for (uint8_t l_Line = 0; l_Line < TOMBOY_PPU_SCREEN_HEIGHT; ++l_Line)
+    {
+        TEST_expect(memcmp(&l_Expected[l_Line * l_Pitch], &l_Actual[l_Line * l_Pitch],
+            l_Pitch) == 0, "Frame %u: scanline %u differs between the render modes.", p_Frame,
+            l_Line);
+    }
+
+    // Make sure the frame shows the scene, rather than a blank screen which would match anyway.
+    bool l_Varied = false;
+    for (size_t i = 1; i < l_Pitch * TOMBOY_PPU_SCREEN_HEIGHT && l_Varied == false; ++i)
+    {
+        l_Varied = (l_Expected[i] != l_Expected[0]);
+    }
+
+    TEST_expect(l_Varied == true, "Frame %u: the render mode test's frame is blank.", p_Frame);
+    return true;
+}
+
+static bool TEST_RunRenderModes (const TOMBOY_Program* p_Program)
+{
+    TOMBOY_Engine* l_Accurate = TOMBOY_CreateEngine(p_Program);
+    TOMBOY_Engine* l_Fast = TOMBOY_CreateEngine(p_Program);
+    bool l_Passed = (l_Accurate != NULL && l_Fast != NULL);
+    if (l_Passed == false)
+    {
+        TM_error("Could not create the render mode test's engines.");
+    }
+    else
+    {
+        // Both engines tick their components on every cycle, so that they can be compared after
+        // each instruction, and after each cycle spent halted.
+        TOMBOY_SetEventScheduling(l_Accurate, false);
+        TOMBOY_SetEventScheduling(l_Fast, false);
+        TOMBOY_SetRenderMode(TOMBOY_GetPPU(l_Accurate), TOMBOY_RM_ACCURATE);
+        TOMBOY_SetRenderMode(TOMBOY_GetPPU(l_Fast), TOMBOY_RM_FAST);
+        TEST_SetUpScene(l_Accurate);
+        TEST_SetUpScene(l_Fast);
+    }
+
+    // Step both engines in lockstep, and compare the frames they drew each time they enter vertical
+    // blank.
+    uint32_t l_Frame = 0;
+    uint8_t l_LastLY = TOMBOY_ReadLY(TOMBOY_GetPPU(l_Accurate));
+    while (l_Passed == true && l_Frame < TEST_RENDER_MODE_FRAMES)
+    {
+        TOMBOY_RunEngine(l_Accurate, 1);
+        TOMBOY_RunEngine(l_Fast, 1);
+        l_Passed = TEST_CompareEngines(l_Accurate, l_Fast);
+
+        uint8_t l_LY = TOMBOY_ReadLY(TOMBOY_GetPPU(l_Accurate));
+        if (l_Passed == true && l_LY == TOMBOY_PPU_SCREEN_HEIGHT && l_LastLY != l_LY)
+        {
+            l_Passed = TEST_CompareFrames(l_Accurate, l_Fast, l_Frame++);
+        }
+
+        l_LastLY = l_LY;
+    }
+
+    // Make sure the program did what it was meant to: take each of its interrupts.
+    if (l_Passed == true)
+    {
+        uint32_t l_B = TM_GetRegister(TOMBOY_GetCPU(l_Accurate), TM_REG_B);
+        uint32_t l_C = TM_GetRegister(TOMBOY_GetCPU(l_Accurate), TM_REG_C);
+        l_Passed = ((l_B & 0xFF00) != 0 && (l_C & 0xFF) != 0);
+        if (l_Passed == false)
+        {
+            TM_error("The render mode test's program did not take all of its interrupts "
+                "(B = 0x%08X, C = 0x%08X).", l_B, l_C);
+        }
+    }
+
+    TOMBOY_DestroyEngine(l_Fast);
+    TOMBOY_DestroyEngine(l_Accurate);
+    return l_Passed;
+}
+
+// Test Cases //////////////////////////////////////////////////////////////////////////////////////
+
+bool TEST_PPURenderModeLockstep (void)
+{
+    if (TEST_WriteRenderModeProgram() == false)
+    {
+        return false;
+    }
+
+    TOMBOY_Program* l_Program = TOMBOY_CreateProgram(TEST_RENDER_MODE_FILENAME);
+    remove(TEST_RENDER_MODE_FILENAME);
+    TEST_expect(l_Program != NULL, "Could not load the render mode test's program.");
+
+    // The engine which draws each scanline a dot at a time is the reference for the one which
+    // draws it in one pass.
+    bool l_Passed = TEST_RunRenderModes(l_Program);
+    TOMBOY_DestroyProgram(l_Program);
+    return l_Passed;
+}
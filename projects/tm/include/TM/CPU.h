@@ -15,36 +15,77 @@ typedef struct TM_CPU TM_CPU;
 
 /**
  * @brief   Pointer to a function called by the CPU's functions to read a byte from the bus.
+ * @param   p_Context The opaque context pointer supplied when the CPU was created.
  * @param   p_Address The 32-bit address to read from.
  * @return  The byte read from the bus.
  */
-typedef uint8_t (*TM_BusRead) (uint32_t);
+typedef uint8_t (*TM_BusRead) (void*, uint32_t);
 
 /**
  * @brief   Pointer to a function called by the CPU's functions to write a byte to the bus.
+ * @param   p_Context The opaque context pointer supplied when the CPU was created.
  * @param   p_Address The 32-bit address to write to.
  * @param   p_Data    The byte to write to the bus.
  */
-typedef void (*TM_BusWrite) (uint32_t, uint8_t);
+typedef void (*TM_BusWrite) (void*, uint32_t, uint8_t);
+
+/**
+ * @brief   Pointer to a function called by the CPU before a multi-byte bus access, to ask the owner
+ *          of its bus for direct access to the memory behind it.
+ * 
+ * If every byte of the access lies within a single run of plain memory - memory which has no side
+ * effects when accessed and is not subject to any access rules - the function may return a pointer
+ * to the first byte, and the CPU reads or writes the bytes, in little-endian order, through it.
+ * Otherwise, it should return `NULL`, and the CPU accesses each byte through the bus's read or
+ * write function, as usual.
+ * 
+ * @param   p_Context The opaque context pointer supplied when the CPU was created.
+ * @param   p_Address The 32-bit address of the first byte of the access.
+ * @param   p_Size    The number of bytes accessed: `2` or `4`.
+ * @param   p_Write   `true` if the bytes are to be written; `false` if they are only to be read.
+ * @return  A pointer to the first byte of the access, or `NULL`.
+ */
+typedef uint8_t* (*TM_BusPointer) (void*, uint32_t, uint32_t, bool);
 
 /**
  * @brief   Pointer to a function called by the CPU whenever a CPU cycle is completed. This function
  *          is to tick the other hardware components attached to the CPU's bus.
+ * @param   p_Context The opaque context pointer supplied when the CPU was created.
  * @param   p_Cycles  The number of cycles to tick the other components.
  * @return  `true` if all of the components were ticked successfully; `false` otherwise.
  */
-typedef bool (*TM_Cycle) (uint32_t);
+typedef bool (*TM_Cycle) (void*, uint32_t);
+
+/**
+ * @brief   Pointer to a function called by the CPU while it is halted, to ask the owner of its bus
+ *          how many cycles remain until the next event which could request an interrupt.
+ * 
+ * The halted CPU passes this many cycles to its cycle function in one call, rather than one cycle
+ * at a time, so the count returned must never be later than the event itself. Returning `0` or `1`
+ * makes the CPU wait one cycle at a time, as it does when no such function is set.
+ * 
+ * @param   p_Context The opaque context pointer supplied when the CPU was created.
+ * @return  The number of cycles until the next event which could request an interrupt.
+ */
+typedef uint32_t (*TM_NextEvent) (void*);
 
 // Public Function Prototypes //////////////////////////////////////////////////////////////////////
 
 /**
  * @brief   Creates a new instance of the TM virtual CPU.
+ * 
+ * The given context pointer is passed, unmodified, as the first argument to each of the bus and
+ * cycle functions. It is typically a pointer to the structure which owns the CPU's bus, allowing
+ * several CPU instances, each attached to its own bus, to run within the same process.
+ * 
  * @param   p_BusRead  The function to read from the bus.
  * @param   p_BusWrite The function to write to the bus.
  * @param   p_Cycle    The function to call when a CPU cycle is completed.
+ * @param   p_Context  An opaque pointer to pass to the above functions. May be `NULL`.
  * @return  A pointer to the new TM CPU instance.
  */
-TM_CPU* TM_CreateCPU (TM_BusRead p_BusRead, TM_BusWrite p_BusWrite, TM_Cycle p_Cycle);
+TM_CPU* TM_CreateCPU (TM_BusRead p_BusRead, TM_BusWrite p_BusWrite, TM_Cycle p_Cycle,
+    void* p_Context);
 
 /**
  * @brief   Resets the TM CPU instance, setting its registers and state to their initial values.
@@ -68,21 +109,133 @@ void TM_DestroyCPU (TM_CPU* p_CPU);
  * 
  * CPU cycles due to bus access only occur when the CPU internally accesses the bus.
  * 
+ * If cycle batching is enabled (see `TM_SetCycleBatching`), the cycles are not passed to the CPU's
+ * cycle function right away; they are added to a pending count instead, which is flushed by
+ * `TM_FlushCPUCycles`.
+ * 
  * @param   p_CPU     The TM CPU instance to cycle.
  * @param   p_Cycles  The number of cycles to cycle the CPU.
  */
 void TM_CycleCPU (TM_CPU* p_CPU, uint32_t p_Cycles);
 
+/**
+ * @brief   Passes any cycles accumulated by the CPU while cycle batching is enabled to its cycle
+ *          function in a single call, bringing the other components on its bus up to date.
+ * 
+ * The CPU calls this function itself at the end of every instruction, while halted, and before any
+ * bus access outside of the program ROM, so that the other components are never observed out of
+ * date by the program. It only needs to be called by the bus's owner if it needs the components to
+ * be up to date at some other time.
+ * 
+ * @param   p_CPU     The TM CPU instance whose pending cycles are to be flushed.
+ */
+void TM_FlushCPUCycles (TM_CPU* p_CPU);
+
+/**
+ * @brief   Enables or disables cycle batching on the given TM CPU instance.
+ * 
+ * With cycle batching disabled (the default), every call to `TM_CycleCPU` calls the CPU's cycle
+ * function right away. With cycle batching enabled, cycles are accumulated and passed to the cycle
+ * function in one call by `TM_FlushCPUCycles`, greatly reducing the number of calls made to the
+ * cycle function per instruction. The total number of cycles passed is the same in both modes.
+ * 
+ * Disabling cycle batching flushes any cycles which are still pending.
+ * 
+ * @param   p_CPU     The TM CPU instance to configure.
+ * @param   p_Enabled `true` to enable cycle batching; `false` to disable it.
+ */
+void TM_SetCycleBatching (TM_CPU* p_CPU, bool p_Enabled);
+
+/**
+ * @brief   Sets the function the given TM CPU instance calls to access multi-byte values in plain
+ *          memory directly, rather than one byte at a time through its bus functions.
+ * 
+ * Without such a function (the default), `TM_ReadWord`, `TM_ReadDoubleWord`, `TM_WriteWord` and
+ * `TM_WriteDoubleWord` always make one call to the bus's read or write function per byte.
+ * 
+ * @param   p_CPU        The TM CPU instance to configure.
+ * @param   p_BusPointer The function to call, or `NULL` to always access the bus a byte at a time.
+ */
+void TM_SetBusPointerFunction (TM_CPU* p_CPU, TM_BusPointer p_BusPointer);
+
+/**
+ * @brief   Sets the function the given TM CPU instance calls while halted, to find out how many
+ *          cycles it may skip ahead by before an interrupt could be requested.
+ * 
+ * Without such a function (the default), a halted CPU waits for an interrupt one cycle at a time.
+ * The skip never runs past the end of the cycle budget given to `TM_RunCPU`. JIT-compiled code also
+ * uses the function, to find out how long it may hold its cycles back (see `TM_SetJITCompilation`).
+ * 
+ * @param   p_CPU       The TM CPU instance to configure.
+ * @param   p_NextEvent The function to call, or `NULL` to wait one cycle at a time.
+ */
+void TM_SetNextEventFunction (TM_CPU* p_CPU, TM_NextEvent p_NextEvent);
+
+/**
+ * @brief   Enables or disables JIT compilation on the given TM CPU instance.
+ * 
+ * With JIT compilation enabled, basic blocks in the program ROM which are executed often are
+ * translated into native code. Register moves, register and immediate arithmetic and logic, and
+ * jumps run as native instructions on the general-purpose registers held in host registers, with
+ * their flags computed only if they are read; every other instruction runs through the interpreter.
+ * Code in XRAM, which may be overwritten, is always interpreted.
+ * 
+ * If a next event function has been set (see `TM_SetNextEventFunction`) and cycle batching is
+ * enabled, then compiled code only passes its cycles on, and checks for interrupts, once enough
+ * cycles have passed that an interrupt could have been requested. Either way, the CPU's state, and
+ * the cycles passed to the bus, are the same as the interpreter's at every instruction boundary at
+ * which the CPU returns.
+ * 
+ * JIT compilation is disabled by default, and is only available on x86-64 platforms which use the
+ * System V calling convention.
+ * 
+ * @param   p_CPU     The TM CPU instance to configure.
+ * @param   p_Enabled `true` to enable JIT compilation; `false` to disable it.
+ * @return  `true` if the setting was applied; `false` if JIT compilation is not supported on this
+ *          platform, or its memory could not be allocated.
+ */
+bool TM_SetJITCompilation (TM_CPU* p_CPU, bool p_Enabled);
+
 /**
  * @brief   Steps the CPU, either executing the next instruction or waiting for an interrupt to be
  *          requested if the CPU is halted.
  * 
+ * While halted, each step waits one cycle, or, if a next event function has been set (see
+ * `TM_SetNextEventFunction`), up until the next event which could request an interrupt.
+ * 
  * @param   p_CPU     The TM CPU instance to step.
  * 
  * @return  `true` if the CPU was stepped successfully; `false` if the CPU has been or is stopped.
  */
 bool TM_StepCPU (TM_CPU* p_CPU);
 
+/**
+ * @brief   Runs the CPU until a budget of cycles has been spent, the CPU is stopped, or a break is
+ *          requested with `TM_BreakCPU`.
+ * 
+ * This is equivalent to calling `TM_StepCPU` repeatedly, but without the overhead of a call per
+ * instruction. The budget is checked between instructions, so the CPU may overrun it by up to one
+ * instruction's worth of cycles.
+ * 
+ * @param   p_CPU           The TM CPU instance to run.
+ * @param   p_CycleBudget   The number of cycles to run the CPU for.
+ * @param   p_Cycles        If not `NULL`, receives the number of cycles the CPU completed.
+ * @param   p_Instructions  If not `NULL`, receives the number of instructions the CPU retired.
+ * 
+ * @return  `true` if the CPU ran successfully; `false` if the CPU has been or is stopped.
+ */
+bool TM_RunCPU (TM_CPU* p_CPU, uint64_t p_CycleBudget, uint64_t* p_Cycles, uint64_t* p_Instructions);
+
+/**
+ * @brief   Requests that a call to `TM_RunCPU` return after the current instruction.
+ * 
+ * This is intended to be called from the CPU's bus or cycle functions, for instance when a frame
+ * has finished rendering.
+ * 
+ * @param   p_CPU     The TM CPU instance to break.
+ */
+void TM_BreakCPU (TM_CPU* p_CPU);
+
 /**
  * @brief   Reads a byte from the bus at the specified address.
  * @param   p_CPU     The TM CPU instance to read from.
@@ -335,3 +488,27 @@ bool TM_IsHalted (const TM_CPU* p_CPU);
  * @return  `true` if the CPU is stopped; `false` otherwise.
  */
 bool TM_IsStopped (const TM_CPU* p_CPU);
+
+/**
+ * @brief   Gets the opaque context pointer which was supplied when the TM CPU instance was created,
+ *          and which is passed to its bus and cycle functions.
+ * @param   p_CPU     The TM CPU instance to get the context pointer from.
+ * @return  The context pointer, or `NULL` if none was supplied.
+ */
+void* TM_GetCPUContext (const TM_CPU* p_CPU);
+
+/**
+ * @brief   Discards any instructions in the given TM CPU instance's decode cache which overlap the
+ *          given range of addresses.
+ * 
+ * The CPU keeps a cache of the instructions it has recently decoded, so that it need not read them
+ * from the bus again when they are next executed. The program ROM cannot be written, and the CPU
+ * discards instructions in executable RAM (XRAM) itself whenever it writes to them. This function
+ * only needs to be called if the bus's owner changes the contents of XRAM without going through the
+ * CPU's write functions.
+ * 
+ * @param   p_CPU     The TM CPU instance whose decode cache is to be updated.
+ * @param   p_Address The first address which was changed.
+ * @param   p_Size    The number of bytes which were changed.
+ */
+void TM_InvalidateCPUCode (TM_CPU* p_CPU, uint32_t p_Address, uint32_t p_Size);
@@ -4,6 +4,93 @@
 
 #include <TM/CPU.h>
 
+// The JIT compiler emits x86-64 code for the System V calling convention, and needs `mmap` to
+// allocate memory which can be made executable.
+#if defined(__x86_64__) && !defined(_WIN32) && !defined(TM_NO_JIT)
+    #include <stddef.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+    #define TM_JIT_SUPPORTED
+#endif
+
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TM_BLOCK_CACHE_SIZE         512     ///< @brief The number of entries in the block cache. Must be a power of two.
+#define TM_MAX_BLOCK_LENGTH         32      ///< @brief The largest number of instructions translated into one basic block.
+#define TM_BLOCK_SUCCESSORS         2       ///< @brief The number of successor blocks each basic block can be chained to.
+#define TM_MAX_INSTRUCTION_SIZE     6       ///< @brief The size of the largest instruction, in bytes: an opcode word and a 32-bit operand.
+#define TM_JIT_ARENA_SIZE           0x100000    ///< @brief The size of the memory arena which holds compiled code, in bytes.
+#define TM_JIT_THRESHOLD            16      ///< @brief The number of times a block is entered before it is compiled.
+#define TM_JIT_MAX_BLOCK_CODE       0x4000  ///< @brief The largest number of bytes of code one block may compile to.
+
+// Deferred Flags Enumeration /////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Enumerates the operations whose effect on the flags register can be deferred until the
+ *          flags are next read.
+ */
+typedef enum TM_DeferredFlags
+{
+    TM_DF_NONE = 0,     ///< @brief No flags are deferred; the flags register is up to date.
+    TM_DF_INC,          ///< @brief `INC`, whose result is held in the left operand.
+    TM_DF_DEC,          ///< @brief `DEC`, whose result is held in the left operand.
+    TM_DF_ADD,          ///< @brief `ADD` or `ADC`.
+    TM_DF_SUB,          ///< @brief `SUB`, `SBC` or `CMP`.
+    TM_DF_AND,          ///< @brief `AND`, whose result is held in the left operand.
+    TM_DF_LOGIC,        ///< @brief `OR` or `XOR`, whose result is held in the left operand.
+} TM_DeferredFlags;
+
+// Register Field Structure ///////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Describes where one of the CPU's registers, or sub-registers, lives within the
+ *          general-purpose register file.
+ */
+typedef struct TM_RegisterField
+{
+    uint8_t     m_Index;        ///< @brief The index of the 32-bit register holding the field.
+    uint8_t     m_Shift;        ///< @brief The position of the field's lowest bit within that register.
+    uint32_t    m_Mask;         ///< @brief The mask of the field's bits, before shifting.
+} TM_RegisterField;
+
+// Decoded Instruction Structure ///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Describes an instruction which has been fetched from the bus and decoded once, so that it
+ *          can be executed again without re-reading its bytes from the bus.
+ */
+typedef struct TM_DecodedInstruction
+{
+    uint32_t    m_Address;      ///< @brief The address of the instruction's opcode word.
+    uint32_t    m_Operand;      ///< @brief The instruction's immediate operand, if it has one.
+    uint16_t    m_CI;           ///< @brief The instruction's 16-bit opcode word.
+    uint8_t     m_OperandSize;  ///< @brief The size of the immediate operand, in bytes; `0` if there is none.
+} TM_DecodedInstruction;
+
+// Basic Block Structure ///////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Describes a basic block: a run of instructions which are executed one after the other,
+ *          ending in a control-flow instruction (`JMP`, `JPB`, `CALL`, `RST`, `RET`, `RETI` or `JPS`),
+ *          or wherever the flow of execution last left the run.
+ * 
+ * Each block is translated into an array of decoded instructions as it is first executed from the
+ * bus, and is chained to the blocks which have been seen to follow it, so that they can be entered
+ * without looking them up in the block cache.
+ */
+typedef struct TM_BasicBlock
+{
+    uint32_t                m_Address;      ///< @brief The address of the block's first instruction.
+    uint32_t                m_EndAddress;   ///< @brief The address just past the block's last instruction.
+    uint32_t                m_Length;       ///< @brief The number of instructions in the block.
+    bool                    m_Valid;        ///< @brief Whether the block has been completely translated, and may be used.
+    uint8_t                 m_NextSuccessor;    ///< @brief The index of the successor slot to replace next.
+    uint32_t                m_Executions;   ///< @brief The number of times the block has been entered while the JIT compiler is enabled.
+    void*                   m_Native;       ///< @brief The block's compiled code, if it has been compiled.
+    struct TM_BasicBlock*   m_Successors[TM_BLOCK_SUCCESSORS];  ///< @brief The blocks which have been seen to follow this one.
+    TM_DecodedInstruction   m_Instructions[TM_MAX_BLOCK_LENGTH];  ///< @brief The block's decoded instructions.
+} TM_BasicBlock;
+
 // TM CPU Context Structure ////////////////////////////////////////////////////////////////////////
 
 typedef struct TM_CPU
@@ -12,13 +99,37 @@ typedef struct TM_CPU
     // Function Pointers
     TM_BusRead  m_BusRead;  ///< @brief The function to read from the bus.
     TM_BusWrite m_BusWrite; ///< @brief The function to write to the bus.
+    TM_BusPointer m_BusPointer; ///< @brief The function to get direct access to plain memory on the bus, if any.
     TM_Cycle    m_Cycle;    ///< @brief The function to call when a CPU cycle is completed.
+    TM_NextEvent m_NextEvent;   ///< @brief The function to call to find how many cycles a halted CPU may skip, if any.
+    void*       m_Context;  ///< @brief The opaque context pointer passed to the above functions.
+
+    // Cycle Accounting
+    uint32_t    m_PendingCycles;    ///< @brief The number of cycles not yet passed to the cycle function.
+    bool        m_BatchCycles;      ///< @brief Whether cycles are accumulated and flushed in batches.
+    uint64_t    m_CycleCount;       ///< @brief The total number of cycles the CPU has completed.
+    uint64_t    m_CycleTarget;      ///< @brief The cycle count at which a call to `TM_RunCPU` should return.
+    bool        m_Break;            ///< @brief Set by `TM_BreakCPU` to make a call to `TM_RunCPU` return early.
+
+    // Basic Block Cache
+    TM_BasicBlock*          m_BlockCache;   ///< @brief Previously-translated basic blocks, indexed by a hash of their address.
+    TM_BasicBlock*          m_Block;        ///< @brief The block the CPU is currently executing from, if any.
+    uint32_t                m_BlockIndex;   ///< @brief The index of the next instruction to execute in the current block.
+    TM_BasicBlock*          m_Translating;  ///< @brief The block being translated as instructions are executed from the bus, if any.
+    TM_DecodedInstruction*  m_Decoded;      ///< @brief The decoded instruction the current instruction is being executed from, if any.
+    TM_DecodedInstruction*  m_Decoding;     ///< @brief The decoded instruction being filled in as the current instruction is executed from the bus, if any.
+    uint32_t                m_XRAMCodeBegin;    ///< @brief The lowest XRAM address covered by a translated block.
+    uint32_t                m_XRAMCodeEnd;      ///< @brief The address just past the highest XRAM address covered by a translated block.
+
+    // JIT Compiler
+    bool                    m_JITEnabled;   ///< @brief Whether hot blocks are compiled to, and executed as, native code.
+    uint8_t*                m_JITArena;     ///< @brief The memory arena which holds compiled code.
+    size_t                  m_JITArenaUsed; ///< @brief The number of bytes of the arena in use.
+    int32_t                 m_JITWindow;    ///< @brief The number of cycles compiled code may still run before it must flush them and check for interrupts.
+    bool                    m_JITFailed;    ///< @brief Set if an instruction failed while running compiled code.
 
     // General-Purpose Registers
-    uint32_t m_A;           ///< @brief The accumulator register.
-    uint32_t m_B;           ///< @brief The general-purpose register B, traditionally used as a base register.
-    uint32_t m_C;           ///< @brief The general-purpose register C, traditionally used as a counter register.
-    uint32_t m_E;           ///< @brief The general-purpose register E, traditionally used as a data register.
+    uint32_t m_Registers[4];    ///< @brief The general-purpose registers: the accumulator `A`, the base register `B`, the counter register `C` and the data register `E`, in that order.
 
     // Fixed-Point Registers
     uint32_t m_FI;          ///< @brief The fixed-point integer register, used for fixed-point arithmetic.
@@ -69,11 +180,73 @@ typedef struct TM_CPU
         };
     } m_Flags;
 
+    // Deferred Flags
+    uint8_t  m_DeferredOp;      ///< @brief The last operation whose flags have yet to be computed; see `TM_DeferredFlags`.
+    uint8_t  m_DeferredSize;    ///< @brief The size of that operation's destination, in bytes.
+    uint8_t  m_DeferredCarry;   ///< @brief The carry that operation took in.
+    uint32_t m_DeferredLeft;    ///< @brief That operation's left operand, or its result.
+    uint32_t m_DeferredRight;   ///< @brief That operation's right operand.
+
 } TM_CPU;
 
+// Static Constants ////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Maps each `TM_CPURegister` to its field within the general-purpose register file. The
+ *          upper two bits of a register's code select the 32-bit register, and the lower two bits
+ *          select the whole register, its low word, its high byte or its low byte.
+ */
+static const TM_RegisterField s_RegisterFields[16] = {
+    [TM_REG_A]  = { 0, 0, 0xFFFFFFFF }, [TM_REG_AW] = { 0, 0, 0xFFFF },
+    [TM_REG_AH] = { 0, 8, 0xFF },       [TM_REG_AL] = { 0, 0, 0xFF },
+    [TM_REG_B]  = { 1, 0, 0xFFFFFFFF }, [TM_REG_BW] = { 1, 0, 0xFFFF },
+    [TM_REG_BH] = { 1, 8, 0xFF },       [TM_REG_BL] = { 1, 0, 0xFF },
+    [TM_REG_C]  = { 2, 0, 0xFFFFFFFF }, [TM_REG_CW] = { 2, 0, 0xFFFF },
+    [TM_REG_CH] = { 2, 8, 0xFF },       [TM_REG_CL] = { 2, 0, 0xFF },
+    [TM_REG_E]  = { 3, 0, 0xFFFFFFFF }, [TM_REG_EW] = { 3, 0, 0xFFFF },
+    [TM_REG_EH] = { 3, 8, 0xFF },       [TM_REG_EL] = { 3, 0, 0xFF },
+};
+
+// Private Functions - Register Access /////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Reads a register without validating the CPU instance or the register code. Only the lower
+ *          four bits of the code are used.
+ */
+static inline uint32_t TM_ReadRegister (const TM_CPU* p_CPU, uint8_t p_Register)
+{
+    const TM_RegisterField* l_Field = &s_RegisterFields[p_Register & 0xF];
+    return (p_CPU->m_Registers[l_Field->m_Index] >> l_Field->m_Shift) & l_Field->m_Mask;
+}
+
+/**
+ * @brief   Writes a register without validating the CPU instance or the register code. Only the
+ *          lower four bits of the code are used, and bits of the value which do not fit in the
+ *          register are discarded.
+ */
+static inline void TM_WriteRegister (TM_CPU* p_CPU, uint8_t p_Register, uint32_t p_Value)
+{
+    const TM_RegisterField* l_Field = &s_RegisterFields[p_Register & 0xF];
+    uint32_t* l_Register = &p_CPU->m_Registers[l_Field->m_Index];
+    *l_Register = (*l_Register & ~(l_Field->m_Mask << l_Field->m_Shift)) |
+        ((p_Value & l_Field->m_Mask) << l_Field->m_Shift);
+}
+
 // Private Function Prototypes /////////////////////////////////////////////////////////////////////
 
 static void TM_AdvanceCPU (TM_CPU* p_CPU, uint32_t p_Cycles);
+static void TM_SyncCPU (TM_CPU* p_CPU, uint32_t p_Address);
+static uint32_t TM_FetchOperand (TM_CPU* p_CPU, uint8_t p_Size);
+static TM_BasicBlock* TM_GetBlockCacheEntry (TM_CPU* p_CPU, uint32_t p_Address);
+static TM_BasicBlock* TM_FindBlock (TM_CPU* p_CPU, uint32_t p_Address);
+static TM_DecodedInstruction* TM_FindDecodedInstruction (TM_CPU* p_CPU, uint32_t p_Address);
+static void TM_BeginTranslation (TM_CPU* p_CPU, uint32_t p_Address);
+static void TM_EndTranslation (TM_CPU* p_CPU);
+static uint8_t TM_GetDestinationSize (const TM_CPU* p_CPU);
+static uint8_t TM_EvaluateFlags (const TM_CPU* p_CPU);
+static void TM_ResolveFlags (TM_CPU* p_CPU);
+static void TM_DeferFlags (TM_CPU* p_CPU, TM_DeferredFlags p_Op, uint8_t p_Size, uint32_t p_Left,
+    uint32_t p_Right, uint8_t p_Carry);
 static bool TM_CheckCondition (TM_CPU* p_CPU, TM_CPUCondition p_Condition);
 static bool TM_IsReadable (uint32_t p_Address, size_t p_Size);
 static bool TM_IsWritable (uint32_t p_Address, size_t p_Size);
@@ -83,6 +256,14 @@ static uint32_t TM_PopAddress (TM_CPU* p_CPU);
 static void TM_PushData (TM_CPU* p_CPU, uint32_t p_Value);
 static void TM_PushAddress (TM_CPU* p_CPU, uint32_t p_Address);
 static void TM_ServiceInterrupt (TM_CPU* p_CPU);
+static void TM_WaitForInterrupt (TM_CPU* p_CPU);
+static bool TM_IsDispatchInterrupted (const TM_CPU* p_CPU);
+static bool TM_BeginInstruction (TM_CPU* p_CPU);
+static void TM_EndInstruction (TM_CPU* p_CPU);
+static bool TM_HandleInvalidOpcode (TM_CPU* p_CPU);
+static void TM_ProcessInterrupts (TM_CPU* p_CPU);
+static bool TM_DispatchCPU (TM_CPU* p_CPU, uint32_t p_Limit, uint32_t* p_Retired);
+static bool TM_RunCompiledCode (TM_CPU* p_CPU, uint32_t p_Limit, uint32_t* p_Retired);
 
 // Private Functions - Miscellaneous ///////////////////////////////////////////////////////////////
 
@@ -97,10 +278,351 @@ void TM_AdvanceCPU (TM_CPU* p_CPU, uint32_t p_Cycles)
     p_CPU->m_PC += p_Cycles;
 }
 
+void TM_SyncCPU (TM_CPU* p_CPU, uint32_t p_Address)
+{
+    assert(p_CPU != NULL);
+
+    // The program ROM cannot change underneath the CPU, so reading from it never needs the other
+    // components on the bus to be caught up. Any other address may be backed by a component whose
+    // state depends on the cycles elapsed, so flush any pending cycles before accessing it.
+    if (p_Address > TM_ROM_END)
+    {
+        TM_FlushCPUCycles(p_CPU);
+    }
+}
+
+uint32_t TM_FetchOperand (TM_CPU* p_CPU, uint8_t p_Size)
+{
+    assert(p_CPU != NULL);
+
+    uint32_t l_Operand = 0;
+
+    // If the current instruction is being executed from the decode cache, then its operand is
+    // already known. Otherwise, read the operand from the bus at the program counter.
+    if (p_CPU->m_Decoded != NULL)
+    {
+        assert(p_CPU->m_Decoded->m_OperandSize == p_Size);
+        l_Operand = p_CPU->m_Decoded->m_Operand;
+    }
+    else
+    {
+        switch (p_Size)
+        {
+            case 4:  l_Operand = TM_ReadDoubleWord(p_CPU, p_CPU->m_PC); break;
+            case 2:  l_Operand = TM_ReadWord(p_CPU, p_CPU->m_PC); break;
+            default: l_Operand = TM_ReadByte(p_CPU, p_CPU->m_PC); break;
+        }
+
+        // If the instruction is being decoded into the cache, then record its operand. Every
+        // instruction has at most one operand, so stop decoding if another is fetched.
+        if (p_CPU->m_Decoding != NULL)
+        {
+            if (p_CPU->m_Decoding->m_OperandSize == 0)
+            {
+                p_CPU->m_Decoding->m_Operand = l_Operand;
+                p_CPU->m_Decoding->m_OperandSize = p_Size;
+            }
+            else
+            {
+                p_CPU->m_Decoding = NULL;
+            }
+        }
+    }
+
+    // Fetching the operand takes one cycle per byte, and advances the program counter past it.
+    TM_AdvanceCPU(p_CPU, p_Size);
+    return l_Operand;
+}
+
+TM_BasicBlock* TM_GetBlockCacheEntry (TM_CPU* p_CPU, uint32_t p_Address)
+{
+    assert(p_CPU != NULL);
+
+    // Program code, the restart vectors and the interrupt handlers all start on 4 KB boundaries, so
+    // fold the address's upper bits into the index to keep them from sharing entries.
+    return &p_CPU->m_BlockCache[(p_Address ^ (p_Address >> 12)) & (TM_BLOCK_CACHE_SIZE - 1)];
+}
+
+TM_BasicBlock* TM_FindBlock (TM_CPU* p_CPU, uint32_t p_Address)
+{
+    assert(p_CPU != NULL);
+
+    TM_BasicBlock* l_Block = TM_GetBlockCacheEntry(p_CPU, p_Address);
+    return (l_Block->m_Valid == true && l_Block->m_Address == p_Address) ? l_Block : NULL;
+}
+
+TM_DecodedInstruction* TM_FindDecodedInstruction (TM_CPU* p_CPU, uint32_t p_Address)
+{
+    assert(p_CPU != NULL);
+
+    TM_BasicBlock* l_Block = p_CPU->m_Block;
+    if (l_Block != NULL && l_Block->m_Valid == true)
+    {
+        // If the current block has more instructions, and the flow of execution has not left it,
+        // then the next instruction is simply the block's next one.
+        if (p_CPU->m_BlockIndex < l_Block->m_Length)
+        {
+            TM_DecodedInstruction* l_Instruction = &l_Block->m_Instructions[p_CPU->m_BlockIndex];
+            if (l_Instruction->m_Address == p_Address)
+            {
+                p_CPU->m_BlockIndex++;
+                return l_Instruction;
+            }
+        }
+
+        // If the current block is finished, then check the blocks it has been chained to.
+        else
+        {
+            for (uint32_t i = 0; i < TM_BLOCK_SUCCESSORS; ++i)
+            {
+                TM_BasicBlock* l_Successor = l_Block->m_Successors[i];
+                if (l_Successor != NULL && l_Successor->m_Valid == true &&
+                    l_Successor->m_Address == p_Address)
+                {
+                    p_CPU->m_Block = l_Successor;
+                    p_CPU->m_BlockIndex = 1;
+                    return &l_Successor->m_Instructions[0];
+                }
+            }
+        }
+    }
+
+    // Otherwise, look the block up in the block cache.
+    TM_BasicBlock* l_Next = TM_FindBlock(p_CPU, p_Address);
+    if (l_Next == NULL)
+    {
+        p_CPU->m_Block = NULL;
+        return NULL;
+    }
+
+    // If the block just finished with the current one, then chain it to the current block.
+    if (l_Block != NULL && l_Block->m_Valid == true && p_CPU->m_BlockIndex >= l_Block->m_Length)
+    {
+        l_Block->m_Successors[l_Block->m_NextSuccessor] = l_Next;
+        l_Block->m_NextSuccessor = (l_Block->m_NextSuccessor + 1) % TM_BLOCK_SUCCESSORS;
+    }
+
+    p_CPU->m_Block = l_Next;
+    p_CPU->m_BlockIndex = 1;
+    return &l_Next->m_Instructions[0];
+}
+
+void TM_BeginTranslation (TM_CPU* p_CPU, uint32_t p_Address)
+{
+    assert(p_CPU != NULL);
+
+    // If the instruction follows on from the block being translated, and there is room in the block
+    // for it, then it is added to that block. Otherwise, that block is finished, and a new block is
+    // started at the instruction's address, replacing whichever block held its cache entry.
+    TM_BasicBlock* l_Block = p_CPU->m_Translating;
+    if (l_Block == NULL || l_Block->m_EndAddress != p_Address ||
+        l_Block->m_Length >= TM_MAX_BLOCK_LENGTH)
+    {
+        TM_EndTranslation(p_CPU);
+
+        l_Block = TM_GetBlockCacheEntry(p_CPU, p_Address);
+        memset(l_Block, 0, sizeof(TM_BasicBlock));
+        l_Block->m_Address = p_Address;
+        l_Block->m_EndAddress = p_Address;
+
+        p_CPU->m_Translating = l_Block;
+        if (p_CPU->m_Block == l_Block)
+        {
+            p_CPU->m_Block = NULL;
+        }
+    }
+
+    // The instruction's opcode word and operand are filled in as it is executed.
+    p_CPU->m_Decoding = &l_Block->m_Instructions[l_Block->m_Length];
+    p_CPU->m_Decoding->m_Address = p_Address;
+    p_CPU->m_Decoding->m_Operand = 0;
+    p_CPU->m_Decoding->m_OperandSize = 0;
+}
+
+void TM_EndTranslation (TM_CPU* p_CPU)
+{
+    assert(p_CPU != NULL);
+
+    // A block being translated may be used once it holds at least one instruction.
+    TM_BasicBlock* l_Block = p_CPU->m_Translating;
+    if (l_Block != NULL && l_Block->m_Length > 0)
+    {
+        l_Block->m_Valid = true;
+
+        // Keep track of the range of XRAM covered by blocks, so that writes to XRAM outside of it
+        // need not search the cache for blocks to invalidate.
+        if (l_Block->m_Address >= TM_XRAM_BEGIN)
+        {
+            if (p_CPU->m_XRAMCodeBegin >= p_CPU->m_XRAMCodeEnd)
+            {
+                p_CPU->m_XRAMCodeBegin = l_Block->m_Address;
+                p_CPU->m_XRAMCodeEnd = l_Block->m_EndAddress;
+            }
+            else
+            {
+                if (l_Block->m_Address < p_CPU->m_XRAMCodeBegin)
+                {
+                    p_CPU->m_XRAMCodeBegin = l_Block->m_Address;
+                }
+                if (l_Block->m_EndAddress > p_CPU->m_XRAMCodeEnd)
+                {
+                    p_CPU->m_XRAMCodeEnd = l_Block->m_EndAddress;
+                }
+            }
+        }
+    }
+
+    p_CPU->m_Translating = NULL;
+    p_CPU->m_Decoding = NULL;
+}
+
+uint8_t TM_GetDestinationSize (const TM_CPU* p_CPU)
+{
+    // The destination is one byte wide if the destination address flag is set, or if the
+    // destination register is a byte register.
+    if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
+    {
+        return 1;
+    }
+    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
+    {
+        return 2;
+    }
+
+    return 4;
+}
+
+uint8_t TM_EvaluateFlags (const TM_CPU* p_CPU)
+{
+    uint8_t  l_Flags = p_CPU->m_Flags.m_Register;
+    uint32_t l_Left = p_CPU->m_DeferredLeft;
+    uint32_t l_Right = p_CPU->m_DeferredRight;
+    uint8_t  l_Carry = p_CPU->m_DeferredCarry;
+    uint8_t  l_Size = p_CPU->m_DeferredSize;
+    uint32_t l_Mask = (l_Size == 1) ? 0xFF : (l_Size == 2) ? 0xFFFF : 0xFFFFFFFF;
+    bool     l_Z = (l_Flags >> TM_FLAG_Z) & 1,
+             l_N = (l_Flags >> TM_FLAG_N) & 1,
+             l_H = (l_Flags >> TM_FLAG_H) & 1,
+             l_C = (l_Flags >> TM_FLAG_C) & 1;
+
+    // Compute the flags the deferred operation would have set, exactly as its instruction handler
+    // used to. Flags which the operation leaves alone keep their current values.
+    switch (p_CPU->m_DeferredOp)
+    {
+        case TM_DF_NONE:
+            return l_Flags;
+
+        case TM_DF_INC:
+            l_Z = ((l_Left & l_Mask) == 0);
+            l_H = (l_Size == 1) ? ((l_Left & 0x0F) == 0) : l_H;
+            l_N = false;
+            break;
+
+        case TM_DF_DEC:
+            l_Z = ((l_Left & l_Mask) == 0);
+            l_H = (l_Size == 1) ? ((l_Left & 0x0F) == 0x0F) : l_H;
+            l_N = true;
+            break;
+
+        case TM_DF_ADD:
+        {
+            uint64_t l_Result = l_Left + l_Right + l_Carry;
+            uint32_t l_HalfMask = l_Mask >> 4;
+            uint32_t l_HalfCarry = ((l_Left & l_HalfMask) + (l_Right & l_HalfMask) + l_Carry);
+            l_Z = ((l_Result & l_Mask) == 0);
+            l_H = (l_HalfCarry > l_HalfMask);
+            l_C = (l_Result > l_Mask);
+            l_N = false;
+        } break;
+
+        case TM_DF_SUB:
+        {
+            int64_t l_Result = l_Left - l_Right - l_Carry;
+            l_Z = ((l_Result & l_Mask) == 0);
+            if (l_Size == 1)
+            {
+                int8_t l_HalfCarry = ((l_Left & 0xF) - (l_Right & 0xF) - l_Carry);
+                l_H = (l_HalfCarry < 0);
+            }
+            else if (l_Size == 2)
+            {
+                int16_t l_HalfCarry = ((l_Left & 0xFFF) - (l_Right & 0xFFF) - l_Carry);
+                l_H = (l_HalfCarry < 0);
+            }
+            else
+            {
+                int32_t l_HalfCarry = ((l_Left & 0xFFFFFFF) - (l_Right & 0xFFFFFFF) - l_Carry);
+                l_H = (l_HalfCarry < 0);
+            }
+            l_C = (l_Result < 0);
+            l_N = true;
+        } break;
+
+        case TM_DF_AND:
+            l_Z = ((l_Left & l_Mask) == 0);
+            l_H = true;
+            l_N = false;
+            l_C = false;
+            break;
+
+        case TM_DF_LOGIC:
+            l_Z = ((l_Left & l_Mask) == 0);
+            l_H = false;
+            l_N = false;
+            l_C = false;
+            break;
+    }
+
+    return (l_Flags & 0x0F) |
+        (l_Z << TM_FLAG_Z) | (l_N << TM_FLAG_N) | (l_H << TM_FLAG_H) | (l_C << TM_FLAG_C);
+}
+
+void TM_ResolveFlags (TM_CPU* p_CPU)
+{
+    if (p_CPU->m_DeferredOp != TM_DF_NONE)
+    {
+        p_CPU->m_Flags.m_Register = TM_EvaluateFlags(p_CPU);
+        p_CPU->m_DeferredOp = TM_DF_NONE;
+    }
+}
+
+void TM_DeferFlags (TM_CPU* p_CPU, TM_DeferredFlags p_Op, uint8_t p_Size, uint32_t p_Left,
+    uint32_t p_Right, uint8_t p_Carry)
+{
+    // `INC` and `DEC` leave the carry flag - and, unless their destination is a byte, the
+    // half-carry flag - untouched, so any flags those depend on must be computed first. A pending
+    // `INC` or `DEC` never changes the carry flag and, unless its destination was a byte, never
+    // changes the half-carry flag either, so it can simply be overwritten in most cases.
+    if (p_Op == TM_DF_INC || p_Op == TM_DF_DEC)
+    {
+        bool l_Overwritable =
+            (p_CPU->m_DeferredOp == TM_DF_INC || p_CPU->m_DeferredOp == TM_DF_DEC) &&
+            (p_CPU->m_DeferredSize != 1 || p_Size == 1);
+        if (l_Overwritable == false)
+        {
+            TM_ResolveFlags(p_CPU);
+        }
+    }
+
+    p_CPU->m_DeferredOp = p_Op;
+    p_CPU->m_DeferredSize = p_Size;
+    p_CPU->m_DeferredLeft = p_Left;
+    p_CPU->m_DeferredRight = p_Right;
+    p_CPU->m_DeferredCarry = p_Carry;
+}
+
 bool TM_CheckCondition (TM_CPU* p_CPU, TM_CPUCondition p_Condition)
 {
     assert(p_CPU != NULL);
 
+    // The flags register is only needed if the condition actually tests it.
+    if (p_Condition == TM_COND_NC)
+    {
+        return true;
+    }
+
+    TM_ResolveFlags(p_CPU);
+
     // Check the condition against the CPU's flags register.
     switch (p_Condition)
     {
@@ -180,6 +702,7 @@ uint32_t TM_PopData (TM_CPU* p_CPU)
     }
 
     // Read the value from the data stack pointer, then increment the data stack pointer.
+    TM_SyncCPU(p_CPU, TM_DSTACK_BEGIN + p_CPU->m_DSP);
     uint32_t l_Value = TM_ReadDoubleWord(p_CPU, TM_DSTACK_BEGIN + p_CPU->m_DSP);
     p_CPU->m_DSP += 4;
 
@@ -208,6 +731,7 @@ uint32_t TM_PopAddress (TM_CPU* p_CPU)
     }
 
     // Read the value from the call stack pointer, then increment the call stack pointer.
+    TM_SyncCPU(p_CPU, TM_CSTACK_BEGIN + p_CPU->m_CSP);
     uint32_t l_Value = TM_ReadDoubleWord(p_CPU, TM_CSTACK_BEGIN + p_CPU->m_CSP);
     p_CPU->m_CSP += 4;
 
@@ -232,6 +756,7 @@ void TM_PushData (TM_CPU* p_CPU, uint32_t p_Value)
 
     // Decrement the data stack pointer, then write the value to the data stack.
     p_CPU->m_DSP -= 4;
+    TM_SyncCPU(p_CPU, TM_DSTACK_BEGIN + p_CPU->m_DSP);
     TM_WriteDoubleWord(p_CPU, TM_DSTACK_BEGIN + p_CPU->m_DSP, p_Value);
 
     // Pushing to a stack takes five cycles:
@@ -253,6 +778,7 @@ void TM_PushAddress (TM_CPU* p_CPU, uint32_t p_Address)
 
     // Decrement the call stack pointer, then write the address to the call stack.
     p_CPU->m_CSP -= 4;
+    TM_SyncCPU(p_CPU, TM_CSTACK_BEGIN + p_CPU->m_CSP);
     TM_WriteDoubleWord(p_CPU, TM_CSTACK_BEGIN + p_CPU->m_CSP, p_Address);
 
     // Pushing to a stack takes five cycles:
@@ -286,6 +812,11 @@ void TM_ServiceInterrupt (TM_CPU* p_CPU)
             // - Set the program counter to the interrupt vector address.
             TM_PushAddress(p_CPU, p_CPU->m_PC);
             p_CPU->m_PC = TM_INT_BEGIN + (0x100 * i);
+
+            // Pass on the cycles held back by the push before checking the remaining interrupts,
+            // so that any interrupt requested during those cycles is serviced here, too, just as
+            // it is when the cycles are passed on as they complete.
+            TM_FlushCPUCycles(p_CPU);
         }
     }
 }
@@ -332,7 +863,7 @@ bool TM_Fetch_REG_REG (TM_CPU* p_CPU)
     // Argument 2: `REG` = Source Register
 
     // Read the source register's value into the memory data register.
-    p_CPU->m_MD = TM_GetRegister(p_CPU, p_CPU->m_IP2);
+    p_CPU->m_MD = TM_ReadRegister(p_CPU, p_CPU->m_IP2);
     return true;
 }
 
@@ -350,21 +881,18 @@ bool TM_Fetch_REG_IMM (TM_CPU* p_CPU)
     switch (p_CPU->m_IP1 & 0b11)
     {
         case 0b00:
-            // Read a double word from the bus at the program counter.
-            p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_PC);
-            TM_AdvanceCPU(p_CPU, 4);
+            // Fetch a double word at the program counter.
+            p_CPU->m_MD = TM_FetchOperand(p_CPU, 4);
             break;
 
         case 0b01:
-            // Read a word from the bus at the program counter.
-            p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_PC);
-            TM_AdvanceCPU(p_CPU, 2);
+            // Fetch a word at the program counter.
+            p_CPU->m_MD = TM_FetchOperand(p_CPU, 2);
             break;
 
         default:
-            // Read a byte from the bus at the program counter.
-            p_CPU->m_MD = TM_ReadByte(p_CPU, p_CPU->m_PC);
-            TM_AdvanceCPU(p_CPU, 1);
+            // Fetch a byte at the program counter.
+            p_CPU->m_MD = TM_FetchOperand(p_CPU, 1);
             break;
     }
 
@@ -376,10 +904,9 @@ bool TM_Fetch_REG_ADDR32 (TM_CPU* p_CPU)
     // Argument 1: `REG` = Destination Register
     // Argument 2: `ADDR32` = Absolute Address
 
-    // Read the address from the bus at the program counter. Place it into the memory address
+    // Fetch the address at the program counter. Place it into the memory address
     // register.
-    p_CPU->m_MA = TM_ReadDoubleWord(p_CPU, p_CPU->m_PC);
-    TM_AdvanceCPU(p_CPU, 4);
+    p_CPU->m_MA = TM_FetchOperand(p_CPU, 4);
 
     // Depending on the low two bits of the destination register...
     // - `0b00` = 32-bit register; read a double word at the address in the memory address register.
@@ -398,6 +925,7 @@ bool TM_Fetch_REG_ADDR32 (TM_CPU* p_CPU)
             }
 
             // Read a double word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 4);
             break;
@@ -411,6 +939,7 @@ bool TM_Fetch_REG_ADDR32 (TM_CPU* p_CPU)
             }
 
             // Read a word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 2);
             break;
@@ -424,6 +953,7 @@ bool TM_Fetch_REG_ADDR32 (TM_CPU* p_CPU)
             }
 
             // Read a byte from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadByte(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 1);
             break;
@@ -437,10 +967,9 @@ bool TM_Fetch_REG_ADDR16 (TM_CPU* p_CPU)
     // Argument 1: `REG` = Destination Register
     // Argument 2: `ADDR16` = 16-bit Relative Address (Relative to QRAM)
 
-    // Read the address from the bus at the program counter. Place it into the memory address
+    // Fetch the address at the program counter. Place it into the memory address
     // register. The address is relative to the QRAM, so add the QRAM base address to it.
-    p_CPU->m_MA = TM_ReadWord(p_CPU, p_CPU->m_PC) + TM_QRAM_BEGIN;
-    TM_AdvanceCPU(p_CPU, 2);
+    p_CPU->m_MA = TM_FetchOperand(p_CPU, 2) + TM_QRAM_BEGIN;
 
     // Depending on the low two bits of the destination register...
     // - `0b00` = 32-bit register; read a double word at the address in the memory address register.
@@ -453,18 +982,21 @@ bool TM_Fetch_REG_ADDR16 (TM_CPU* p_CPU)
     {
         case 0b00:
             // Read a double word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 4);
             break;
 
         case 0b01:
             // Read a word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 2);
             break;
 
         default:
             // Read a byte from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadByte(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 1);
             break;
@@ -478,11 +1010,10 @@ bool TM_Fetch_REG_ADDR8 (TM_CPU* p_CPU)
     // Argument 1: `REG` = Destination Register
     // Argument 2: `ADDR8` = 8-bit Relative Address (Relative to Hardware I/O Ports)
 
-    // Read the address from the bus at the program counter. Place it into the memory address
+    // Fetch the address at the program counter. Place it into the memory address
     // register. The address is relative to the hardware I/O ports, so add the hardware I/O base
     // address to it.
-    p_CPU->m_MA = TM_ReadByte(p_CPU, p_CPU->m_PC) + TM_IO_BEGIN;
-    TM_AdvanceCPU(p_CPU, 1);
+    p_CPU->m_MA = TM_FetchOperand(p_CPU, 1) + TM_IO_BEGIN;
 
     // Depending on the low two bits of the destination register...
     // - `0b00` = 32-bit register; read a double word at the address in the memory address register.
@@ -495,18 +1026,21 @@ bool TM_Fetch_REG_ADDR8 (TM_CPU* p_CPU)
     {
         case 0b00:
             // Read a double word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 4);
             break;
 
         case 0b01:
             // Read a word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 2);
             break;
 
         default:
             // Read a byte from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadByte(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 1);
             break;
@@ -529,7 +1063,7 @@ bool TM_Fetch_REG_REGPTR32 (TM_CPU* p_CPU)
     }
 
     // Get the address from the source register. Place it into the memory address register.
-    p_CPU->m_MA = TM_GetRegister(p_CPU, p_CPU->m_IP2);
+    p_CPU->m_MA = TM_ReadRegister(p_CPU, p_CPU->m_IP2);
 
     // Depending on the low two bits of the destination register...
     // - `0b00` = 32-bit register; read a double word at the address in the memory address register.
@@ -548,6 +1082,7 @@ bool TM_Fetch_REG_REGPTR32 (TM_CPU* p_CPU)
             }
 
             // Read a double word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 4);
             break;
@@ -561,6 +1096,7 @@ bool TM_Fetch_REG_REGPTR32 (TM_CPU* p_CPU)
             }
 
             // Read a word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 2);
             break;
@@ -574,6 +1110,7 @@ bool TM_Fetch_REG_REGPTR32 (TM_CPU* p_CPU)
             }
 
             // Read a byte from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadByte(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 1);
             break;
@@ -596,7 +1133,7 @@ bool TM_Fetch_REG_REGPTR16 (TM_CPU* p_CPU)
     }
 
     // Get the address from the source register. Place it into the memory address register.
-    p_CPU->m_MA = TM_GetRegister(p_CPU, p_CPU->m_IP2) + TM_QRAM_BEGIN;
+    p_CPU->m_MA = TM_ReadRegister(p_CPU, p_CPU->m_IP2) + TM_QRAM_BEGIN;
 
     // Depending on the low two bits of the destination register...
     // - `0b00` = 32-bit register; read a double word at the address in the memory address register.
@@ -609,18 +1146,21 @@ bool TM_Fetch_REG_REGPTR16 (TM_CPU* p_CPU)
     {
         case 0b00:
             // Read a double word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 4);
             break;
 
         case 0b01:
             // Read a word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 2);
             break;
 
         default:
             // Read a byte from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadByte(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 1);
             break;
@@ -643,7 +1183,7 @@ bool TM_Fetch_REG_REGPTR8 (TM_CPU* p_CPU)
     }
 
     // Get the address from the source register. Place it into the memory address register.
-    p_CPU->m_MA = TM_GetRegister(p_CPU, p_CPU->m_IP2) + TM_IO_BEGIN;
+    p_CPU->m_MA = TM_ReadRegister(p_CPU, p_CPU->m_IP2) + TM_IO_BEGIN;
 
     // Depending on the low two bits of the destination register...
     // - `0b00` = 32-bit register; read a double word at the address in the memory address register.
@@ -656,18 +1196,21 @@ bool TM_Fetch_REG_REGPTR8 (TM_CPU* p_CPU)
     {
         case 0b00:
             // Read a double word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 4);
             break;
 
         case 0b01:
             // Read a word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 2);
             break;
 
         default:
             // Read a byte from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadByte(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 1);
             break;
@@ -681,10 +1224,9 @@ bool TM_Fetch_ADDR32_REG (TM_CPU* p_CPU)
     // Argument 1: `ADDR32` = Absolute Address
     // Argument 2: `REG` = Source Register
 
-    // Read the address from the bus at the program counter. Place it into the memory address
+    // Fetch the address at the program counter. Place it into the memory address
     // register.
-    p_CPU->m_MA = TM_ReadDoubleWord(p_CPU, p_CPU->m_PC);
-    TM_AdvanceCPU(p_CPU, 4);
+    p_CPU->m_MA = TM_FetchOperand(p_CPU, 4);
 
     // Depending on the low two bits of the source register, make sure the address range of the
     // appropriate size is writable.
@@ -720,7 +1262,7 @@ bool TM_Fetch_ADDR32_REG (TM_CPU* p_CPU)
     p_CPU->m_DA = true;
 
     // Read the source register's value into the memory data register.
-    p_CPU->m_MD = TM_GetRegister(p_CPU, p_CPU->m_IP2);
+    p_CPU->m_MD = TM_ReadRegister(p_CPU, p_CPU->m_IP2);
     return true;
 }
 
@@ -729,17 +1271,16 @@ bool TM_Fetch_ADDR16_REG (TM_CPU* p_CPU)
     // Argument 1: `ADDR16` = 16-bit Relative Address (Relative to QRAM)
     // Argument 2: `REG` = Source Register
 
-    // Read the address from the bus at the program counter. Place it into the memory address
+    // Fetch the address at the program counter. Place it into the memory address
     // register. The address is relative to the QRAM, so add the QRAM base address to it.
-    p_CPU->m_MA = TM_ReadWord(p_CPU, p_CPU->m_PC) + TM_QRAM_BEGIN;
-    TM_AdvanceCPU(p_CPU, 2);
+    p_CPU->m_MA = TM_FetchOperand(p_CPU, 2) + TM_QRAM_BEGIN;
 
     // Because the absolute address is within the QRAM or I/O Ports, the address is always writable.
     // Because the address is to be written to, set the destination address flag to true.
     p_CPU->m_DA = true;
 
     // Read the source register's value into the memory data register.
-    p_CPU->m_MD = TM_GetRegister(p_CPU, p_CPU->m_IP2);
+    p_CPU->m_MD = TM_ReadRegister(p_CPU, p_CPU->m_IP2);
     return true;
 }
 
@@ -748,18 +1289,17 @@ bool TM_Fetch_ADDR8_REG (TM_CPU* p_CPU)
     // Argument 1: `ADDR8` = 8-bit Relative Address (Relative to Hardware I/O Ports)
     // Argument 2: `REG` = Source Register
 
-    // Read the address from the bus at the program counter. Place it into the memory address
+    // Fetch the address at the program counter. Place it into the memory address
     // register. The address is relative to the hardware I/O ports, so add the hardware I/O base
     // address to it.
-    p_CPU->m_MA = TM_ReadByte(p_CPU, p_CPU->m_PC) + TM_IO_BEGIN;
-    TM_AdvanceCPU(p_CPU, 1);
+    p_CPU->m_MA = TM_FetchOperand(p_CPU, 1) + TM_IO_BEGIN;
 
     // Because the absolute address is within the I/O Ports' address range, the address is always
     // writable. Because the address is to be written to, set the destination address flag to true.
     p_CPU->m_DA = true;
     
     // Read the source register's value into the memory data register.
-    p_CPU->m_MD = TM_GetRegister(p_CPU, p_CPU->m_IP2);
+    p_CPU->m_MD = TM_ReadRegister(p_CPU, p_CPU->m_IP2);
     return true;
 }
 
@@ -777,7 +1317,7 @@ bool TM_Fetch_REGPTR32_REG (TM_CPU* p_CPU)
     }
 
     // Get the address from the destination register. Place it into the memory address register.
-    p_CPU->m_MA = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    p_CPU->m_MA = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
 
     // Depending on the low two bits of the source register, make sure the address range of the
     // appropriate size is writable.
@@ -813,7 +1353,7 @@ bool TM_Fetch_REGPTR32_REG (TM_CPU* p_CPU)
     p_CPU->m_DA = true;
 
     // Read the source register's value into the memory data register.
-    p_CPU->m_MD = TM_GetRegister(p_CPU, p_CPU->m_IP2);
+    p_CPU->m_MD = TM_ReadRegister(p_CPU, p_CPU->m_IP2);
 
     return true;
 }
@@ -832,14 +1372,14 @@ bool TM_Fetch_REGPTR16_REG (TM_CPU* p_CPU)
     }
 
     // Get the address from the destination register. Place it into the memory address register.
-    p_CPU->m_MA = TM_GetRegister(p_CPU, p_CPU->m_IP1) + TM_QRAM_BEGIN;
+    p_CPU->m_MA = TM_ReadRegister(p_CPU, p_CPU->m_IP1) + TM_QRAM_BEGIN;
 
     // Because the absolute address is within the QRAM or I/O Ports, the address is always writable.
     // Because the address is to be written to, set the destination address flag to true.
     p_CPU->m_DA = true;
 
     // Read the source register's value into the memory data register.
-    p_CPU->m_MD = TM_GetRegister(p_CPU, p_CPU->m_IP2);
+    p_CPU->m_MD = TM_ReadRegister(p_CPU, p_CPU->m_IP2);
 
     return true;
 }
@@ -858,14 +1398,14 @@ bool TM_Fetch_REGPTR8_REG (TM_CPU* p_CPU)
     }
 
     // Get the address from the destination register. Place it into the memory address register.
-    p_CPU->m_MA = TM_GetRegister(p_CPU, p_CPU->m_IP1) + TM_IO_BEGIN;
+    p_CPU->m_MA = TM_ReadRegister(p_CPU, p_CPU->m_IP1) + TM_IO_BEGIN;
 
     // Because the absolute address is within the I/O Ports' address range, the address is always
     // writable. Because the address is to be written to, set the destination address flag to true.
     p_CPU->m_DA = true;
 
     // Read the source register's value into the memory data register.
-    p_CPU->m_MD = TM_GetRegister(p_CPU, p_CPU->m_IP2);
+    p_CPU->m_MD = TM_ReadRegister(p_CPU, p_CPU->m_IP2);
 
     return true;
 }
@@ -875,10 +1415,9 @@ bool TM_Fetch_NULL_IMM (TM_CPU* p_CPU)
     // Argument 1: `NULL` = Nothing
     // Argument 2: `IMM` = Immediate Value
 
-    // Read the immediate value from the bus at the program counter. Place it into the memory data
+    // Fetch the immediate value at the program counter. Place it into the memory data
     // register.
-    p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_PC);
-    TM_AdvanceCPU(p_CPU, 4);
+    p_CPU->m_MD = TM_FetchOperand(p_CPU, 4);
 
     return (p_CPU->m_EC == TM_EC_OK);
 }
@@ -888,10 +1427,9 @@ bool TM_Fetch_NULL_SIMM16 (TM_CPU* p_CPU)
     // Argument 1: `NULL` = Nothing
     // Argument 2: `SIMM16` = 16-bit Signed Immediate Value
 
-    // Read the immediate value from the bus at the program counter. Place it into the memory data
+    // Fetch the immediate value at the program counter. Place it into the memory data
     // register.
-    p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_PC);
-    TM_AdvanceCPU(p_CPU, 2);
+    p_CPU->m_MD = TM_FetchOperand(p_CPU, 2);
 
     return (p_CPU->m_EC == TM_EC_OK);
 }
@@ -902,7 +1440,7 @@ bool TM_Fetch_REG_NULL (TM_CPU* p_CPU)
     // Argument 2: `NULL` = Nothing
     
     // Read the destination register's value into the memory data register.
-    p_CPU->m_MD = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    p_CPU->m_MD = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
     return true;
 }
 
@@ -920,7 +1458,7 @@ bool TM_Fetch_REGPTR32_NULL (TM_CPU* p_CPU)
     }
 
     // Get the address from the destination register. Place it into the memory address register.
-    p_CPU->m_MA = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    p_CPU->m_MA = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
     
     // Depending on the low two bits of the destination register...
     // - `0b00` = 32-bit register; read a double word at the address in the memory address register.
@@ -939,6 +1477,7 @@ bool TM_Fetch_REGPTR32_NULL (TM_CPU* p_CPU)
             }
 
             // Read a double word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadDoubleWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 4);
             break;
@@ -952,6 +1491,7 @@ bool TM_Fetch_REGPTR32_NULL (TM_CPU* p_CPU)
             }
 
             // Read a word from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadWord(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 2);
             break;
@@ -965,6 +1505,7 @@ bool TM_Fetch_REGPTR32_NULL (TM_CPU* p_CPU)
             }
 
             // Read a byte from the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             p_CPU->m_MD = TM_ReadByte(p_CPU, p_CPU->m_MA);
             TM_CycleCPU(p_CPU, 1);
             break;
@@ -1086,9 +1627,13 @@ static bool TM_Execute_DAA (TM_CPU* p_CPU)
     // This is a special instruction that adjusts the value in the AL register to be a valid BCD
     // value.
 
-    uint8_t l_AL = TM_GetRegister(p_CPU, TM_REG_AL);
+    uint8_t l_AL = TM_ReadRegister(p_CPU, TM_REG_AL);
     uint8_t l_Adjust = 0, l_Result = 0;
 
+    // The adjustment depends on the half-carry, carry and subtraction flags left by the last
+    // arithmetic instruction, so compute them now.
+    TM_ResolveFlags(p_CPU);
+
     if (p_CPU->m_Flags.m_H == true || (l_AL & 0x0F) > 0x9)
     {
         l_Adjust = 0x06;
@@ -1107,7 +1652,7 @@ static bool TM_Execute_DAA (TM_CPU* p_CPU)
     // Adjust the AL register by either adding or subtracting the adjustment value, depending on the
     // subtraction flag.
     l_Result = (p_CPU->m_Flags.m_N == true) ? (l_AL - l_Adjust) : (l_AL + l_Adjust);
-    TM_SetRegister(p_CPU, TM_REG_AL, l_Result);
+    TM_WriteRegister(p_CPU, TM_REG_AL, l_Result);
 
     // Set the flags register based on the result of the adjustment.
     p_CPU->m_Flags.m_Z = (l_Result == 0);
@@ -1119,6 +1664,8 @@ static bool TM_Execute_DAA (TM_CPU* p_CPU)
 // 0x0800 SCF
 static bool TM_Execute_SCF (TM_CPU* p_CPU)
 {
+    TM_ResolveFlags(p_CPU);
+
     // Set the carry flag. This is a special instruction that sets the carry flag in the flags
     // register.
     p_CPU->m_Flags.m_C = true;
@@ -1130,6 +1677,8 @@ static bool TM_Execute_SCF (TM_CPU* p_CPU)
 // 0x0900 CCF
 static bool TM_Execute_CCF (TM_CPU* p_CPU)
 {
+    TM_ResolveFlags(p_CPU);
+
     // Complement the carry flag. This is a special instruction that toggles the carry flag in the
     // flags register.
     p_CPU->m_Flags.m_C = !p_CPU->m_Flags.m_C;
@@ -1149,7 +1698,7 @@ static bool TM_Execute_LD (TM_CPU* p_CPU)
 {
     // Load the value from the memory data register into the destination register. The destination
     // register is determined by the instruction opcode.
-    TM_SetRegister(p_CPU, p_CPU->m_IP1, p_CPU->m_MD);
+    TM_WriteRegister(p_CPU, p_CPU->m_IP1, p_CPU->m_MD);
 
     return true;
 }
@@ -1173,18 +1722,21 @@ static bool TM_Execute_ST (TM_CPU* p_CPU)
     {
         case 0b00:
             // Write a double word to the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             TM_WriteDoubleWord(p_CPU, p_CPU->m_MA, p_CPU->m_MD);
             TM_CycleCPU(p_CPU, 4);
             break;
 
         case 0b01:
             // Write a word to the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             TM_WriteWord(p_CPU, p_CPU->m_MA, p_CPU->m_MD);
             TM_CycleCPU(p_CPU, 2);
             break;
 
         default:
             // Write a byte to the bus at the address in the memory address register.
+            TM_SyncCPU(p_CPU, p_CPU->m_MA);
             TM_WriteByte(p_CPU, p_CPU->m_MA, p_CPU->m_MD);
             TM_CycleCPU(p_CPU, 1);
             break;
@@ -1198,7 +1750,7 @@ static bool TM_Execute_MV (TM_CPU* p_CPU)
 {
     // Move the value from the source register to the destination register. The destination
     // register is determined by the instruction opcode.
-    TM_SetRegister(p_CPU, p_CPU->m_IP1, TM_GetRegister(p_CPU, p_CPU->m_IP2));
+    TM_WriteRegister(p_CPU, p_CPU->m_IP1, TM_ReadRegister(p_CPU, p_CPU->m_IP2));
 
     return true;
 }
@@ -1208,7 +1760,7 @@ static bool TM_Execute_PUSH (TM_CPU* p_CPU)
 {
     // Push the value from the source register onto the stack. The stack pointer is decremented
     // before the value is pushed onto the stack.
-    TM_PushData(p_CPU, TM_GetRegister(p_CPU, p_CPU->m_IP2));
+    TM_PushData(p_CPU, TM_ReadRegister(p_CPU, p_CPU->m_IP2));
     return (p_CPU->m_EC == TM_EC_OK);
 }
 
@@ -1223,7 +1775,7 @@ static bool TM_Execute_POP (TM_CPU* p_CPU)
         return false;
     }
 
-    TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Popped);
+    TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Popped);
     return true;
 }
 
@@ -1378,6 +1930,7 @@ static bool TM_Execute_INC (TM_CPU* p_CPU)
     // Otherwise, write the incremented value back to the destination register.
     if (p_CPU->m_DA == true)
     {
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, p_CPU->m_MD & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -1387,27 +1940,12 @@ static bool TM_Execute_INC (TM_CPU* p_CPU)
     }
     else
     {
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, p_CPU->m_MD);
-    }
-
-    // Set the flags register based on either the size of the destination register or whether the
-    // destination address flag is set.
-    if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
-    {
-        p_CPU->m_Flags.m_Z = ((p_CPU->m_MD & 0xFF) == 0);
-        p_CPU->m_Flags.m_H = ((p_CPU->m_MD & 0x0F) == 0);
-    }
-    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
-    {
-        p_CPU->m_Flags.m_Z = ((p_CPU->m_MD & 0xFFFF) == 0);
-    }
-    else
-    {
-        p_CPU->m_Flags.m_Z = (p_CPU->m_MD == 0);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, p_CPU->m_MD);
     }
 
-    // Regardless, clear the negative flag as there is no subtraction involved.
-    p_CPU->m_Flags.m_N = false;
+    // Defer setting the flags register, which depends on either the size of the destination
+    // register or whether the destination address flag is set.
+    TM_DeferFlags(p_CPU, TM_DF_INC, TM_GetDestinationSize(p_CPU), p_CPU->m_MD, 0, 0);
 
     return true;
 }
@@ -1425,6 +1963,7 @@ static bool TM_Execute_DEC (TM_CPU* p_CPU)
     // Otherwise, write the decremented value back to the destination register.
     if (p_CPU->m_DA == true)
     {
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, p_CPU->m_MD & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -1434,27 +1973,12 @@ static bool TM_Execute_DEC (TM_CPU* p_CPU)
     }
     else
     {
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, p_CPU->m_MD);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, p_CPU->m_MD);
     }
 
-    // Set the flags register based on either the size of the destination register or whether the
-    // destination address flag is set.
-    if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
-    {
-        p_CPU->m_Flags.m_Z = ((p_CPU->m_MD & 0xFF) == 0);
-        p_CPU->m_Flags.m_H = ((p_CPU->m_MD & 0x0F) == 0x0F);
-    }
-    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
-    {
-        p_CPU->m_Flags.m_Z = ((p_CPU->m_MD & 0xFFFF) == 0);
-    }
-    else
-    {
-        p_CPU->m_Flags.m_Z = (p_CPU->m_MD == 0);
-    }
-
-    // Regardless, set the negative flag as decrementation involves subtraction.
-    p_CPU->m_Flags.m_N = true;
+    // Defer setting the flags register, which depends on either the size of the destination
+    // register or whether the destination address flag is set.
+    TM_DeferFlags(p_CPU, TM_DF_DEC, TM_GetDestinationSize(p_CPU), p_CPU->m_MD, 0, 0);
 
     return true;
 }
@@ -1478,42 +2002,21 @@ static bool TM_Execute_ADD (TM_CPU* p_CPU, bool p_WithCarry)
 
     // Get the values of the accumulator register, the memory data register and, if `p_WithCarry` is
     // `true`, the value of the carry flag.
-    uint32_t l_Accumulator = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    uint32_t l_Accumulator = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
     uint32_t l_Addend = p_CPU->m_MD;
-    uint8_t  l_Carry = (p_WithCarry == true) ? p_CPU->m_Flags.m_C : 0;
+    uint8_t  l_Carry = 0;
+    if (p_WithCarry == true)
+    {
+        TM_ResolveFlags(p_CPU);
+        l_Carry = p_CPU->m_Flags.m_C;
+    }
 
     // Add the values together and store the result in the destination register.
     uint64_t l_Result = l_Accumulator + l_Addend + l_Carry;
-    TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result & 0xFFFFFFFF);
-
-    // Set the flags register based on the size of the destination register.
-    //
-    // To properly set the half-carry flag, an additional addition is performed on all but the
-    // leftmost bits of the above-calculated operands.
-    if ((p_CPU->m_IP1 & 0b11) >= 2)
-    {
-        uint8_t l_HalfCarry = ((l_Accumulator & 0xF) + (l_Addend & 0xF) + l_Carry);
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFF) == 0);
-        p_CPU->m_Flags.m_H = (l_HalfCarry > 0xF);
-        p_CPU->m_Flags.m_C = (l_Result > 0xFF);
-    }
-    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
-    {
-        uint16_t l_HalfCarry = ((l_Accumulator & 0xFFF) + (l_Addend & 0xFFF) + l_Carry);
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFFFF) == 0);
-        p_CPU->m_Flags.m_H = (l_HalfCarry > 0xFFF);
-        p_CPU->m_Flags.m_C = (l_Result > 0xFFFF);
-    }
-    else
-    {
-        uint32_t l_HalfCarry = ((l_Accumulator & 0xFFFFFFF) + (l_Addend & 0xFFFFFFF) + l_Carry);
-        p_CPU->m_Flags.m_Z = (l_Result & 0xFFFFFFFF) == 0;
-        p_CPU->m_Flags.m_H = (l_HalfCarry > 0xFFFFFFF);
-        p_CPU->m_Flags.m_C = (l_Result > 0xFFFFFFFF);
-    }
+    TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result & 0xFFFFFFFF);
 
-    // Regardless, clear the negative flag as there is no subtraction involved.
-    p_CPU->m_Flags.m_N = false;
+    // Defer setting the flags register, which depends on the size of the destination register.
+    TM_DeferFlags(p_CPU, TM_DF_ADD, TM_GetDestinationSize(p_CPU), l_Accumulator, l_Addend, l_Carry);
 
     return true;
 }
@@ -1537,43 +2040,23 @@ static bool TM_Execute_SUB (TM_CPU* p_CPU, bool p_WithCarry)
 
     // Get the values of the accumulator register, the memory data register and, if `p_WithCarry` is
     // `true`, the value of the carry flag.
-    uint32_t l_Accumulator = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    uint32_t l_Accumulator = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
     uint32_t l_Subtractend = p_CPU->m_MD;
-    uint8_t  l_Carry = (p_WithCarry == true) ? p_CPU->m_Flags.m_C : 0;
+    uint8_t  l_Carry = 0;
+    if (p_WithCarry == true)
+    {
+        TM_ResolveFlags(p_CPU);
+        l_Carry = p_CPU->m_Flags.m_C;
+    }
 
     // Subtract the subtractend and carry from the accumulator. Store the result in a signed 64-bit
     // integer in case of underflow. Store the result in the destination register.
     int64_t l_Result = l_Accumulator - l_Subtractend - l_Carry;
-    TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result & 0xFFFFFFFF);
-
-    // Set the flags register based on the size of the destination register.
-    //
-    // To properly set the half-carry flag, an additional subtraction is performed on all but the
-    // leftmost bits of the above-calculated operands.
-    if ((p_CPU->m_IP1 & 0b11) >= 2)
-    {
-        int8_t l_HalfCarry = ((l_Accumulator & 0xF) - (l_Subtractend & 0xF) - l_Carry);
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFF) == 0);
-        p_CPU->m_Flags.m_H = (l_HalfCarry < 0);
-        p_CPU->m_Flags.m_C = (l_Result < 0);
-    }
-    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
-    {
-        int16_t l_HalfCarry = ((l_Accumulator & 0xFFF) - (l_Subtractend & 0xFFF) - l_Carry);
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFFFF) == 0);
-        p_CPU->m_Flags.m_H = (l_HalfCarry < 0);
-        p_CPU->m_Flags.m_C = (l_Result < 0);
-    }
-    else
-    {
-        int32_t l_HalfCarry = ((l_Accumulator & 0xFFFFFFF) - (l_Subtractend & 0xFFFFFFF) - l_Carry);
-        p_CPU->m_Flags.m_Z = (l_Result & 0xFFFFFFFF) == 0;
-        p_CPU->m_Flags.m_H = (l_HalfCarry < 0);
-        p_CPU->m_Flags.m_C = (l_Result < 0);
-    }
+    TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result & 0xFFFFFFFF);
 
-    // Regardless, set the negative flag as there is a subtraction involved.
-    p_CPU->m_Flags.m_N = true;
+    // Defer setting the flags register, which depends on the size of the destination register.
+    TM_DeferFlags(p_CPU, TM_DF_SUB, TM_GetDestinationSize(p_CPU), l_Accumulator, l_Subtractend,
+        l_Carry);
 
     return true;
 }
@@ -1591,33 +2074,16 @@ static bool TM_Execute_AND (TM_CPU* p_CPU)
     }
 
     // Get the value of the accumulator register and the memory data register.
-    uint32_t l_Accumulator = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    uint32_t l_Accumulator = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
     uint32_t l_Operand = p_CPU->m_MD;
 
     // Perform a bitwise AND operation on the two values. Store the result in the destination
     // register.
     uint32_t l_Result = l_Accumulator & l_Operand;
-    TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
-
-    // Set the flags register based on either the size of the destination register or whether the
-    // destination address flag is set.
-    if ((p_CPU->m_IP1 & 0b11) >= 2)
-    {
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFF) == 0);
-    }
-    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
-    {
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFFFF) == 0);
-    }
-    else
-    {
-        p_CPU->m_Flags.m_Z = (l_Result == 0);
-    }
+    TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
 
-    // Regardless, set the half-carry flag and clear the subtraction and carry flags.
-    p_CPU->m_Flags.m_H = true;
-    p_CPU->m_Flags.m_N = false;
-    p_CPU->m_Flags.m_C = false;
+    // Defer setting the flags register, which depends on the size of the destination register.
+    TM_DeferFlags(p_CPU, TM_DF_AND, TM_GetDestinationSize(p_CPU), l_Result, 0, 0);
 
     return true;
 }
@@ -1635,32 +2101,16 @@ static bool TM_Execute_OR (TM_CPU* p_CPU)
     }
 
     // Get the value of the accumulator register and the memory data register.
-    uint32_t l_Accumulator = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    uint32_t l_Accumulator = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
     uint32_t l_Operand = p_CPU->m_MD;
 
     // Perform a bitwise OR operation on the two values. Store the result in the destination
     // register.
     uint32_t l_Result = l_Accumulator | l_Operand;
-    TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+    TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
 
-    // Set the flags register based on the size of the destination register.
-    if ((p_CPU->m_IP1 & 0b11) >= 2)
-    {
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFF) == 0);
-    }
-    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
-    {
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFFFF) == 0);
-    }
-    else
-    {
-        p_CPU->m_Flags.m_Z = (l_Result == 0);
-    }
-
-    // Regardless, clear the negative, half-carry and carry flags.
-    p_CPU->m_Flags.m_N = false;
-    p_CPU->m_Flags.m_H = false;
-    p_CPU->m_Flags.m_C = false;
+    // Defer setting the flags register, which depends on the size of the destination register.
+    TM_DeferFlags(p_CPU, TM_DF_LOGIC, TM_GetDestinationSize(p_CPU), l_Result, 0, 0);
 
     return true;
 }
@@ -1678,32 +2128,16 @@ static bool TM_Execute_XOR (TM_CPU* p_CPU)
     }
 
     // Get the value of the accumulator register and the memory data register.
-    uint32_t l_Accumulator = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    uint32_t l_Accumulator = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
     uint32_t l_Operand = p_CPU->m_MD;
 
     // Perform a bitwise XOR operation on the two values. Store the result in the destination
     // register.
     uint32_t l_Result = l_Accumulator ^ l_Operand;
-    TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
-
-    // Set the flags register based on the size of the destination register.
-    if ((p_CPU->m_IP1 & 0b11) >= 2)
-    {
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFF) == 0);
-    }
-    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
-    {
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFFFF) == 0);
-    }
-    else
-    {
-        p_CPU->m_Flags.m_Z = (l_Result == 0);
-    }
+    TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
 
-    // Regardless, clear the negative, half-carry and carry flags.
-    p_CPU->m_Flags.m_N = false;
-    p_CPU->m_Flags.m_H = false;
-    p_CPU->m_Flags.m_C = false;
+    // Defer setting the flags register, which depends on the size of the destination register.
+    TM_DeferFlags(p_CPU, TM_DF_LOGIC, TM_GetDestinationSize(p_CPU), l_Result, 0, 0);
 
     return true;
 }
@@ -1721,6 +2155,7 @@ static bool TM_Execute_NOT (TM_CPU* p_CPU)
     // Otherwise, write the result back to the destination register.
     if (p_CPU->m_DA == true)
     {
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Result & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -1730,9 +2165,11 @@ static bool TM_Execute_NOT (TM_CPU* p_CPU)
     }
     else
     {
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the flags register based on either the size of the destination register or whether the
     // destination address flag is set.
     if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
@@ -1771,41 +2208,12 @@ static bool TM_Execute_CMP (TM_CPU* p_CPU)
     }
 
     // Get the values of the accumulator register and the memory data register.
-    uint32_t l_Accumulator = TM_GetRegister(p_CPU, p_CPU->m_IP1);
+    uint32_t l_Accumulator = TM_ReadRegister(p_CPU, p_CPU->m_IP1);
     uint32_t l_Subtractend = p_CPU->m_MD;
 
-    // Subtract the subtractend from the accumulator. Store the result in a signed 64-bit integer
-    // in case of underflow.
-    int64_t l_Result = l_Accumulator - l_Subtractend;
-
-    // Set the flags register based on the size of the destination register.
-    //
-    // To properly set the half-carry flag, an additional subtraction is performed on all but the
-    // leftmost bits of the above-calculated operands.
-    if ((p_CPU->m_IP1 & 0b11) >= 2)
-    {
-        int8_t l_HalfCarry = ((l_Accumulator & 0xF) - (l_Subtractend & 0xF));
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFF) == 0);
-        p_CPU->m_Flags.m_H = (l_HalfCarry < 0);
-        p_CPU->m_Flags.m_C = (l_Result < 0);
-    }
-    else if ((p_CPU->m_IP1 & 0b11) == 0b01)
-    {
-        int16_t l_HalfCarry = ((l_Accumulator & 0xFFF) - (l_Subtractend & 0xFFF));
-        p_CPU->m_Flags.m_Z = ((l_Result & 0xFFFF) == 0);
-        p_CPU->m_Flags.m_H = (l_HalfCarry < 0);
-        p_CPU->m_Flags.m_C = (l_Result < 0);
-    }
-    else
-    {
-        int32_t l_HalfCarry = ((l_Accumulator & 0xFFFFFFF) - (l_Subtractend & 0xFFFFFFF));
-        p_CPU->m_Flags.m_Z = (l_Result & 0xFFFFFFFF) == 0;
-        p_CPU->m_Flags.m_H = (l_HalfCarry < 0);
-        p_CPU->m_Flags.m_C = (l_Result < 0);
-    }
-
-    // Regardless, set the negative flag as there is a subtraction involved.
-    p_CPU->m_Flags.m_N = true;
+    // Defer setting the flags register, which depends on the size of the destination register and
+    // the result of subtracting the subtractend from the accumulator.
+    TM_DeferFlags(p_CPU, TM_DF_SUB, TM_GetDestinationSize(p_CPU), l_Accumulator, l_Subtractend, 0);
 
     return true;
 }
@@ -1826,6 +2234,7 @@ static bool TM_Execute_SLA (TM_CPU* p_CPU)
     // Otherwise, write the result back to the destination register.
     if (p_CPU->m_DA == true)
     {
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Result & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -1835,9 +2244,11 @@ static bool TM_Execute_SLA (TM_CPU* p_CPU)
     }
     else
     {
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the flags register based on either the size of the destination register or whether the
     // destination address flag is set.
     if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
@@ -1879,6 +2290,7 @@ static bool TM_Execute_SRA (TM_CPU* p_CPU)
         // Before writing the result, make sure bit 7 is set to bit 7 of the original value.
         l_Result |= (p_CPU->m_MD & 0x80);
 
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Result & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -1903,9 +2315,11 @@ static bool TM_Execute_SRA (TM_CPU* p_CPU)
             l_Result |= (p_CPU->m_MD & 0x80000000);
         }
 
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the flags register based on either the size of the destination register or whether the
     // destination address flag is set.
     if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
@@ -1945,6 +2359,7 @@ static bool TM_Execute_SRL (TM_CPU* p_CPU)
         // Before writing the result, make sure bit 7 is set to 0.
         l_Result &= 0x7F;
 
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Result & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -1969,9 +2384,11 @@ static bool TM_Execute_SRL (TM_CPU* p_CPU)
             l_Result &= 0x7FFFFFFF;
         }
 
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the flags register based on either the size of the destination register or whether the
     // destination address flag is set.
     if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
@@ -1999,6 +2416,8 @@ static bool TM_Execute_SRL (TM_CPU* p_CPU)
 // 0x670Y RL [Y]
 static bool TM_Execute_RL (TM_CPU* p_CPU)
 {
+    TM_ResolveFlags(p_CPU);
+
     // Shift the value in the memory data register left by one bit. Store the result.
     uint32_t l_Result = (p_CPU->m_MD << 1) | p_CPU->m_Flags.m_C;
 
@@ -2008,6 +2427,7 @@ static bool TM_Execute_RL (TM_CPU* p_CPU)
     // Otherwise, write the result back to the destination register.
     if (p_CPU->m_DA == true)
     {
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Result & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -2017,7 +2437,7 @@ static bool TM_Execute_RL (TM_CPU* p_CPU)
     }
     else
     {
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
     }
 
     // Set the flags register based on either the size of the destination register or whether the
@@ -2061,6 +2481,7 @@ static bool TM_Execute_RLC (TM_CPU* p_CPU)
         // Before writing the result, make sure bit 7 is set to bit 7 of the original value.
         l_Result |= (p_CPU->m_MD & 0x80);
 
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Result & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -2085,9 +2506,11 @@ static bool TM_Execute_RLC (TM_CPU* p_CPU)
             l_Result |= (p_CPU->m_MD & 0x80000000);
         }
 
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the flags register based on either the size of the destination register or whether the
     // destination address flag is set.
     if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
@@ -2120,6 +2543,8 @@ static bool TM_Execute_RR (TM_CPU* p_CPU)
     // Shift the value in the memory data register right by one bit. Store the result.
     uint32_t l_Result = (p_CPU->m_MD >> 1);
 
+    TM_ResolveFlags(p_CPU);
+
     // If the destination address flag is set, then write the result back to the bus at the address
     // in the memory address register.
     //
@@ -2129,6 +2554,7 @@ static bool TM_Execute_RR (TM_CPU* p_CPU)
         // Before writing the result, make sure bit 7 is set to the old carry flag.
         l_Result |= (p_CPU->m_Flags.m_C << 7);
 
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Result & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -2153,7 +2579,7 @@ static bool TM_Execute_RR (TM_CPU* p_CPU)
             l_Result |= (p_CPU->m_Flags.m_C << 31);
         }
 
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
     }
 
     // Set the flags register based on either the size of the destination register or whether the
@@ -2195,6 +2621,7 @@ static bool TM_Execute_RRC (TM_CPU* p_CPU)
         // Before writing the result, make sure bit 7 is set to bit 7 of the original value.
         l_Result |= (p_CPU->m_MD & 0x80);
 
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Result & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -2219,9 +2646,11 @@ static bool TM_Execute_RRC (TM_CPU* p_CPU)
             l_Result |= (p_CPU->m_MD & 0x80000000);
         }
 
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Result);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Result);
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the flags register based on either the size of the destination register or whether the
     // destination address flag is set.
     if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
@@ -2250,8 +2679,7 @@ static bool TM_Execute_RRC (TM_CPU* p_CPU)
 static bool TM_Execute_BIT (TM_CPU* p_CPU)
 {
     // The number of the bit to test needs to be read from immediate memory.
-    uint8_t l_Bit = TM_ReadByte(p_CPU, p_CPU->m_PC);
-    TM_AdvanceCPU(p_CPU, 1);
+    uint8_t l_Bit = TM_FetchOperand(p_CPU, 1);
 
     // Correct the bit number based on the following:
     // - If the destination address flag is set, then the range is 0-7.
@@ -2272,6 +2700,8 @@ static bool TM_Execute_BIT (TM_CPU* p_CPU)
     // The value to be tested is in the memory data register.
     uint32_t l_Value = p_CPU->m_MD;
 
+    TM_ResolveFlags(p_CPU);
+
     // If the bit is set, then set the zero flag. Otherwise, clear the zero flag.
     p_CPU->m_Flags.m_Z = ((l_Value & (1 << l_Bit)) != 0);
 
@@ -2287,8 +2717,7 @@ static bool TM_Execute_BIT (TM_CPU* p_CPU)
 static bool TM_Execute_SET (TM_CPU* p_CPU)
 {
     // The number of the bit to set needs to be read from immediate memory.
-    uint8_t l_Bit = TM_ReadByte(p_CPU, p_CPU->m_PC);
-    TM_AdvanceCPU(p_CPU, 1);
+    uint8_t l_Bit = TM_FetchOperand(p_CPU, 1);
 
     // Correct the bit number based on the following:
     // - If the destination address flag is set, then the range is 0-7.
@@ -2318,6 +2747,7 @@ static bool TM_Execute_SET (TM_CPU* p_CPU)
     // Otherwise, write the result back to the destination register.
     if (p_CPU->m_DA == true)
     {
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Value & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -2327,7 +2757,7 @@ static bool TM_Execute_SET (TM_CPU* p_CPU)
     }
     else
     {
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Value);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Value);
     }
 
     return true;
@@ -2338,8 +2768,7 @@ static bool TM_Execute_SET (TM_CPU* p_CPU)
 static bool TM_Execute_RES (TM_CPU* p_CPU)
 {
     // The number of the bit to reset needs to be read from immediate memory.
-    uint8_t l_Bit = TM_ReadByte(p_CPU, p_CPU->m_PC);
-    TM_AdvanceCPU(p_CPU, 1);
+    uint8_t l_Bit = TM_FetchOperand(p_CPU, 1);
 
     // Correct the bit number based on the following:
     // - If the destination address flag is set, then the range is 0-7.
@@ -2369,6 +2798,7 @@ static bool TM_Execute_RES (TM_CPU* p_CPU)
     // Otherwise, write the result back to the destination register.
     if (p_CPU->m_DA == true)
     {
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Value & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -2378,7 +2808,7 @@ static bool TM_Execute_RES (TM_CPU* p_CPU)
     }
     else
     {
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Value);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Value);
     }
 
     return true;
@@ -2416,6 +2846,7 @@ static bool TM_Execute_SWAP (TM_CPU* p_CPU)
     // Otherwise, write the result back to the destination register.
     if (p_CPU->m_DA == true)
     {
+        TM_SyncCPU(p_CPU, p_CPU->m_MA);
         TM_WriteByte(p_CPU, p_CPU->m_MA, l_Value & 0xFF);
         TM_CycleCPU(p_CPU, 1);
         if (p_CPU->m_EC != TM_EC_OK)
@@ -2425,9 +2856,11 @@ static bool TM_Execute_SWAP (TM_CPU* p_CPU)
     }
     else
     {
-        TM_SetRegister(p_CPU, p_CPU->m_IP1, l_Value);
+        TM_WriteRegister(p_CPU, p_CPU->m_IP1, l_Value);
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the flags register based on either the size of the destination register or whether the
     // destination address flag is set.
     if (p_CPU->m_DA == true || (p_CPU->m_IP1 & 0b11) >= 2)
@@ -2450,352 +2883,1890 @@ static bool TM_Execute_SWAP (TM_CPU* p_CPU)
     return true;
 }
 
-// Public Functions ////////////////////////////////////////////////////////////////////////////////
-
-TM_CPU* TM_CreateCPU (TM_BusRead p_BusRead, TM_BusWrite p_BusWrite, TM_Cycle p_Cycle)
+// Private Functions - Instruction Dispatch ////////////////////////////////////////////////////////
+
+// The TM CPU's opcode table. Each entry pairs an 8-bit opcode, in hexadecimal, with the handler
+// which carries out the instruction: the fetch function for the instruction's addressing mode, if
+// any, fused with the execute function for its operation. The execute function only runs if the
+// fetch function succeeds.
+//
+// Both dispatch cores below are generated from this table, so it is the only place where an
+// opcode needs to be added.
+#define TM_OPCODE_TABLE(X) \
+    X(00, TM_Execute_NOP(p_CPU)) \
+    X(01, TM_Execute_STOP(p_CPU)) \
+    X(02, TM_Execute_HALT(p_CPU)) \
+    X(03, TM_Execute_SEC(p_CPU)) \
+    X(04, TM_Execute_CEC(p_CPU)) \
+    X(05, TM_Execute_DI(p_CPU)) \
+    X(06, TM_Execute_EI(p_CPU)) \
+    X(07, TM_Execute_DAA(p_CPU)) \
+    X(08, TM_Execute_SCF(p_CPU)) \
+    X(09, TM_Execute_CCF(p_CPU)) \
+    X(10, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_LD(p_CPU)) \
+    X(11, TM_Fetch_REG_ADDR32(p_CPU) && TM_Execute_LD(p_CPU)) \
+    X(12, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_LD(p_CPU)) \
+    X(13, TM_Fetch_REG_ADDR16(p_CPU) && TM_Execute_LD(p_CPU)) \
+    X(14, TM_Fetch_REG_REGPTR16(p_CPU) && TM_Execute_LD(p_CPU)) \
+    X(15, TM_Fetch_REG_ADDR8(p_CPU) && TM_Execute_LD(p_CPU)) \
+    X(16, TM_Fetch_REG_REGPTR8(p_CPU) && TM_Execute_LD(p_CPU)) \
+    X(17, TM_Fetch_ADDR32_REG(p_CPU) && TM_Execute_ST(p_CPU)) \
+    X(18, TM_Fetch_REGPTR32_REG(p_CPU) && TM_Execute_ST(p_CPU)) \
+    X(19, TM_Fetch_ADDR16_REG(p_CPU) && TM_Execute_ST(p_CPU)) \
+    X(1A, TM_Fetch_REGPTR16_REG(p_CPU) && TM_Execute_ST(p_CPU)) \
+    X(1B, TM_Fetch_ADDR8_REG(p_CPU) && TM_Execute_ST(p_CPU)) \
+    X(1C, TM_Fetch_REGPTR8_REG(p_CPU) && TM_Execute_ST(p_CPU)) \
+    X(1D, TM_Execute_MV(p_CPU)) \
+    X(1E, TM_Execute_PUSH(p_CPU)) \
+    X(1F, TM_Execute_POP(p_CPU)) \
+    X(20, TM_Fetch_NULL_IMM(p_CPU) && TM_Execute_JMP(p_CPU)) \
+    X(21, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_JMP(p_CPU)) \
+    X(22, TM_Fetch_NULL_SIMM16(p_CPU) && TM_Execute_JPB(p_CPU)) \
+    X(23, TM_Fetch_NULL_IMM(p_CPU) && TM_Execute_CALL(p_CPU)) \
+    X(24, TM_Execute_RST(p_CPU)) \
+    X(25, TM_Execute_RET(p_CPU)) \
+    X(26, TM_Execute_RETI(p_CPU)) \
+    X(27, TM_Execute_JPS(p_CPU)) \
+    X(30, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_INC(p_CPU)) \
+    X(31, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_INC(p_CPU)) \
+    X(32, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_DEC(p_CPU)) \
+    X(33, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_DEC(p_CPU)) \
+    X(34, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_ADD(p_CPU, false)) \
+    X(35, TM_Fetch_REG_REG(p_CPU) && TM_Execute_ADD(p_CPU, false)) \
+    X(36, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_ADD(p_CPU, false)) \
+    X(37, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_ADD(p_CPU, true)) \
+    X(38, TM_Fetch_REG_REG(p_CPU) && TM_Execute_ADD(p_CPU, true)) \
+    X(39, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_ADD(p_CPU, true)) \
+    X(3A, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_SUB(p_CPU, false)) \
+    X(3B, TM_Fetch_REG_REG(p_CPU) && TM_Execute_SUB(p_CPU, false)) \
+    X(3C, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_SUB(p_CPU, false)) \
+    X(3D, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_SUB(p_CPU, true)) \
+    X(3E, TM_Fetch_REG_REG(p_CPU) && TM_Execute_SUB(p_CPU, true)) \
+    X(3F, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_SUB(p_CPU, true)) \
+    X(40, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_AND(p_CPU)) \
+    X(41, TM_Fetch_REG_REG(p_CPU) && TM_Execute_AND(p_CPU)) \
+    X(42, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_AND(p_CPU)) \
+    X(43, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_OR(p_CPU)) \
+    X(44, TM_Fetch_REG_REG(p_CPU) && TM_Execute_OR(p_CPU)) \
+    X(45, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_OR(p_CPU)) \
+    X(46, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_XOR(p_CPU)) \
+    X(47, TM_Fetch_REG_REG(p_CPU) && TM_Execute_XOR(p_CPU)) \
+    X(48, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_XOR(p_CPU)) \
+    X(49, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_NOT(p_CPU)) \
+    X(4A, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_NOT(p_CPU)) \
+    X(50, TM_Fetch_REG_IMM(p_CPU) && TM_Execute_CMP(p_CPU)) \
+    X(51, TM_Fetch_REG_REG(p_CPU) && TM_Execute_CMP(p_CPU)) \
+    X(52, TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_CMP(p_CPU)) \
+    X(60, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SLA(p_CPU)) \
+    X(61, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SLA(p_CPU)) \
+    X(62, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SRA(p_CPU)) \
+    X(63, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SRA(p_CPU)) \
+    X(64, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SRL(p_CPU)) \
+    X(65, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SRL(p_CPU)) \
+    X(66, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RL(p_CPU)) \
+    X(67, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RL(p_CPU)) \
+    X(68, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RLC(p_CPU)) \
+    X(69, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RLC(p_CPU)) \
+    X(6A, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RR(p_CPU)) \
+    X(6B, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RR(p_CPU)) \
+    X(6C, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RRC(p_CPU)) \
+    X(6D, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RRC(p_CPU)) \
+    X(70, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_BIT(p_CPU)) \
+    X(71, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_BIT(p_CPU)) \
+    X(72, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SET(p_CPU)) \
+    X(73, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SET(p_CPU)) \
+    X(74, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RES(p_CPU)) \
+    X(75, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RES(p_CPU)) \
+    X(76, TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SWAP(p_CPU)) \
+    X(77, TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SWAP(p_CPU))
+
+// Threaded dispatch jumps straight from the end of one handler to the start of the next through a
+// table of label addresses, giving each handler its own indirect branch. It depends on the "labels
+// as values" extension, so it is only used where the compiler supports it. Define
+// `TM_NO_THREADED_DISPATCH` to force the portable `switch`-based dispatch core.
+#if !defined(TM_NO_THREADED_DISPATCH) && (defined(__GNUC__) || defined(__clang__))
+    #define TM_THREADED_DISPATCH
+#endif
+
+void TM_WaitForInterrupt (TM_CPU* p_CPU)
 {
-    // Ensure the given function pointers are valid.
-    if (p_BusRead == NULL || p_BusWrite == NULL || p_Cycle == NULL)
-    {
-        fprintf(stderr, "TM: Cannot create CPU instance - missing or invalid function pointers.\n");
-        return NULL;
-    }
+    assert(p_CPU != NULL);
 
-    // Allocate memory for the CPU instance.
-    TM_CPU* l_CPU = (TM_CPU*) calloc(1, sizeof(TM_CPU));
-    if (l_CPU == NULL)
+    // Work out how many cycles to wait. If an interrupt is already requested, then one cycle is
+    // enough. Otherwise, skip ahead to the next event which could request one, if the owner of the
+    // bus can say when that is, but never past the end of the cycle budget.
+    uint32_t l_Cycles = 1;
+    if (p_CPU->m_NextEvent != NULL && p_CPU->m_IF == 0)
     {
-        perror("TM: Failed to allocate memory for the CPU instance");
-        return NULL;
+        l_Cycles = p_CPU->m_NextEvent(p_CPU->m_Context);
+        if (l_Cycles == 0)
+        {
+            l_Cycles = 1;
+        }
+
+        if (p_CPU->m_CycleCount < p_CPU->m_CycleTarget &&
+            p_CPU->m_CycleTarget - p_CPU->m_CycleCount < l_Cycles)
+        {
+            l_Cycles = (uint32_t) (p_CPU->m_CycleTarget - p_CPU->m_CycleCount);
+        }
     }
 
-    // Initialize the CPU instance and set the function pointers.
-    TM_ResetCPU(l_CPU);
-    l_CPU->m_BusRead = p_BusRead;
-    l_CPU->m_BusWrite = p_BusWrite;
-    l_CPU->m_Cycle = p_Cycle;
+    // Cycle the CPU, then un-halt the CPU if an interrupt is requested.
+    TM_CycleCPU(p_CPU, l_Cycles);
+    TM_FlushCPUCycles(p_CPU);
+    p_CPU->m_Halt = (p_CPU->m_IF == 0);
 
-    return l_CPU;
+    TM_ProcessInterrupts(p_CPU);
 }
 
-void TM_ResetCPU (TM_CPU* p_CPU)
+bool TM_IsDispatchInterrupted (const TM_CPU* p_CPU)
 {
-    // Ensure the given CPU instance is valid.
-    if (p_CPU == NULL)
-    {
-        fprintf(stderr, "TM: Cannot reset CPU instance - invalid CPU instance.\n");
-        return;
-    }
-    
-    // Reset the general-purpose registers.
-    p_CPU->m_A = 0;
-    p_CPU->m_B = 0;
-    p_CPU->m_C = 0;
-    p_CPU->m_E = 0;
+    assert(p_CPU != NULL);
 
-    // Reset the fixed-point registers.
-    p_CPU->m_FI = 0;
-    p_CPU->m_FF = 0;
+    // Dispatch stops once the CPU halts or stops, once the cycle budget of a call to `TM_RunCPU`
+    // is spent, or once a break is requested.
+    return
+        p_CPU->m_Halt == true ||
+        p_CPU->m_Stop == true ||
+        p_CPU->m_CycleCount >= p_CPU->m_CycleTarget ||
+        p_CPU->m_Break == true;
+}
 
-    // Reset the program counter and stack pointers.
-    p_CPU->m_PC = TM_CODE_BEGIN;
-    p_CPU->m_DSP = 0xFFFC;
-    p_CPU->m_CSP = 0xFFFC;
+bool TM_BeginInstruction (TM_CPU* p_CPU)
+{
+    assert(p_CPU != NULL);
 
-    // Reset the internal memory registers.
+    // Reset the memory registers.
     p_CPU->m_MD = 0;
     p_CPU->m_MA = 0;
     p_CPU->m_DA = false;
 
-    // Reset the internal instruction registers.
-    p_CPU->m_IA = 0;
-    p_CPU->m_CI = 0;
-    p_CPU->m_OC = 0;
-    p_CPU->m_IP1 = 0;
-    p_CPU->m_IP2 = 0;
+    // Copy the program counter to the instruction address register. Make sure the address is
+    // within the executable bounds of the CPU's memory map.
+    p_CPU->m_IA = p_CPU->m_PC;
+    if (TM_IsExecutable(p_CPU->m_IA) == false)
+    {
+        TM_SetErrorCode(p_CPU, TM_EC_BAD_EXECUTE);
+        p_CPU->m_EA = p_CPU->m_IA;
 
-    // Reset the interrupt registers.
-    p_CPU->m_IE = 0;
-    p_CPU->m_IF = 0;
-    p_CPU->m_IME = false;
-    p_CPU->m_EI = false;
+        TM_error("Attempted to execute non-executable memory at address $%08X.", p_CPU->m_EA);
+        return false;
+    }
 
-    // Reset the error registers.
-    p_CPU->m_EA = 0;
-    p_CPU->m_EC = TM_EC_OK;
+    // If the instruction has been translated into a block before, then take its opcode from there.
+    // Otherwise, read the instruction's 16-bit opcode from the bus at the instruction address, and
+    // translate it into a block as it executes.
+    p_CPU->m_Decoded = TM_FindDecodedInstruction(p_CPU, p_CPU->m_IA);
+    if (p_CPU->m_Decoded != NULL)
+    {
+        TM_EndTranslation(p_CPU);
+        p_CPU->m_CI = p_CPU->m_Decoded->m_CI;
+    }
+    else
+    {
+        p_CPU->m_CI = TM_ReadWord(p_CPU, p_CPU->m_IA);
+        TM_BeginTranslation(p_CPU, p_CPU->m_IA);
+        p_CPU->m_Decoding->m_CI = p_CPU->m_CI;
+    }
 
-    // Reset the halt and stop flags.
-    p_CPU->m_Halt = false;
-    p_CPU->m_Stop = false;
+    TM_AdvanceCPU(p_CPU, 2);
 
-    // Reset the flags register.
-    p_CPU->m_Flags.m_Register = 0;
+    // Decode the instruction's 8-bit opcode and parameters.
+    p_CPU->m_OC = (p_CPU->m_CI >> 8) & 0xFF;
+    p_CPU->m_IP1 = (p_CPU->m_CI >> 4) & 0x0F;
+    p_CPU->m_IP2 = (p_CPU->m_CI >> 0) & 0x0F;
+
+    return true;
 }
 
-void TM_DestroyCPU (TM_CPU* p_CPU)
+void TM_EndInstruction (TM_CPU* p_CPU)
 {
-    // Do nothing if the CPU instance is NULL.
-    if (p_CPU == NULL)
+    assert(p_CPU != NULL);
+
+    // If the instruction was translated as it executed, and its block was not invalidated along
+    // the way, then add it to its block. The block is finished if the instruction may transfer
+    // control elsewhere, or if the block is full.
+    if (p_CPU->m_Decoding != NULL)
     {
-        return;
+        TM_BasicBlock* l_Block = p_CPU->m_Translating;
+        l_Block->m_Length++;
+        l_Block->m_EndAddress = p_CPU->m_Decoding->m_Address + 2 + p_CPU->m_Decoding->m_OperandSize;
+        p_CPU->m_Decoding = NULL;
+
+        if ((p_CPU->m_OC >= 0x20 && p_CPU->m_OC <= 0x27) || l_Block->m_Length >= TM_MAX_BLOCK_LENGTH)
+        {
+            TM_EndTranslation(p_CPU);
+        }
     }
 
-    // Free the memory allocated for the CPU instance.
-    free(p_CPU);
-    p_CPU = NULL;
+    // If an instruction could not be translated, then finish its block without it.
+    else if (p_CPU->m_Translating != NULL && p_CPU->m_Decoded == NULL)
+    {
+        TM_EndTranslation(p_CPU);
+    }
+
+    p_CPU->m_Decoded = NULL;
 }
 
-void TM_CycleCPU (TM_CPU* p_CPU, uint32_t p_Cycles)
+bool TM_HandleInvalidOpcode (TM_CPU* p_CPU)
 {
-    // Ensure the given CPU instance, and its cycle function pointer, are valid.
-    if (p_CPU == NULL || p_CPU->m_Cycle == NULL)
-    {
-        fprintf(stderr, "TM: Cannot cycle CPU instance - invalid CPU instance or cycle function pointer.\n");
-        return;
-    }
+    assert(p_CPU != NULL);
 
-    // Cycle the CPU for the specified number of cycles.
-    for (uint32_t i = 0; i < p_Cycles; ++i)
-    {
-        if (p_CPU->m_Cycle(p_Cycles) == false)
-        {
-            TM_SetErrorCode(p_CPU, TM_EC_HARDWARE_FAULT);
-            return;
-        }
-    }
+    TM_SetErrorCode(p_CPU, TM_EC_INVALID_OPCODE);
+    p_CPU->m_EA = p_CPU->m_IA;
+
+    TM_error("Invalid opcode 0x%02X encountered at address $%08X.", p_CPU->m_OC, p_CPU->m_IA);
+    return false;
 }
 
-bool TM_StepCPU (TM_CPU* p_CPU)
+void TM_ProcessInterrupts (TM_CPU* p_CPU)
 {
-    // Ensure the given CPU instance is valid.
-    if (p_CPU == NULL)
-    {
-        fprintf(stderr, "TM: Cannot step CPU instance - invalid CPU instance.\n");
-        return false;
-    }
+    assert(p_CPU != NULL);
 
-    // If the CPU is stopped, do nothing.
-    if (p_CPU->m_Stop)
+    // If the interrupt master enable flag is set, service a pending interrupt, if there is one.
+    if (p_CPU->m_IME == true)
     {
-        return false;
+        TM_ServiceInterrupt(p_CPU);
+        TM_FlushCPUCycles(p_CPU);
     }
 
-    // If the CPU is halted, wait for an interrupt to be requested.
-    // Otherwise, process the next instruction.
-    if (p_CPU->m_Halt == true)
+    // If the interrupt master enable flag is to be set, then set it here.
+    if (p_CPU->m_EI == true)
     {
-        // Cycle the CPU, then un-halt the CPU if an interrupt is requested.
-        TM_CycleCPU(p_CPU, 1);
-        p_CPU->m_Halt = (p_CPU->m_IF == 0);
+        p_CPU->m_IME = true;
+        p_CPU->m_EI = false;
     }
-    else
-    {
-        // Reset the memory registers.
-        p_CPU->m_MD = 0;
-        p_CPU->m_MA = 0;
-        p_CPU->m_DA = false;
+}
 
-        // Copy the program counter to the instruction address register. Make sure the address is
-        // within the executable bounds of the CPU's memory map.
-        p_CPU->m_IA = p_CPU->m_PC;
-        if (TM_IsExecutable(p_CPU->m_IA) == false)
-        {
-            TM_SetErrorCode(p_CPU, TM_EC_BAD_EXECUTE);
-            p_CPU->m_EA = p_CPU->m_IA;
+bool TM_DispatchCPU (TM_CPU* p_CPU, uint32_t p_Limit, uint32_t* p_Retired)
+{
+    assert(p_CPU != NULL);
 
-            TM_error("Attempted to execute non-executable memory at address $%08X.", p_CPU->m_EA);
-            return false;
+    // Executes instructions until the given number have been retired, the CPU halts or stops, or
+    // an instruction fails. Each instruction is fetched and executed by its opcode's handler, after
+    // which the other components on the bus are brought up to date and interrupts are processed.
+    uint32_t l_Retired = 0;
+    bool l_Good = false;
+
+#if defined(TM_THREADED_DISPATCH)
+
+    #define TM_DISPATCH_LABEL(p_Opcode, p_Handler) \
+        [0x##p_Opcode] = &&TM_Handler_##p_Opcode,
+
+    // Opcodes with no handler jump to the invalid opcode handler. Every entry is first set to that
+    // handler, then overridden by the opcode table; the overrides are deliberate.
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Woverride-init"
+    static const void* s_DispatchTable[256] = {
+        [0x00 ... 0xFF] = &&TM_Handler_Invalid,
+        TM_OPCODE_TABLE(TM_DISPATCH_LABEL)
+    };
+    #pragma GCC diagnostic pop
+
+    #define TM_DISPATCH_NEXT() \
+        if (p_CPU->m_JITEnabled == true && TM_RunCompiledCode(p_CPU, p_Limit, &l_Retired) == false) \
+        { \
+            goto TM_Failed; \
+        } \
+        if (l_Retired >= p_Limit || TM_IsDispatchInterrupted(p_CPU) == true) \
+        { \
+            goto TM_Finished; \
+        } \
+        if (TM_BeginInstruction(p_CPU) == false) \
+        { \
+            goto TM_Failed; \
+        } \
+        goto *s_DispatchTable[p_CPU->m_OC];
+
+    #define TM_DISPATCH_HANDLER(p_Opcode, p_Handler) \
+        TM_Handler_##p_Opcode: \
+            l_Good = (p_Handler); \
+            TM_FlushCPUCycles(p_CPU); \
+            if (l_Good == false) \
+            { \
+                goto TM_Failed; \
+            } \
+            TM_EndInstruction(p_CPU); \
+            TM_ProcessInterrupts(p_CPU); \
+            l_Retired++; \
+            TM_DISPATCH_NEXT()
+
+    TM_DISPATCH_NEXT()
+    TM_OPCODE_TABLE(TM_DISPATCH_HANDLER)
+
+TM_Handler_Invalid:
+    TM_HandleInvalidOpcode(p_CPU);
+    TM_FlushCPUCycles(p_CPU);
+    goto TM_Failed;
+
+    #undef TM_DISPATCH_HANDLER
+    #undef TM_DISPATCH_NEXT
+    #undef TM_DISPATCH_LABEL
+
+#else
+
+    #define TM_DISPATCH_CASE(p_Opcode, p_Handler) \
+        case 0x##p_Opcode: l_Good = (p_Handler); break;
+
+    while (true)
+    {
+        if (p_CPU->m_JITEnabled == true && TM_RunCompiledCode(p_CPU, p_Limit, &l_Retired) == false)
+        {
+            goto TM_Failed;
         }
 
-        // Read the instruction's 16-bit opcode from the bus at the instruction address.
-        p_CPU->m_CI = TM_ReadWord(p_CPU, p_CPU->m_IA);
-        TM_AdvanceCPU(p_CPU, 2);
+        if (l_Retired >= p_Limit || TM_IsDispatchInterrupted(p_CPU) == true)
+        {
+            break;
+        }
 
-        // Decode the instruction's 8-bit opcode and parameters.
-        p_CPU->m_OC = (p_CPU->m_CI >> 8) & 0xFF;
-        p_CPU->m_IP1 = (p_CPU->m_CI >> 4) & 0x0F;
-        p_CPU->m_IP2 = (p_CPU->m_CI >> 0) & 0x0F;
+        if (TM_BeginInstruction(p_CPU) == false)
+        {
+            goto TM_Failed;
+        }
 
-        // Depending upon the opcode and parameters, fetch the necessary data from the bus, then
-        // execute the instruction.
-        bool l_Good = false;
         switch (p_CPU->m_OC)
         {
-            case 0x00: l_Good = TM_Execute_NOP(p_CPU); break;
-            case 0x01: l_Good = TM_Execute_STOP(p_CPU); break;
-            case 0x02: l_Good = TM_Execute_HALT(p_CPU); break;
-            case 0x03: l_Good = TM_Execute_SEC(p_CPU); break;
-            case 0x04: l_Good = TM_Execute_CEC(p_CPU); break;
-            case 0x05: l_Good = TM_Execute_DI(p_CPU); break; 
-            case 0x06: l_Good = TM_Execute_EI(p_CPU); break;
-            case 0x07: l_Good = TM_Execute_DAA(p_CPU); break;
-            case 0x08: l_Good = TM_Execute_SCF(p_CPU); break;
-            case 0x09: l_Good = TM_Execute_CCF(p_CPU); break;
-            case 0x10: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_LD(p_CPU); break;
-            case 0x11: l_Good = TM_Fetch_REG_ADDR32(p_CPU) && TM_Execute_LD(p_CPU); break;
-            case 0x12: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_LD(p_CPU); break;
-            case 0x13: l_Good = TM_Fetch_REG_ADDR16(p_CPU) && TM_Execute_LD(p_CPU); break;
-            case 0x14: l_Good = TM_Fetch_REG_REGPTR16(p_CPU) && TM_Execute_LD(p_CPU); break;
-            case 0x15: l_Good = TM_Fetch_REG_ADDR8(p_CPU) && TM_Execute_LD(p_CPU); break;
-            case 0x16: l_Good = TM_Fetch_REG_REGPTR8(p_CPU) && TM_Execute_LD(p_CPU); break;
-            case 0x17: l_Good = TM_Fetch_ADDR32_REG(p_CPU) && TM_Execute_ST(p_CPU); break;
-            case 0x18: l_Good = TM_Fetch_REGPTR32_REG(p_CPU) && TM_Execute_ST(p_CPU); break;
-            case 0x19: l_Good = TM_Fetch_ADDR16_REG(p_CPU) && TM_Execute_ST(p_CPU); break;
-            case 0x1A: l_Good = TM_Fetch_REGPTR16_REG(p_CPU) && TM_Execute_ST(p_CPU); break;
-            case 0x1B: l_Good = TM_Fetch_ADDR8_REG(p_CPU) && TM_Execute_ST(p_CPU); break;
-            case 0x1C: l_Good = TM_Fetch_REGPTR8_REG(p_CPU) && TM_Execute_ST(p_CPU); break;
-            case 0x1D: l_Good = TM_Execute_MV(p_CPU); break;
-            case 0x1E: l_Good = TM_Execute_PUSH(p_CPU); break;
-            case 0x1F: l_Good = TM_Execute_POP(p_CPU); break;
-            case 0x20: l_Good = TM_Fetch_NULL_IMM(p_CPU) && TM_Execute_JMP(p_CPU); break;
-            case 0x21: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_JMP(p_CPU); break;
-            case 0x22: l_Good = TM_Fetch_NULL_SIMM16(p_CPU) && TM_Execute_JPB(p_CPU); break;
-            case 0x23: l_Good = TM_Fetch_NULL_IMM(p_CPU) && TM_Execute_CALL(p_CPU); break;
-            case 0x24: l_Good = TM_Execute_RST(p_CPU); break;
-            case 0x25: l_Good = TM_Execute_RET(p_CPU); break;
-            case 0x26: l_Good = TM_Execute_RETI(p_CPU); break;
-            case 0x27: l_Good = TM_Execute_JPS(p_CPU); break;
-            case 0x30: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_INC(p_CPU); break;
-            case 0x31: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_INC(p_CPU); break;
-            case 0x32: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_DEC(p_CPU); break;
-            case 0x33: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_DEC(p_CPU); break;
-            case 0x34: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_ADD(p_CPU, false); break;
-            case 0x35: l_Good = TM_Fetch_REG_REG(p_CPU) && TM_Execute_ADD(p_CPU, false); break;
-            case 0x36: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_ADD(p_CPU, false); break;
-            case 0x37: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_ADD(p_CPU, true); break;
-            case 0x38: l_Good = TM_Fetch_REG_REG(p_CPU) && TM_Execute_ADD(p_CPU, true); break;
-            case 0x39: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_ADD(p_CPU, true); break;
-            case 0x3A: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_SUB(p_CPU, false); break;
-            case 0x3B: l_Good = TM_Fetch_REG_REG(p_CPU) && TM_Execute_SUB(p_CPU, false); break;
-            case 0x3C: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_SUB(p_CPU, false); break;
-            case 0x3D: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_SUB(p_CPU, true); break;
-            case 0x3E: l_Good = TM_Fetch_REG_REG(p_CPU) && TM_Execute_SUB(p_CPU, true); break;
-            case 0x3F: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_SUB(p_CPU, true); break;
-            case 0x40: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_AND(p_CPU); break;
-            case 0x41: l_Good = TM_Fetch_REG_REG(p_CPU) && TM_Execute_AND(p_CPU); break;
-            case 0x42: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_AND(p_CPU); break;
-            case 0x43: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_OR(p_CPU); break;
-            case 0x44: l_Good = TM_Fetch_REG_REG(p_CPU) && TM_Execute_OR(p_CPU); break;
-            case 0x45: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_OR(p_CPU); break;
-            case 0x46: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_XOR(p_CPU); break;
-            case 0x47: l_Good = TM_Fetch_REG_REG(p_CPU) && TM_Execute_XOR(p_CPU); break;
-            case 0x48: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_XOR(p_CPU); break;
-            case 0x49: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_NOT(p_CPU); break;
-            case 0x4A: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_NOT(p_CPU); break;
-            case 0x50: l_Good = TM_Fetch_REG_IMM(p_CPU) && TM_Execute_CMP(p_CPU); break;
-            case 0x51: l_Good = TM_Fetch_REG_REG(p_CPU) && TM_Execute_CMP(p_CPU); break;
-            case 0x52: l_Good = TM_Fetch_REG_REGPTR32(p_CPU) && TM_Execute_CMP(p_CPU); break;
-            case 0x60: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SLA(p_CPU); break;
-            case 0x61: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SLA(p_CPU); break;
-            case 0x62: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SRA(p_CPU); break;
-            case 0x63: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SRA(p_CPU); break;
-            case 0x64: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SRL(p_CPU); break;
-            case 0x65: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SRL(p_CPU); break;
-            case 0x66: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RL(p_CPU); break; 
-            case 0x67: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RL(p_CPU); break;
-            case 0x68: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RLC(p_CPU); break;
-            case 0x69: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RLC(p_CPU); break;
-            case 0x6A: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RR(p_CPU); break;
-            case 0x6B: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RR(p_CPU); break;
-            case 0x6C: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RRC(p_CPU); break;
-            case 0x6D: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RRC(p_CPU); break;
-            case 0x70: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_BIT(p_CPU); break;
-            case 0x71: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_BIT(p_CPU); break;
-            case 0x72: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SET(p_CPU); break;
-            case 0x73: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SET(p_CPU); break;
-            case 0x74: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_RES(p_CPU); break;
-            case 0x75: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_RES(p_CPU); break;
-            case 0x76: l_Good = TM_Fetch_REG_NULL(p_CPU) && TM_Execute_SWAP(p_CPU); break;
-            case 0x77: l_Good = TM_Fetch_REGPTR32_NULL(p_CPU) && TM_Execute_SWAP(p_CPU); break;
-            default:
-                TM_SetErrorCode(p_CPU, TM_EC_INVALID_OPCODE);
-                p_CPU->m_EA = p_CPU->m_IA;
-
-                TM_error("Invalid opcode 0x%02X encountered at address $%08X.", p_CPU->m_OC, p_CPU->m_IA);
-                return false;
+            TM_OPCODE_TABLE(TM_DISPATCH_CASE)
+            default: l_Good = TM_HandleInvalidOpcode(p_CPU); break;
         }
 
+        TM_FlushCPUCycles(p_CPU);
         if (l_Good == false)
         {
-            return false;
+            goto TM_Failed;
         }
-    }
 
-    // If the interrupt master enable flag is set, service a pending interrupt, if there is one.
-    if (p_CPU->m_IME == true)
-    {
-        TM_ServiceInterrupt(p_CPU);
+        TM_EndInstruction(p_CPU);
+        TM_ProcessInterrupts(p_CPU);
+        l_Retired++;
     }
 
-    // If the interrupt master enable flag is to be set, then set it here.
-    if (p_CPU->m_EI == true)
-    {
-        p_CPU->m_IME = true;
-        p_CPU->m_EI = false;
-    }
+    #undef TM_DISPATCH_CASE
+
+    goto TM_Finished;
 
+#endif
+
+TM_Finished:
+    if (p_Retired != NULL) { *p_Retired = l_Retired; }
     return true;
+
+TM_Failed:
+    if (p_Retired != NULL) { *p_Retired = l_Retired; }
+    return false;
 }
 
-uint8_t TM_ReadByte (const TM_CPU* p_CPU, uint32_t p_Address)
+// Private Functions - JIT Compiler ////////////////////////////////////////////////////////////////
+
+// The JIT compiler translates hot basic blocks into x86-64 code. While compiled code runs, the
+// general-purpose registers `A`, `B`, `C` and `E` live in the host registers `rbx`, `rbp`, `r12` and
+// `r13`; `r15` holds the CPU instance, and `r14` counts down the cycles left in the current quiet
+// window (see `TM_GetQuietCycles`).
+//
+// Instructions which only move and combine registers and immediates - `NOP`, `LD` with an immediate,
+// `MV`, `INC` and `DEC` of a register, `ADD`, `ADC`, `SUB`, `SBC`, `AND`, `OR`, `XOR` and `CMP` with
+// a register or immediate operand, `JMP` and `JPB` - are translated into host instructions which work
+// on those registers directly. Their flags are deferred just as the interpreter defers them, and a
+// conditional jump whose flags were deferred earlier in the same block tests the deferred operands
+// directly, without computing the flags register.
+//
+// Every other instruction, including any which accesses the bus, is run by calling into the
+// interpreter, with the registers written back to the CPU instance beforehand and re-loaded after.
+//
+// Translated instructions hold their cycles back, rather than calling the cycle function, for as long
+// as they stay within the quiet window: the number of cycles which the owner of the bus says may pass
+// before anything could request an interrupt. Once the window runs out, the held cycles are flushed
+// and interrupts are processed exactly as the interpreter would at that instruction boundary.
+//
+// Blocks in XRAM are never compiled, since they may be overwritten. They, along with any block which
+// is not yet hot, are left to the interpreter.
+
+#if defined(TM_JIT_SUPPORTED)
+
+#define TM_JIT_MAX_LABELS           (4 * TM_MAX_BLOCK_LENGTH + 8)   ///< @brief The largest number of labels in one block's code.
+#define TM_JIT_MAX_FIXUPS           (8 * TM_MAX_BLOCK_LENGTH + 8)   ///< @brief The largest number of jumps in one block's code.
+#define TM_JIT_MAX_STUBS            (2 * TM_MAX_BLOCK_LENGTH + 2)   ///< @brief The largest number of out-of-line stubs in one block's code.
+
+typedef uint32_t (*TM_CompiledBlock) (TM_CPU*);
+
+/**
+ * @brief   Enumerates the x86-64 general-purpose registers, numbered as they are encoded.
+ */
+typedef enum TM_HostRegister
 {
-    // Ensure the given CPU instance, and its bus read function pointer, are valid.
-    if (p_CPU == NULL || p_CPU->m_BusRead == NULL)
-    {
-        fprintf(stderr, "TM: Cannot read byte from CPU instance - invalid CPU instance or bus read function pointer.\n");
-        return 0xFF;
-    }
+    TM_HR_RAX = 0, TM_HR_RCX, TM_HR_RDX, TM_HR_RBX, TM_HR_RSP, TM_HR_RBP, TM_HR_RSI, TM_HR_RDI,
+    TM_HR_R8, TM_HR_R9, TM_HR_R10, TM_HR_R11, TM_HR_R12, TM_HR_R13, TM_HR_R14, TM_HR_R15
+} TM_HostRegister;
 
-    // Read a byte from the bus at the specified address.
-    uint8_t l_Byte0 = p_CPU->m_BusRead(p_Address);
-    return l_Byte0;
-}
+/**
+ * @brief   Enumerates the x86-64 condition codes used by compiled code.
+ */
+typedef enum TM_HostCondition
+{
+    TM_HC_ALWAYS = -1,  ///< @brief Not a condition code; the jump is unconditional.
+    TM_HC_Z = 0x4,      ///< @brief Zero.
+    TM_HC_NZ = 0x5,     ///< @brief Not zero.
+    TM_HC_BE = 0x6,     ///< @brief Below or equal, unsigned.
+    TM_HC_A = 0x7,      ///< @brief Above, unsigned.
+    TM_HC_S = 0x8,      ///< @brief Sign.
+    TM_HC_LE = 0xE,     ///< @brief Less than or equal, signed.
+} TM_HostCondition;
+
+#define TM_JIT_CPU      TM_HR_R15   ///< @brief The host register holding the CPU instance.
+#define TM_JIT_WINDOW   TM_HR_R14   ///< @brief The host register counting down the quiet window.
 
-uint16_t TM_ReadWord (const TM_CPU* p_CPU, uint32_t p_Address)
+/**
+ * @brief   The host registers holding the general-purpose registers `A`, `B`, `C` and `E`. They are
+ *          all callee-saved, so they survive calls out of compiled code.
+ */
+static const uint8_t s_HostRegisters[4] = { TM_HR_RBX, TM_HR_RBP, TM_HR_R12, TM_HR_R13 };
+
+/**
+ * @brief   Describes a stub emitted out of line, after a block's main body. A retirement stub runs
+ *          once the quiet window is used up, and either renews it and resumes the block, or leaves
+ *          it; an exit stub just leaves the block.
+ */
+typedef struct TM_JITStub
 {
-    // Ensure the given CPU instance, and its bus read function pointer, are valid.
-    if (p_CPU == NULL || p_CPU->m_BusRead == NULL)
+    uint16_t    m_Label;        ///< @brief The stub's label.
+    uint16_t    m_Resume;       ///< @brief The label to resume at once the window is renewed.
+    uint32_t    m_Retired;      ///< @brief The number of the block's instructions retired if the block is left here.
+    uint32_t    m_PC;           ///< @brief The program counter to store before retiring, if `m_StorePC` is set.
+    bool        m_StorePC;      ///< @brief Whether the program counter needs storing before retiring.
+    bool        m_Retire;       ///< @brief Whether this is a retirement stub, rather than an exit stub.
+} TM_JITStub;
+
+/**
+ * @brief   Holds the state of the JIT compiler while it compiles one basic block.
+ */
+typedef struct TM_JITEmitter
+{
+    uint8_t     m_Code[TM_JIT_MAX_BLOCK_CODE];  ///< @brief The code emitted so far.
+    size_t      m_Size;                         ///< @brief The number of bytes of code emitted so far.
+    bool        m_Overflow;                     ///< @brief Set if the code did not fit in the buffer.
+    int32_t     m_Labels[TM_JIT_MAX_LABELS];    ///< @brief The offset of each label in the code, or `-1` if not yet placed.
+    uint16_t    m_LabelCount;                   ///< @brief The number of labels created.
+    uint32_t    m_Fixups[TM_JIT_MAX_FIXUPS];    ///< @brief The offset of each jump's 32-bit displacement.
+    uint16_t    m_FixupLabels[TM_JIT_MAX_FIXUPS];   ///< @brief The label each jump targets.
+    uint16_t    m_FixupCount;                   ///< @brief The number of jumps emitted.
+    TM_JITStub  m_Stubs[TM_JIT_MAX_STUBS];      ///< @brief The stubs to emit after the block's main body.
+    uint16_t    m_StubCount;                    ///< @brief The number of stubs.
+    bool        m_FlagsKnown;                   ///< @brief Whether the deferred flags operation is known at this point in the block.
+    uint8_t     m_FlagsOp;                      ///< @brief The deferred flags operation, if known.
+    uint8_t     m_FlagsSize;                    ///< @brief That operation's destination size, in bytes.
+    bool        m_FlagsCarryClear;              ///< @brief Whether that operation is known to have taken no carry in.
+} TM_JITEmitter;
+
+static int32_t TM_GetQuietCycles (TM_CPU* p_CPU)
+{
+    // Cycles can only be held back while they are being batched anyway, and only if the owner of the
+    // bus can say how soon anything could request an interrupt. There is no window at all if an
+    // interrupt is already waiting to be serviced.
+    if (
+        p_CPU->m_BatchCycles == false ||
+        p_CPU->m_NextEvent == NULL ||
+        p_CPU->m_EI == true ||
+        (p_CPU->m_IME == true && (p_CPU->m_IF & p_CPU->m_IE) != 0)
+    )
     {
-        fprintf(stderr, "TM: Cannot read word from CPU instance - invalid CPU instance or bus read function pointer.\n");
-        return 0xFFFF;
+        return 0;
     }
 
-    // Read the two bytes making up the word from the bus at the specified address. Combine them,
-    // and return the result.
-    uint16_t l_Word0 = p_CPU->m_BusRead(p_Address);
-    uint16_t l_Word1 = p_CPU->m_BusRead(p_Address + 1);
-    return (l_Word0 | (l_Word1 << 8));
+    // The window never runs past the end of the cycle budget.
+    uint64_t l_Cycles = p_CPU->m_NextEvent(p_CPU->m_Context);
+    if (p_CPU->m_CycleTarget - p_CPU->m_CycleCount < l_Cycles)
+    {
+        l_Cycles = p_CPU->m_CycleTarget - p_CPU->m_CycleCount;
+    }
+
+    return (l_Cycles > INT32_MAX) ? INT32_MAX : (int32_t) l_Cycles;
 }
 
-uint32_t TM_ReadDoubleWord (const TM_CPU* p_CPU, uint32_t p_Address)
+static bool TM_ExecuteOpcode (TM_CPU* p_CPU)
 {
-    // Ensure the given CPU instance, and its bus read function pointer, are valid.
-    if (p_CPU == NULL || p_CPU->m_BusRead == NULL)
+    #define TM_EXECUTE_CASE(p_Opcode, p_Handler) \
+        case 0x##p_Opcode: return (p_Handler);
+
+    switch (p_CPU->m_OC)
     {
-        fprintf(stderr, "TM: Cannot read double word from CPU instance - invalid CPU instance or bus read function pointer.\n");
-        return 0xFFFFFFFF;
+        TM_OPCODE_TABLE(TM_EXECUTE_CASE)
+        default: return TM_HandleInvalidOpcode(p_CPU);
     }
 
-    // Read the four bytes making up the double word from the bus at the specified address. Combine
-    // them, and return the result.
-    uint32_t l_DWord0 = p_CPU->m_BusRead(p_Address);
-    uint32_t l_DWord1 = p_CPU->m_BusRead(p_Address + 1);
-    uint32_t l_DWord2 = p_CPU->m_BusRead(p_Address + 2);
-    uint32_t l_DWord3 = p_CPU->m_BusRead(p_Address + 3);
-    return (l_DWord0 | (l_DWord1 << 8) | (l_DWord2 << 16) | (l_DWord3 << 24));
+    #undef TM_EXECUTE_CASE
 }
 
-void TM_WriteByte (TM_CPU* p_CPU, uint32_t p_Address, uint8_t p_Data)
+static void TM_BeginCompiledInstruction (TM_CPU* p_CPU, TM_DecodedInstruction* p_Instruction)
 {
-    // Ensure the given CPU instance, and its bus write function pointer, are valid.
-    if (p_CPU == NULL || p_CPU->m_BusWrite == NULL)
-    {
+    // This does the work of `TM_BeginInstruction`, for an instruction known to be the next one in
+    // the current block.
+    p_CPU->m_MD = 0;
+    p_CPU->m_MA = 0;
+    p_CPU->m_DA = false;
+    p_CPU->m_IA = p_CPU->m_PC;
+    p_CPU->m_BlockIndex = (uint32_t) (p_Instruction - p_CPU->m_Block->m_Instructions) + 1;
+    p_CPU->m_Decoded = p_Instruction;
+    p_CPU->m_CI = p_Instruction->m_CI;
+    TM_AdvanceCPU(p_CPU, 2);
+
+    p_CPU->m_OC = (p_CPU->m_CI >> 8) & 0xFF;
+    p_CPU->m_IP1 = (p_CPU->m_CI >> 4) & 0x0F;
+    p_CPU->m_IP2 = (p_CPU->m_CI >> 0) & 0x0F;
+}
+
+static int32_t TM_RetireCompiledInstruction (TM_CPU* p_CPU)
+{
+    // This does the work the dispatch core does after each instruction: the other components on the
+    // bus are brought up to date, and interrupts are processed. Returns a new quiet window if compiled
+    // code may carry on with the next instruction in the block, or `-1` if it must leave the block.
+    uint32_t l_NextAddress = p_CPU->m_PC;
+    TM_FlushCPUCycles(p_CPU);
+    TM_ProcessInterrupts(p_CPU);
+
+    if (
+        p_CPU->m_PC != l_NextAddress ||
+        TM_IsDispatchInterrupted(p_CPU) == true ||
+        p_CPU->m_EC != TM_EC_OK
+    )
+    {
+        return -1;
+    }
+
+    return TM_GetQuietCycles(p_CPU);
+}
+
+static int32_t TM_RunFallbackInstruction (TM_CPU* p_CPU, TM_DecodedInstruction* p_Instruction)
+{
+    // Runs an instruction which was not translated through its interpreter handler, then retires it.
+    // Returns as `TM_RetireCompiledInstruction` does; if the instruction fails, then the failure is
+    // noted, and `-1` is returned.
+    TM_BeginCompiledInstruction(p_CPU, p_Instruction);
+    bool l_Good = TM_ExecuteOpcode(p_CPU);
+    TM_FlushCPUCycles(p_CPU);
+    if (l_Good == false)
+    {
+        p_CPU->m_JITFailed = true;
+        return -1;
+    }
+
+    p_CPU->m_Decoded = NULL;
+
+    // If the instruction transferred control elsewhere, then the block is left.
+    if (p_CPU->m_PC != p_Instruction->m_Address + 2 + p_Instruction->m_OperandSize)
+    {
+        TM_ProcessInterrupts(p_CPU);
+        return -1;
+    }
+
+    return TM_RetireCompiledInstruction(p_CPU);
+}
+
+// Private Functions - JIT Compiler - Code Emission ////////////////////////////////////////////////
+
+static void TM_EmitByte (TM_JITEmitter* p_Emitter, uint8_t p_Byte)
+{
+    if (p_Emitter->m_Size >= TM_JIT_MAX_BLOCK_CODE)
+    {
+        p_Emitter->m_Overflow = true;
+        return;
+    }
+
+    p_Emitter->m_Code[p_Emitter->m_Size++] = p_Byte;
+}
+
+static void TM_EmitDoubleWord (TM_JITEmitter* p_Emitter, uint32_t p_Value)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        TM_EmitByte(p_Emitter, (p_Value >> (8 * i)) & 0xFF);
+    }
+}
+
+static void TM_EmitQuadWord (TM_JITEmitter* p_Emitter, uint64_t p_Value)
+{
+    TM_EmitDoubleWord(p_Emitter, p_Value & 0xFFFFFFFF);
+    TM_EmitDoubleWord(p_Emitter, p_Value >> 32);
+}
+
+static void TM_EmitRex (TM_JITEmitter* p_Emitter, bool p_Wide, uint8_t p_Reg, uint8_t p_RM,
+    bool p_Bytes)
+{
+    // A REX prefix is needed for 64-bit operands and for `r8` to `r15`. Byte accesses to `spl`,
+    // `bpl`, `sil` and `dil` need one too; without it, those encodings select `ah` to `bh`.
+    uint8_t l_Rex = 0x40 | (p_Wide << 3) | ((p_Reg & 8) >> 1) | ((p_RM & 8) >> 3);
+    bool l_ByteRegister = p_Bytes && ((p_Reg >= 4 && p_Reg < 8) || (p_RM >= 4 && p_RM < 8));
+    if (l_Rex != 0x40 || l_ByteRegister == true)
+    {
+        TM_EmitByte(p_Emitter, l_Rex);
+    }
+}
+
+static void TM_EmitOpcode (TM_JITEmitter* p_Emitter, uint16_t p_Opcode)
+{
+    // Opcodes above `0xFF` are two-byte opcodes, such as `0x0FB6`.
+    if (p_Opcode > 0xFF)
+    {
+        TM_EmitByte(p_Emitter, p_Opcode >> 8);
+    }
+
+    TM_EmitByte(p_Emitter, p_Opcode & 0xFF);
+}
+
+static void TM_EmitRR (TM_JITEmitter* p_Emitter, bool p_Wide, bool p_Bytes, uint16_t p_Opcode,
+    uint8_t p_Reg, uint8_t p_RM)
+{
+    // `opcode reg, rm`, where `rm` is a register.
+    TM_EmitRex(p_Emitter, p_Wide, p_Reg, p_RM, p_Bytes);
+    TM_EmitOpcode(p_Emitter, p_Opcode);
+    TM_EmitByte(p_Emitter, 0xC0 | ((p_Reg & 7) << 3) | (p_RM & 7));
+}
+
+static void TM_EmitRM (TM_JITEmitter* p_Emitter, bool p_Wide, uint16_t p_Opcode, uint8_t p_Reg,
+    size_t p_Offset)
+{
+    // `opcode reg, [r15 + offset]`, where `offset` is the offset of a field of the CPU instance.
+    TM_EmitRex(p_Emitter, p_Wide, p_Reg, TM_JIT_CPU, false);
+    TM_EmitOpcode(p_Emitter, p_Opcode);
+    TM_EmitByte(p_Emitter, 0x80 | ((p_Reg & 7) << 3) | (TM_JIT_CPU & 7));
+    TM_EmitDoubleWord(p_Emitter, (uint32_t) p_Offset);
+}
+
+static void TM_EmitMoveImmediate (TM_JITEmitter* p_Emitter, uint8_t p_Reg, uint32_t p_Value)
+{
+    // `mov r32, imm32`
+    TM_EmitRex(p_Emitter, false, 0, p_Reg, false);
+    TM_EmitByte(p_Emitter, 0xB8 | (p_Reg & 7));
+    TM_EmitDoubleWord(p_Emitter, p_Value);
+}
+
+static void TM_EmitImmediateRR (TM_JITEmitter* p_Emitter, uint8_t p_Extension, uint8_t p_Reg,
+    uint32_t p_Value)
+{
+    // `add`, `or`, `and`, `sub`, `xor` or `cmp r32, imm32`, selected by the opcode extension.
+    TM_EmitRR(p_Emitter, false, false, 0x81, p_Extension, p_Reg);
+    TM_EmitDoubleWord(p_Emitter, p_Value);
+}
+
+static void TM_EmitCall (TM_JITEmitter* p_Emitter, const void* p_Function)
+{
+    // `mov rax, imm64`, `call rax`
+    TM_EmitRex(p_Emitter, true, 0, TM_HR_RAX, false);
+    TM_EmitByte(p_Emitter, 0xB8);
+    TM_EmitQuadWord(p_Emitter, (uint64_t) (uintptr_t) p_Function);
+    TM_EmitByte(p_Emitter, 0xFF);
+    TM_EmitByte(p_Emitter, 0xD0);
+}
+
+static void TM_EmitCPUArgument (TM_JITEmitter* p_Emitter)
+{
+    // `mov rdi, r15`
+    TM_EmitRR(p_Emitter, true, false, 0x89, TM_JIT_CPU, TM_HR_RDI);
+}
+
+static uint16_t TM_CreateLabel (TM_JITEmitter* p_Emitter)
+{
+    if (p_Emitter->m_LabelCount >= TM_JIT_MAX_LABELS)
+    {
+        p_Emitter->m_Overflow = true;
+        return 0;
+    }
+
+    p_Emitter->m_Labels[p_Emitter->m_LabelCount] = -1;
+    return p_Emitter->m_LabelCount++;
+}
+
+static void TM_PlaceLabel (TM_JITEmitter* p_Emitter, uint16_t p_Label)
+{
+    p_Emitter->m_Labels[p_Label] = (int32_t) p_Emitter->m_Size;
+}
+
+static void TM_EmitJump (TM_JITEmitter* p_Emitter, TM_HostCondition p_Condition, uint16_t p_Label)
+{
+    // `jmp rel32` or `jcc rel32`. The displacement is filled in once every label has been placed.
+    if (p_Condition == TM_HC_ALWAYS)
+    {
+        TM_EmitByte(p_Emitter, 0xE9);
+    }
+    else
+    {
+        TM_EmitByte(p_Emitter, 0x0F);
+        TM_EmitByte(p_Emitter, 0x80 | p_Condition);
+    }
+
+    if (p_Emitter->m_FixupCount >= TM_JIT_MAX_FIXUPS)
+    {
+        p_Emitter->m_Overflow = true;
+        return;
+    }
+
+    p_Emitter->m_Fixups[p_Emitter->m_FixupCount] = (uint32_t) p_Emitter->m_Size;
+    p_Emitter->m_FixupLabels[p_Emitter->m_FixupCount++] = p_Label;
+    TM_EmitDoubleWord(p_Emitter, 0);
+}
+
+static void TM_EmitStub (TM_JITEmitter* p_Emitter, TM_HostCondition p_Condition,
+    const TM_JITStub* p_Stub)
+{
+    // Jumps to a new out-of-line stub, if the given condition holds.
+    if (p_Emitter->m_StubCount >= TM_JIT_MAX_STUBS)
+    {
+        p_Emitter->m_Overflow = true;
+        return;
+    }
+
+    TM_JITStub* l_Stub = &p_Emitter->m_Stubs[p_Emitter->m_StubCount++];
+    *l_Stub = *p_Stub;
+    l_Stub->m_Label = TM_CreateLabel(p_Emitter);
+    TM_EmitJump(p_Emitter, p_Condition, l_Stub->m_Label);
+}
+
+static void TM_EmitSpillRegisters (TM_JITEmitter* p_Emitter)
+{
+    // Write the general-purpose registers back to the CPU instance.
+    for (uint8_t i = 0; i < 4; ++i)
+    {
+        TM_EmitRM(p_Emitter, false, 0x89, s_HostRegisters[i],
+            offsetof(TM_CPU, m_Registers) + (i * sizeof(uint32_t)));
+    }
+}
+
+static void TM_EmitLoadRegisters (TM_JITEmitter* p_Emitter)
+{
+    // Read the general-purpose registers from the CPU instance.
+    for (uint8_t i = 0; i < 4; ++i)
+    {
+        TM_EmitRM(p_Emitter, false, 0x8B, s_HostRegisters[i],
+            offsetof(TM_CPU, m_Registers) + (i * sizeof(uint32_t)));
+    }
+}
+
+static void TM_EmitReadField (TM_JITEmitter* p_Emitter, uint8_t p_Destination, uint8_t p_Register)
+{
+    // Reads a register, or sub-register, into the given scratch register (`eax`, `ecx` or `edx`),
+    // zero-extended.
+    const TM_RegisterField* l_Field = &s_RegisterFields[p_Register & 0xF];
+    uint8_t l_Host = s_HostRegisters[l_Field->m_Index];
+    if (l_Field->m_Mask == 0xFFFFFFFF)
+    {
+        TM_EmitRR(p_Emitter, false, false, 0x89, l_Host, p_Destination);
+    }
+    else if (l_Field->m_Mask == 0xFFFF)
+    {
+        TM_EmitRR(p_Emitter, false, false, 0x0FB7, p_Destination, l_Host);
+    }
+    else if (l_Field->m_Shift == 0)
+    {
+        TM_EmitRR(p_Emitter, false, true, 0x0FB6, p_Destination, l_Host);
+    }
+    else if (l_Host == TM_HR_RBX)
+    {
+        // `movzx r32, bh`; `bh` is encoded as `rdi` without a REX prefix.
+        TM_EmitRR(p_Emitter, false, false, 0x0FB6, p_Destination, TM_HR_RDI);
+    }
+    else
+    {
+        // `mov r32, host`, `shr r32, 8`, `movzx r32, r8`
+        TM_EmitRR(p_Emitter, false, false, 0x89, l_Host, p_Destination);
+        TM_EmitRR(p_Emitter, false, false, 0xC1, 5, p_Destination);
+        TM_EmitByte(p_Emitter, 8);
+        TM_EmitRR(p_Emitter, false, false, 0x0FB6, p_Destination, p_Destination);
+    }
+}
+
+static void TM_EmitWriteField (TM_JITEmitter* p_Emitter, uint8_t p_Source, uint8_t p_Register)
+{
+    // Writes the given scratch register (`eax` or `ecx`) to a register, or sub-register, leaving the
+    // register's other bits alone. May overwrite `edx`.
+    const TM_RegisterField* l_Field = &s_RegisterFields[p_Register & 0xF];
+    uint8_t l_Host = s_HostRegisters[l_Field->m_Index];
+    if (l_Field->m_Mask == 0xFFFFFFFF)
+    {
+        TM_EmitRR(p_Emitter, false, false, 0x89, p_Source, l_Host);
+    }
+    else if (l_Field->m_Mask == 0xFFFF)
+    {
+        TM_EmitByte(p_Emitter, 0x66);
+        TM_EmitRR(p_Emitter, false, false, 0x89, p_Source, l_Host);
+    }
+    else if (l_Field->m_Shift == 0)
+    {
+        TM_EmitRR(p_Emitter, false, true, 0x88, p_Source, l_Host);
+    }
+    else if (l_Host == TM_HR_RBX)
+    {
+        // `mov bh, r8`; `bh` is encoded as `rdi` without a REX prefix.
+        TM_EmitRR(p_Emitter, false, false, 0x88, p_Source, TM_HR_RDI);
+    }
+    else
+    {
+        // `movzx edx, r8`, `shl edx, 8`, `and host, 0xFFFF00FF`, `or host, edx`
+        TM_EmitRR(p_Emitter, false, false, 0x0FB6, TM_HR_RDX, p_Source);
+        TM_EmitRR(p_Emitter, false, false, 0xC1, 4, TM_HR_RDX);
+        TM_EmitByte(p_Emitter, 8);
+        TM_EmitImmediateRR(p_Emitter, 4, l_Host, 0xFFFF00FF);
+        TM_EmitRR(p_Emitter, false, false, 0x09, TM_HR_RDX, l_Host);
+    }
+}
+
+static void TM_EmitDeferFlags (TM_JITEmitter* p_Emitter, TM_DeferredFlags p_Op, uint8_t p_Size,
+    uint8_t p_Left, int p_Right, int p_Carry)
+{
+    // Stores a deferred flags operation, as `TM_DeferFlags` does. The right operand and the carry are
+    // taken from the given scratch registers, or are zero if they are `-1`.
+    TM_EmitRM(p_Emitter, false, 0xC6, 0, offsetof(TM_CPU, m_DeferredOp));
+    TM_EmitByte(p_Emitter, p_Op);
+    TM_EmitRM(p_Emitter, false, 0xC6, 0, offsetof(TM_CPU, m_DeferredSize));
+    TM_EmitByte(p_Emitter, p_Size);
+    if (p_Carry >= 0)
+    {
+        TM_EmitRM(p_Emitter, false, 0x88, (uint8_t) p_Carry, offsetof(TM_CPU, m_DeferredCarry));
+    }
+    else
+    {
+        TM_EmitRM(p_Emitter, false, 0xC6, 0, offsetof(TM_CPU, m_DeferredCarry));
+        TM_EmitByte(p_Emitter, 0);
+    }
+
+    TM_EmitRM(p_Emitter, false, 0x89, p_Left, offsetof(TM_CPU, m_DeferredLeft));
+    if (p_Right >= 0)
+    {
+        TM_EmitRM(p_Emitter, false, 0x89, (uint8_t) p_Right, offsetof(TM_CPU, m_DeferredRight));
+    }
+    else
+    {
+        TM_EmitRM(p_Emitter, false, 0xC7, 0, offsetof(TM_CPU, m_DeferredRight));
+        TM_EmitDoubleWord(p_Emitter, 0);
+    }
+
+    p_Emitter->m_FlagsKnown = true;
+    p_Emitter->m_FlagsOp = p_Op;
+    p_Emitter->m_FlagsSize = p_Size;
+    p_Emitter->m_FlagsCarryClear = (p_Carry < 0);
+}
+
+static void TM_EmitCycles (TM_JITEmitter* p_Emitter, uint8_t p_Cycles)
+{
+    // `add qword [m_CycleCount], n`, `add dword [m_PendingCycles], n`, `sub r14d, n`. The flags are
+    // left as set by the subtraction, for the caller to test whether the quiet window is used up.
+    TM_EmitRM(p_Emitter, true, 0x83, 0, offsetof(TM_CPU, m_CycleCount));
+    TM_EmitByte(p_Emitter, p_Cycles);
+    TM_EmitRM(p_Emitter, false, 0x83, 0, offsetof(TM_CPU, m_PendingCycles));
+    TM_EmitByte(p_Emitter, p_Cycles);
+    TM_EmitRR(p_Emitter, false, false, 0x83, 5, TM_JIT_WINDOW);
+    TM_EmitByte(p_Emitter, p_Cycles);
+}
+
+static void TM_EmitStorePC (TM_JITEmitter* p_Emitter, uint32_t p_Address)
+{
+    // `mov dword [m_PC], imm32`
+    TM_EmitRM(p_Emitter, false, 0xC7, 0, offsetof(TM_CPU, m_PC));
+    TM_EmitDoubleWord(p_Emitter, p_Address);
+}
+
+// Private Functions - JIT Compiler - Translation //////////////////////////////////////////////////
+
+static uint8_t TM_GetFieldSize (uint8_t p_Register)
+{
+    // The size, in bytes, of a register used as a destination; see `TM_GetDestinationSize`.
+    return ((p_Register & 0b11) >= 2) ? 1 : ((p_Register & 0b11) == 0b01) ? 2 : 4;
+}
+
+static bool TM_IsTranslatable (const TM_DecodedInstruction* p_Instruction)
+{
+    uint8_t l_Opcode = (p_Instruction->m_CI >> 8) & 0xFF;
+    uint8_t l_IP1 = (p_Instruction->m_CI >> 4) & 0x0F;
+    switch (l_Opcode)
+    {
+        // `NOP`, `LD X, IMM`, `MV X, Y`, `INC X`, `DEC X`
+        case 0x00: case 0x10: case 0x1D: case 0x30: case 0x32:
+            return true;
+
+        // `JMP X, ADDR32`, `JMP X, Y`, `JPB X, SIMM16`, with a valid condition.
+        case 0x20: case 0x21: case 0x22:
+            return l_IP1 <= TM_COND_CC;
+
+        // The arithmetic and logic instructions with an immediate or register operand, as long as
+        // the destination is an accumulator register; anything else is left to the interpreter to
+        // reject.
+        case 0x34: case 0x35: case 0x37: case 0x38: case 0x3A: case 0x3B: case 0x3D: case 0x3E:
+        case 0x40: case 0x41: case 0x43: case 0x44: case 0x46: case 0x47: case 0x50: case 0x51:
+            return (l_IP1 & 0b1100) == 0;
+
+        default:
+            return false;
+    }
+}
+
+static void TM_EmitRetirement (TM_JITEmitter* p_Emitter, uint8_t p_Cycles, uint32_t p_NextAddress,
+    bool p_StorePC, uint16_t p_Resume, uint32_t p_Retired)
+{
+    // Counts a translated instruction's cycles against the quiet window. If the window is used up,
+    // then the instruction is retired by a stub, which renews the window if it can.
+    TM_EmitCycles(p_Emitter, p_Cycles);
+    TM_JITStub l_Stub = {
+        .m_Resume = p_Resume,
+        .m_Retired = p_Retired,
+        .m_PC = p_NextAddress,
+        .m_StorePC = p_StorePC,
+        .m_Retire = true
+    };
+    TM_EmitStub(p_Emitter, TM_HC_LE, &l_Stub);
+}
+
+static void TM_EmitCondition (TM_JITEmitter* p_Emitter, TM_CPUCondition p_Condition,
+    uint16_t p_NotTaken)
+{
+    // Jumps to the given label if the condition does not hold. If the deferred flags operation is
+    // known, then the flag is found from its operands, exactly as `TM_EvaluateFlags` would find it.
+    // Otherwise, the condition is checked by `TM_CheckCondition`.
+    uint8_t l_Op = p_Emitter->m_FlagsOp;
+    bool l_Known =
+        p_Emitter->m_FlagsKnown == true &&
+        l_Op != TM_DF_NONE &&
+        ((l_Op != TM_DF_ADD && l_Op != TM_DF_SUB) || p_Emitter->m_FlagsCarryClear == true);
+    if (l_Known == false)
+    {
+        TM_EmitCPUArgument(p_Emitter);
+        TM_EmitMoveImmediate(p_Emitter, TM_HR_RSI, p_Condition);
+        TM_EmitCall(p_Emitter, TM_CheckCondition);
+        TM_EmitRR(p_Emitter, false, false, 0x84, TM_HR_RAX, TM_HR_RAX);
+        TM_EmitJump(p_Emitter, TM_HC_Z, p_NotTaken);
+        p_Emitter->m_FlagsKnown = false;
+        return;
+    }
+
+    uint8_t l_Size = p_Emitter->m_FlagsSize;
+    uint32_t l_Mask = (l_Size == 1) ? 0xFF : (l_Size == 2) ? 0xFFFF : 0xFFFFFFFF;
+
+    // `mov eax, [m_DeferredLeft]`, then `add` or `sub eax, [m_DeferredRight]` for an addition or
+    // subtraction, leaves the operation's 32-bit result in `eax`.
+    if (l_Op != TM_DF_INC && l_Op != TM_DF_DEC && (p_Condition == TM_COND_ZS ||
+        p_Condition == TM_COND_ZC || l_Op == TM_DF_ADD))
+    {
+        TM_EmitRM(p_Emitter, false, 0x8B, TM_HR_RAX, offsetof(TM_CPU, m_DeferredLeft));
+        if (l_Op == TM_DF_ADD)
+        {
+            TM_EmitRM(p_Emitter, false, 0x03, TM_HR_RAX, offsetof(TM_CPU, m_DeferredRight));
+        }
+        else if (l_Op == TM_DF_SUB)
+        {
+            TM_EmitRM(p_Emitter, false, 0x2B, TM_HR_RAX, offsetof(TM_CPU, m_DeferredRight));
+        }
+    }
+    else if (p_Condition == TM_COND_ZS || p_Condition == TM_COND_ZC)
+    {
+        TM_EmitRM(p_Emitter, false, 0x8B, TM_HR_RAX, offsetof(TM_CPU, m_DeferredLeft));
+    }
+
+    switch (p_Condition)
+    {
+        case TM_COND_ZS:
+        case TM_COND_ZC:
+        {
+            // The zero flag is set if the result's bits within the destination are all clear.
+            // `test eax, mask`
+            TM_EmitRR(p_Emitter, false, false, 0xF7, 0, TM_HR_RAX);
+            TM_EmitDoubleWord(p_Emitter, l_Mask);
+            TM_EmitJump(p_Emitter, (p_Condition == TM_COND_ZS) ? TM_HC_NZ : TM_HC_Z, p_NotTaken);
+        } break;
+
+        case TM_COND_CS:
+        case TM_COND_CC:
+        {
+            // `INC` and `DEC` leave the carry flag as it is in the flags register. An addition
+            // carries if its 32-bit result does not fit in the destination. Subtraction and the
+            // logic operations always leave the carry flag clear.
+            if (l_Op == TM_DF_INC || l_Op == TM_DF_DEC)
+            {
+                // `test byte [m_Flags], 1 << TM_FLAG_C`
+                TM_EmitRM(p_Emitter, false, 0xF6, 0, offsetof(TM_CPU, m_Flags));
+                TM_EmitByte(p_Emitter, 1 << TM_FLAG_C);
+                TM_EmitJump(p_Emitter, (p_Condition == TM_COND_CS) ? TM_HC_Z : TM_HC_NZ,
+                    p_NotTaken);
+            }
+            else if (l_Op == TM_DF_ADD && l_Size != 4)
+            {
+                // `cmp eax, mask`
+                TM_EmitImmediateRR(p_Emitter, 7, TM_HR_RAX, l_Mask);
+                TM_EmitJump(p_Emitter, (p_Condition == TM_COND_CS) ? TM_HC_BE : TM_HC_A,
+                    p_NotTaken);
+            }
+            else if (p_Condition == TM_COND_CS)
+            {
+                TM_EmitJump(p_Emitter, TM_HC_ALWAYS, p_NotTaken);
+            }
+        } break;
+
+        default:
+            break;
+    }
+}
+
+static void TM_CompileJump (TM_JITEmitter* p_Emitter, const TM_DecodedInstruction* p_Instruction,
+    uint32_t p_Index, uint16_t p_End)
+{
+    uint8_t l_Opcode = (p_Instruction->m_CI >> 8) & 0xFF;
+    uint8_t l_IP1 = (p_Instruction->m_CI >> 4) & 0x0F;
+    uint32_t l_NextAddress = p_Instruction->m_Address + 2 + p_Instruction->m_OperandSize;
+    uint8_t l_Cycles = 2 + p_Instruction->m_OperandSize;
+    uint16_t l_NotTaken = TM_CreateLabel(p_Emitter);
+
+    if (l_IP1 != TM_COND_NC)
+    {
+        TM_EmitCondition(p_Emitter, l_IP1, l_NotTaken);
+    }
+
+    // Taken: move the program counter, which takes one more cycle. `JMP X, Y` jumps to the address
+    // in the register its fetch function reads, which is the one named by its first parameter.
+    if (l_Opcode == 0x21)
+    {
+        TM_EmitReadField(p_Emitter, TM_HR_RAX, l_IP1);
+        TM_EmitRM(p_Emitter, false, 0x89, TM_HR_RAX, offsetof(TM_CPU, m_PC));
+    }
+    else if (l_Opcode == 0x22)
+    {
+        TM_EmitStorePC(p_Emitter, l_NextAddress + (int16_t) (p_Instruction->m_Operand & 0xFFFF));
+    }
+    else
+    {
+        TM_EmitStorePC(p_Emitter, p_Instruction->m_Operand);
+    }
+
+    TM_EmitRetirement(p_Emitter, l_Cycles + 1, 0, false, p_End, p_Index + 1);
+    TM_EmitJump(p_Emitter, TM_HC_ALWAYS, p_End);
+
+    // Not taken: carry on past the jump.
+    TM_PlaceLabel(p_Emitter, l_NotTaken);
+    if (l_IP1 != TM_COND_NC)
+    {
+        TM_EmitStorePC(p_Emitter, l_NextAddress);
+        TM_EmitRetirement(p_Emitter, l_Cycles, 0, false, p_End, p_Index + 1);
+        TM_EmitJump(p_Emitter, TM_HC_ALWAYS, p_End);
+    }
+}
+
+static void TM_CompileInstruction (TM_JITEmitter* p_Emitter, TM_BasicBlock* p_Block,
+    uint32_t p_Index, const uint16_t* p_Labels)
+{
+    TM_DecodedInstruction* l_Instruction = &p_Block->m_Instructions[p_Index];
+    uint8_t l_Opcode = (l_Instruction->m_CI >> 8) & 0xFF;
+    uint8_t l_IP1 = (l_Instruction->m_CI >> 4) & 0x0F;
+    uint8_t l_IP2 = (l_Instruction->m_CI >> 0) & 0x0F;
+    uint32_t l_NextAddress = l_Instruction->m_Address + 2 + l_Instruction->m_OperandSize;
+    bool l_Last = (p_Index + 1 == p_Block->m_Length);
+    uint16_t l_Resume = p_Labels[p_Index + 1];
+
+    // Instructions which are not translated are run through the interpreter.
+    if (TM_IsTranslatable(l_Instruction) == false)
+    {
+        TM_EmitStorePC(p_Emitter, l_Instruction->m_Address);
+        TM_EmitSpillRegisters(p_Emitter);
+        TM_EmitCPUArgument(p_Emitter);
+        TM_EmitRex(p_Emitter, true, 0, TM_HR_RSI, false);
+        TM_EmitByte(p_Emitter, 0xB8 | TM_HR_RSI);
+        TM_EmitQuadWord(p_Emitter, (uint64_t) (uintptr_t) l_Instruction);
+        TM_EmitCall(p_Emitter, TM_RunFallbackInstruction);
+        TM_EmitLoadRegisters(p_Emitter);
+
+        // `test eax, eax`, `js exit`, `mov r14d, eax`
+        TM_EmitRR(p_Emitter, false, false, 0x85, TM_HR_RAX, TM_HR_RAX);
+        TM_JITStub l_Exit = { .m_Retired = p_Index + 1 };
+        TM_EmitStub(p_Emitter, TM_HC_S, &l_Exit);
+        TM_EmitRR(p_Emitter, false, false, 0x89, TM_HR_RAX, TM_JIT_WINDOW);
+
+        p_Emitter->m_FlagsKnown = false;
+        return;
+    }
+
+    // Jumps always end their block.
+    if (l_Opcode >= 0x20 && l_Opcode <= 0x22)
+    {
+        TM_CompileJump(p_Emitter, l_Instruction, p_Index, p_Labels[p_Block->m_Length]);
+        return;
+    }
+
+    uint8_t l_Size = TM_GetFieldSize(l_IP1);
+    switch (l_Opcode)
+    {
+        // `NOP`
+        case 0x00:
+            break;
+
+        // `LD X, IMM`
+        case 0x10:
+            TM_EmitMoveImmediate(p_Emitter, TM_HR_RCX, l_Instruction->m_Operand);
+            TM_EmitWriteField(p_Emitter, TM_HR_RCX, l_IP1);
+            break;
+
+        // `MV X, Y`
+        case 0x1D:
+            TM_EmitReadField(p_Emitter, TM_HR_RCX, l_IP2);
+            TM_EmitWriteField(p_Emitter, TM_HR_RCX, l_IP1);
+            break;
+
+        // `INC X`, `DEC X`
+        case 0x30:
+        case 0x32:
+        {
+            TM_DeferredFlags l_Op = (l_Opcode == 0x30) ? TM_DF_INC : TM_DF_DEC;
+            TM_EmitReadField(p_Emitter, TM_HR_RAX, l_IP1);
+            TM_EmitRR(p_Emitter, false, false, 0x83, (l_Op == TM_DF_INC) ? 0 : 5, TM_HR_RAX);
+            TM_EmitByte(p_Emitter, 1);
+            TM_EmitWriteField(p_Emitter, TM_HR_RAX, l_IP1);
+
+            // If a pending `INC` or `DEC` is known to be safe to overwrite, then the flags are
+            // deferred here. Otherwise, `TM_DeferFlags` decides.
+            bool l_Overwritable =
+                p_Emitter->m_FlagsKnown == true &&
+                (p_Emitter->m_FlagsOp == TM_DF_INC || p_Emitter->m_FlagsOp == TM_DF_DEC) &&
+                (p_Emitter->m_FlagsSize != 1 || l_Size == 1);
+            if (l_Overwritable == true)
+            {
+                TM_EmitDeferFlags(p_Emitter, l_Op, l_Size, TM_HR_RAX, -1, -1);
+            }
+            else
+            {
+                // `TM_DeferFlags(r15, op, size, eax, 0, 0)`
+                TM_EmitCPUArgument(p_Emitter);
+                TM_EmitMoveImmediate(p_Emitter, TM_HR_RSI, l_Op);
+                TM_EmitMoveImmediate(p_Emitter, TM_HR_RDX, l_Size);
+                TM_EmitRR(p_Emitter, false, false, 0x89, TM_HR_RAX, TM_HR_RCX);
+                TM_EmitRR(p_Emitter, false, false, 0x31, TM_HR_R8, TM_HR_R8);
+                TM_EmitRR(p_Emitter, false, false, 0x31, TM_HR_R9, TM_HR_R9);
+                TM_EmitCall(p_Emitter, TM_DeferFlags);
+
+                p_Emitter->m_FlagsKnown = true;
+                p_Emitter->m_FlagsOp = l_Op;
+                p_Emitter->m_FlagsSize = l_Size;
+                p_Emitter->m_FlagsCarryClear = true;
+            }
+        } break;
+
+        // `ADD`, `ADC`, `SUB`, `SBC`, `AND`, `OR`, `XOR` and `CMP`, with an immediate operand (even
+        // opcodes below `0x40`, odd opcodes from `0x40`) or a register operand.
+        default:
+        {
+            bool l_Immediate =
+                l_Opcode == 0x34 || l_Opcode == 0x37 || l_Opcode == 0x3A || l_Opcode == 0x3D ||
+                l_Opcode == 0x40 || l_Opcode == 0x43 || l_Opcode == 0x46 || l_Opcode == 0x50;
+            bool l_WithCarry = (l_Opcode >= 0x37 && l_Opcode <= 0x39) ||
+                (l_Opcode >= 0x3D && l_Opcode <= 0x3F);
+
+            // The carry flag is needed first; resolving it may call out of compiled code, which
+            // overwrites the scratch registers.
+            if (l_WithCarry == true)
+            {
+                TM_EmitCPUArgument(p_Emitter);
+                TM_EmitCall(p_Emitter, TM_ResolveFlags);
+            }
+
+            // `ecx` = the memory data register; `eax` = the accumulator; `edx` = the carry.
+            if (l_Immediate == true)
+            {
+                TM_EmitMoveImmediate(p_Emitter, TM_HR_RCX, l_Instruction->m_Operand);
+            }
+            else
+            {
+                TM_EmitReadField(p_Emitter, TM_HR_RCX, l_IP2);
+            }
+
+            TM_EmitReadField(p_Emitter, TM_HR_RAX, l_IP1);
+            if (l_WithCarry == true)
+            {
+                // `movzx edx, byte [m_Flags]`, `shr edx, TM_FLAG_C`, `and edx, 1`
+                TM_EmitRM(p_Emitter, false, 0x0FB6, TM_HR_RDX, offsetof(TM_CPU, m_Flags));
+                TM_EmitRR(p_Emitter, false, false, 0xC1, 5, TM_HR_RDX);
+                TM_EmitByte(p_Emitter, TM_FLAG_C);
+                TM_EmitImmediateRR(p_Emitter, 4, TM_HR_RDX, 1);
+            }
+
+            int l_Carry = (l_WithCarry == true) ? TM_HR_RDX : -1;
+            switch (l_Opcode)
+            {
+                case 0x34: case 0x35: case 0x37: case 0x38:
+                    TM_EmitDeferFlags(p_Emitter, TM_DF_ADD, l_Size, TM_HR_RAX, TM_HR_RCX, l_Carry);
+                    TM_EmitRR(p_Emitter, false, false, 0x01, TM_HR_RCX, TM_HR_RAX);
+                    if (l_WithCarry == true)
+                    {
+                        TM_EmitRR(p_Emitter, false, false, 0x01, TM_HR_RDX, TM_HR_RAX);
+                    }
+                    TM_EmitWriteField(p_Emitter, TM_HR_RAX, l_IP1);
+                    break;
+
+                case 0x3A: case 0x3B: case 0x3D: case 0x3E:
+                    TM_EmitDeferFlags(p_Emitter, TM_DF_SUB, l_Size, TM_HR_RAX, TM_HR_RCX, l_Carry);
+                    TM_EmitRR(p_Emitter, false, false, 0x29, TM_HR_RCX, TM_HR_RAX);
+                    if (l_WithCarry == true)
+                    {
+                        TM_EmitRR(p_Emitter, false, false, 0x29, TM_HR_RDX, TM_HR_RAX);
+                    }
+                    TM_EmitWriteField(p_Emitter, TM_HR_RAX, l_IP1);
+                    break;
+
+                case 0x40: case 0x41:
+                    TM_EmitRR(p_Emitter, false, false, 0x21, TM_HR_RCX, TM_HR_RAX);
+                    TM_EmitWriteField(p_Emitter, TM_HR_RAX, l_IP1);
+                    TM_EmitDeferFlags(p_Emitter, TM_DF_AND, l_Size, TM_HR_RAX, -1, -1);
+                    break;
+
+                case 0x43: case 0x44:
+                case 0x46: case 0x47:
+                    TM_EmitRR(p_Emitter, false, false, (l_Opcode <= 0x44) ? 0x09 : 0x31, TM_HR_RCX,
+                        TM_HR_RAX);
+                    TM_EmitWriteField(p_Emitter, TM_HR_RAX, l_IP1);
+                    TM_EmitDeferFlags(p_Emitter, TM_DF_LOGIC, l_Size, TM_HR_RAX, -1, -1);
+                    break;
+
+                case 0x50: case 0x51:
+                    TM_EmitDeferFlags(p_Emitter, TM_DF_SUB, l_Size, TM_HR_RAX, TM_HR_RCX, -1);
+                    break;
+            }
+        } break;
+    }
+
+    // The instruction's opcode word and operand took one cycle per byte to fetch. If this is the
+    // block's last instruction, then the program counter is stored for the block's exit.
+    if (l_Last == true)
+    {
+        TM_EmitStorePC(p_Emitter, l_NextAddress);
+    }
+
+    TM_EmitRetirement(p_Emitter, 2 + l_Instruction->m_OperandSize, l_NextAddress, !l_Last, l_Resume,
+        p_Index + 1);
+}
+
+static bool TM_CompileBlock (TM_CPU* p_CPU, TM_BasicBlock* p_Block)
+{
+    TM_JITEmitter* l_Emitter = (TM_JITEmitter*) calloc(1, sizeof(TM_JITEmitter));
+    if (l_Emitter == NULL)
+    {
+        return false;
+    }
+
+    // One label marks the start of each instruction, and one more the end of the block.
+    uint16_t l_Labels[TM_MAX_BLOCK_LENGTH + 1];
+    for (uint32_t i = 0; i <= p_Block->m_Length; ++i)
+    {
+        l_Labels[i] = TM_CreateLabel(l_Emitter);
+    }
+    uint16_t l_Epilogue = TM_CreateLabel(l_Emitter);
+
+    // Prologue: save the callee-saved registers, keeping the stack 16-byte aligned for calls, then
+    // load the CPU instance, its registers and the quiet window.
+    static const uint8_t s_Saved[6] = {
+        TM_HR_RBX, TM_HR_RBP, TM_HR_R12, TM_HR_R13, TM_HR_R14, TM_HR_R15
+    };
+    for (int i = 0; i < 6; ++i)
+    {
+        TM_EmitRex(l_Emitter, false, 0, s_Saved[i], false);
+        TM_EmitByte(l_Emitter, 0x50 | (s_Saved[i] & 7));
+    }
+    TM_EmitRR(l_Emitter, true, false, 0x83, 5, TM_HR_RSP);
+    TM_EmitByte(l_Emitter, 8);
+    TM_EmitRR(l_Emitter, true, false, 0x89, TM_HR_RDI, TM_JIT_CPU);
+    TM_EmitLoadRegisters(l_Emitter);
+    TM_EmitRM(l_Emitter, false, 0x8B, TM_JIT_WINDOW, offsetof(TM_CPU, m_JITWindow));
+
+    // The block's instructions. The deferred flags are unknown on entry.
+    for (uint32_t i = 0; i < p_Block->m_Length; ++i)
+    {
+        TM_PlaceLabel(l_Emitter, l_Labels[i]);
+        TM_CompileInstruction(l_Emitter, p_Block, i, l_Labels);
+    }
+
+    // The end of the block: every instruction was retired. `mov eax, length`
+    TM_PlaceLabel(l_Emitter, l_Labels[p_Block->m_Length]);
+    TM_EmitMoveImmediate(l_Emitter, TM_HR_RAX, p_Block->m_Length);
+
+    // Epilogue: store the quiet window and the registers, restore the callee-saved registers, and
+    // return the number of instructions retired, in `eax`.
+    TM_PlaceLabel(l_Emitter, l_Epilogue);
+    TM_EmitRM(l_Emitter, false, 0x89, TM_JIT_WINDOW, offsetof(TM_CPU, m_JITWindow));
+    TM_EmitSpillRegisters(l_Emitter);
+    TM_EmitRR(l_Emitter, true, false, 0x83, 0, TM_HR_RSP);
+    TM_EmitByte(l_Emitter, 8);
+    for (int i = 5; i >= 0; --i)
+    {
+        TM_EmitRex(l_Emitter, false, 0, s_Saved[i], false);
+        TM_EmitByte(l_Emitter, 0x58 | (s_Saved[i] & 7));
+    }
+    TM_EmitByte(l_Emitter, 0xC3);
+
+    // The out-of-line stubs.
+    for (uint16_t i = 0; i < l_Emitter->m_StubCount; ++i)
+    {
+        const TM_JITStub* l_Stub = &l_Emitter->m_Stubs[i];
+        TM_PlaceLabel(l_Emitter, l_Stub->m_Label);
+
+        // A retirement stub calls `TM_RetireCompiledInstruction`. If that renews the quiet window,
+        // then the block resumes.
+        if (l_Stub->m_Retire == true)
+        {
+            if (l_Stub->m_StorePC == true)
+            {
+                TM_EmitStorePC(l_Emitter, l_Stub->m_PC);
+            }
+
+            TM_EmitSpillRegisters(l_Emitter);
+            TM_EmitCPUArgument(l_Emitter);
+            TM_EmitCall(l_Emitter, TM_RetireCompiledInstruction);
+            TM_EmitLoadRegisters(l_Emitter);
+
+            // `test eax, eax`, `js exit`, `mov r14d, eax`, `jmp resume`
+            uint16_t l_Exit = TM_CreateLabel(l_Emitter);
+            TM_EmitRR(l_Emitter, false, false, 0x85, TM_HR_RAX, TM_HR_RAX);
+            TM_EmitJump(l_Emitter, TM_HC_S, l_Exit);
+            TM_EmitRR(l_Emitter, false, false, 0x89, TM_HR_RAX, TM_JIT_WINDOW);
+            TM_EmitJump(l_Emitter, TM_HC_ALWAYS, l_Stub->m_Resume);
+            TM_PlaceLabel(l_Emitter, l_Exit);
+        }
+
+        // Leave the block. The cycles held back have been flushed, so the quiet window is spent.
+        // `xor r14d, r14d`, `mov eax, retired`, `jmp epilogue`
+        TM_EmitRR(l_Emitter, false, false, 0x31, TM_JIT_WINDOW, TM_JIT_WINDOW);
+        TM_EmitMoveImmediate(l_Emitter, TM_HR_RAX, l_Stub->m_Retired);
+        TM_EmitJump(l_Emitter, TM_HC_ALWAYS, l_Epilogue);
+    }
+
+    // Fill in the jumps' displacements, now that every label has been placed.
+    for (uint16_t i = 0; i < l_Emitter->m_FixupCount; ++i)
+    {
+        int32_t l_Target = l_Emitter->m_Labels[l_Emitter->m_FixupLabels[i]];
+        int32_t l_Offset = l_Target - (int32_t) (l_Emitter->m_Fixups[i] + 4);
+        assert(l_Target >= 0);
+        memcpy(&l_Emitter->m_Code[l_Emitter->m_Fixups[i]], &l_Offset, 4);
+    }
+
+    if (l_Emitter->m_Overflow == true)
+    {
+        free(l_Emitter);
+        return false;
+    }
+
+    // If the arena cannot hold the block, then empty it, discarding every compiled block.
+    size_t l_Start = (p_CPU->m_JITArenaUsed + 15) & ~(size_t) 15;
+    if (l_Start + l_Emitter->m_Size > TM_JIT_ARENA_SIZE)
+    {
+        for (uint32_t i = 0; i < TM_BLOCK_CACHE_SIZE; ++i)
+        {
+            p_CPU->m_BlockCache[i].m_Native = NULL;
+        }
+
+        l_Start = 0;
+    }
+
+    // Only the pages the code lands on are made writable while it is copied in, and executable
+    // again afterwards. The rest of the arena stays executable throughout.
+    size_t l_PageSize = (size_t) sysconf(_SC_PAGESIZE);
+    size_t l_Begin = l_Start & ~(l_PageSize - 1);
+    size_t l_End = (l_Start + l_Emitter->m_Size + l_PageSize - 1) & ~(l_PageSize - 1);
+    if (mprotect(p_CPU->m_JITArena + l_Begin, l_End - l_Begin, PROT_READ | PROT_WRITE) != 0)
+    {
+        free(l_Emitter);
+        return false;
+    }
+
+    memcpy(p_CPU->m_JITArena + l_Start, l_Emitter->m_Code, l_Emitter->m_Size);
+
+    if (mprotect(p_CPU->m_JITArena + l_Begin, l_End - l_Begin, PROT_READ | PROT_EXEC) != 0)
+    {
+        free(l_Emitter);
+        return false;
+    }
+
+    p_CPU->m_JITArenaUsed = l_Start + l_Emitter->m_Size;
+    p_Block->m_Native = p_CPU->m_JITArena + l_Start;
+    free(l_Emitter);
+    return true;
+}
+
+#endif
+
+bool TM_RunCompiledCode (TM_CPU* p_CPU, uint32_t p_Limit, uint32_t* p_Retired)
+{
+    assert(p_CPU != NULL);
+
+#if defined(TM_JIT_SUPPORTED)
+
+    // Runs compiled blocks, one after the other, for as long as the CPU is at the start of a
+    // compiled (or newly-hot) block. Returns `false` if an instruction fails.
+    bool l_Entered = false;
+    while (
+        *p_Retired < p_Limit &&
+        TM_IsDispatchInterrupted(p_CPU) == false &&
+        p_CPU->m_EC == TM_EC_OK
+    )
+    {
+        // Look up the next instruction. Unless it is the first instruction of a block, leave it
+        // to the interpreter, stepping back so that it finds the same instruction. The same goes for
+        // a block with more instructions than may still be retired.
+        TM_DecodedInstruction* l_Instruction = TM_FindDecodedInstruction(p_CPU, p_CPU->m_PC);
+        if (l_Instruction == NULL)
+        {
+            break;
+        }
+
+        TM_BasicBlock* l_Block = p_CPU->m_Block;
+        p_CPU->m_BlockIndex--;
+        if (
+            l_Instruction != &l_Block->m_Instructions[0] ||
+            l_Block->m_Length > p_Limit - *p_Retired
+        )
+        {
+            break;
+        }
+
+        // Compile the block once it is hot, unless it lies in XRAM.
+        if (l_Block->m_Native == NULL)
+        {
+            if (
+                l_Block->m_Address >= TM_XRAM_BEGIN ||
+                ++l_Block->m_Executions < TM_JIT_THRESHOLD ||
+                TM_CompileBlock(p_CPU, l_Block) == false
+            )
+            {
+                break;
+            }
+        }
+
+        // The first compiled block to run opens a quiet window. Later blocks carry on with what is
+        // left of it.
+        TM_EndTranslation(p_CPU);
+        if (l_Entered == false)
+        {
+            p_CPU->m_JITWindow = TM_GetQuietCycles(p_CPU);
+            l_Entered = true;
+        }
+
+        // Run the block's compiled code. A failed instruction is not counted as retired.
+        p_CPU->m_JITFailed = false;
+        uint32_t l_Retired = ((TM_CompiledBlock) l_Block->m_Native)(p_CPU);
+        p_CPU->m_Block = l_Block;
+        p_CPU->m_BlockIndex = l_Retired;
+        if (p_CPU->m_JITFailed == true)
+        {
+            *p_Retired += l_Retired - 1;
+            return false;
+        }
+
+        *p_Retired += l_Retired;
+    }
+
+    // Pass on any cycles still held back. The quiet window was not used up, so nothing can have
+    // happened within them which the interpreter would have seen sooner.
+    if (l_Entered == true)
+    {
+        TM_FlushCPUCycles(p_CPU);
+    }
+
+#endif
+
+    return true;
+}
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+TM_CPU* TM_CreateCPU (TM_BusRead p_BusRead, TM_BusWrite p_BusWrite, TM_Cycle p_Cycle,
+    void* p_Context)
+{
+    // Ensure the given function pointers are valid.
+    if (p_BusRead == NULL || p_BusWrite == NULL || p_Cycle == NULL)
+    {
+        fprintf(stderr, "TM: Cannot create CPU instance - missing or invalid function pointers.\n");
+        return NULL;
+    }
+
+    // Allocate memory for the CPU instance.
+    TM_CPU* l_CPU = (TM_CPU*) calloc(1, sizeof(TM_CPU));
+    if (l_CPU == NULL)
+    {
+        perror("TM: Failed to allocate memory for the CPU instance");
+        return NULL;
+    }
+
+    // Allocate memory for the CPU instance's block cache.
+    l_CPU->m_BlockCache = (TM_BasicBlock*) calloc(TM_BLOCK_CACHE_SIZE, sizeof(TM_BasicBlock));
+    if (l_CPU->m_BlockCache == NULL)
+    {
+        perror("TM: Failed to allocate memory for the CPU instance's block cache");
+        free(l_CPU);
+        return NULL;
+    }
+
+    // Initialize the CPU instance and set the function pointers.
+    TM_ResetCPU(l_CPU);
+    l_CPU->m_BusRead = p_BusRead;
+    l_CPU->m_BusWrite = p_BusWrite;
+    l_CPU->m_Cycle = p_Cycle;
+    l_CPU->m_Context = p_Context;
+
+    return l_CPU;
+}
+
+void TM_ResetCPU (TM_CPU* p_CPU)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot reset CPU instance - invalid CPU instance.\n");
+        return;
+    }
+    
+    // Reset the general-purpose registers.
+    memset(p_CPU->m_Registers, 0, sizeof(p_CPU->m_Registers));
+
+    // Reset the fixed-point registers.
+    p_CPU->m_FI = 0;
+    p_CPU->m_FF = 0;
+
+    // Reset the program counter and stack pointers.
+    p_CPU->m_PC = TM_CODE_BEGIN;
+    p_CPU->m_DSP = 0xFFFC;
+    p_CPU->m_CSP = 0xFFFC;
+
+    // Reset the internal memory registers.
+    p_CPU->m_MD = 0;
+    p_CPU->m_MA = 0;
+    p_CPU->m_DA = false;
+
+    // Reset the internal instruction registers.
+    p_CPU->m_IA = 0;
+    p_CPU->m_CI = 0;
+    p_CPU->m_OC = 0;
+    p_CPU->m_IP1 = 0;
+    p_CPU->m_IP2 = 0;
+
+    // Reset the interrupt registers.
+    p_CPU->m_IE = 0;
+    p_CPU->m_IF = 0;
+    p_CPU->m_IME = false;
+    p_CPU->m_EI = false;
+
+    // Reset the error registers.
+    p_CPU->m_EA = 0;
+    p_CPU->m_EC = TM_EC_OK;
+
+    // Reset the halt and stop flags.
+    p_CPU->m_Halt = false;
+    p_CPU->m_Stop = false;
+
+    // Discard any cycles which have not yet been passed to the cycle function, and reset the cycle
+    // count. No cycle budget is in effect outside of `TM_RunCPU`.
+    p_CPU->m_PendingCycles = 0;
+    p_CPU->m_CycleCount = 0;
+    p_CPU->m_CycleTarget = UINT64_MAX;
+    p_CPU->m_Break = false;
+
+    // Empty the block cache.
+    if (p_CPU->m_BlockCache != NULL)
+    {
+        memset(p_CPU->m_BlockCache, 0, TM_BLOCK_CACHE_SIZE * sizeof(TM_BasicBlock));
+    }
+    p_CPU->m_Block = NULL;
+    p_CPU->m_BlockIndex = 0;
+    p_CPU->m_Translating = NULL;
+    p_CPU->m_Decoded = NULL;
+    p_CPU->m_Decoding = NULL;
+    p_CPU->m_XRAMCodeBegin = 0;
+    p_CPU->m_XRAMCodeEnd = 0;
+
+    // Discard any compiled code along with the blocks it was compiled from.
+    p_CPU->m_JITArenaUsed = 0;
+
+    // Reset the flags register.
+    p_CPU->m_Flags.m_Register = 0;
+    p_CPU->m_DeferredOp = TM_DF_NONE;
+}
+
+void TM_DestroyCPU (TM_CPU* p_CPU)
+{
+    // Do nothing if the CPU instance is NULL.
+    if (p_CPU == NULL)
+    {
+        return;
+    }
+
+    // Free the memory allocated for the CPU instance, its block cache and its compiled code.
+#if defined(TM_JIT_SUPPORTED)
+    if (p_CPU->m_JITArena != NULL)
+    {
+        munmap(p_CPU->m_JITArena, TM_JIT_ARENA_SIZE);
+    }
+#endif
+    free(p_CPU->m_BlockCache);
+    free(p_CPU);
+    p_CPU = NULL;
+}
+
+void TM_CycleCPU (TM_CPU* p_CPU, uint32_t p_Cycles)
+{
+    // Ensure the given CPU instance, and its cycle function pointer, are valid.
+    if (p_CPU == NULL || p_CPU->m_Cycle == NULL)
+    {
+        fprintf(stderr, "TM: Cannot cycle CPU instance - invalid CPU instance or cycle function pointer.\n");
+        return;
+    }
+
+    p_CPU->m_CycleCount += p_Cycles;
+
+    // If cycle batching is enabled, then accumulate the cycles to be passed to the cycle function
+    // later, when the CPU next synchronizes with the other components on its bus.
+    if (p_CPU->m_BatchCycles == true)
+    {
+        p_CPU->m_PendingCycles += p_Cycles;
+        return;
+    }
+
+    // Otherwise, cycle the other components for the specified number of cycles right away.
+    if (p_CPU->m_Cycle(p_CPU->m_Context, p_Cycles) == false)
+    {
+        TM_SetErrorCode(p_CPU, TM_EC_HARDWARE_FAULT);
+    }
+}
+
+void TM_FlushCPUCycles (TM_CPU* p_CPU)
+{
+    // Ensure the given CPU instance, and its cycle function pointer, are valid.
+    if (p_CPU == NULL || p_CPU->m_Cycle == NULL)
+    {
+        fprintf(stderr, "TM: Cannot flush CPU cycles - invalid CPU instance or cycle function pointer.\n");
+        return;
+    }
+
+    // Nothing to do if there are no pending cycles.
+    if (p_CPU->m_PendingCycles == 0)
+    {
+        return;
+    }
+
+    // Clear the pending cycle count before calling the cycle function, in case the components it
+    // ticks access the bus through this CPU instance.
+    uint32_t l_Cycles = p_CPU->m_PendingCycles;
+    p_CPU->m_PendingCycles = 0;
+
+    // Cycle the other components for all of the pending cycles in one call.
+    if (p_CPU->m_Cycle(p_CPU->m_Context, l_Cycles) == false)
+    {
+        TM_SetErrorCode(p_CPU, TM_EC_HARDWARE_FAULT);
+    }
+}
+
+void TM_SetCycleBatching (TM_CPU* p_CPU, bool p_Enabled)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot set cycle batching - invalid CPU instance.\n");
+        return;
+    }
+
+    // If batching is being disabled, then flush any cycles which are still pending.
+    if (p_Enabled == false)
+    {
+        TM_FlushCPUCycles(p_CPU);
+    }
+
+    p_CPU->m_BatchCycles = p_Enabled;
+}
+
+void TM_SetBusPointerFunction (TM_CPU* p_CPU, TM_BusPointer p_BusPointer)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot set bus pointer function - invalid CPU instance.\n");
+        return;
+    }
+
+    p_CPU->m_BusPointer = p_BusPointer;
+}
+
+void TM_SetNextEventFunction (TM_CPU* p_CPU, TM_NextEvent p_NextEvent)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot set next event function - invalid CPU instance.\n");
+        return;
+    }
+
+    p_CPU->m_NextEvent = p_NextEvent;
+}
+
+bool TM_StepCPU (TM_CPU* p_CPU)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot step CPU instance - invalid CPU instance.\n");
+        return false;
+    }
+
+    // If the CPU is stopped, do nothing.
+    if (p_CPU->m_Stop)
+    {
+        return false;
+    }
+
+    // If the CPU is halted, wait for an interrupt to be requested.
+    if (p_CPU->m_Halt == true)
+    {
+        TM_WaitForInterrupt(p_CPU);
+        return true;
+    }
+
+    // Otherwise, process the next instruction.
+    return TM_DispatchCPU(p_CPU, 1, NULL);
+}
+
+bool TM_RunCPU (TM_CPU* p_CPU, uint64_t p_CycleBudget, uint64_t* p_Cycles, uint64_t* p_Instructions)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot run CPU instance - invalid CPU instance.\n");
+        return false;
+    }
+
+    // Set the cycle count at which to return, taking care not to overflow it.
+    uint64_t l_StartCycles = p_CPU->m_CycleCount;
+    uint64_t l_Instructions = 0;
+    p_CPU->m_CycleTarget = (p_CycleBudget > UINT64_MAX - l_StartCycles) ?
+        UINT64_MAX : l_StartCycles + p_CycleBudget;
+    p_CPU->m_Break = false;
+
+    // Run until the budget is spent, the CPU stops, or a break is requested. The dispatcher returns
+    // whenever the CPU halts, in which case wait for an interrupt here.
+    while (
+        p_CPU->m_Stop == false &&
+        p_CPU->m_Break == false &&
+        p_CPU->m_CycleCount < p_CPU->m_CycleTarget
+    )
+    {
+        if (p_CPU->m_Halt == true)
+        {
+            TM_WaitForInterrupt(p_CPU);
+            continue;
+        }
+
+        uint32_t l_Retired = 0;
+        bool l_Good = TM_DispatchCPU(p_CPU, UINT32_MAX, &l_Retired);
+        l_Instructions += l_Retired;
+
+        if (l_Good == false)
+        {
+            break;
+        }
+    }
+
+    // Report the cycles and instructions retired, and lift the budget.
+    if (p_Cycles != NULL)       { *p_Cycles = p_CPU->m_CycleCount - l_StartCycles; }
+    if (p_Instructions != NULL) { *p_Instructions = l_Instructions; }
+    p_CPU->m_CycleTarget = UINT64_MAX;
+    p_CPU->m_Break = false;
+
+    return p_CPU->m_Stop == false;
+}
+
+void TM_BreakCPU (TM_CPU* p_CPU)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot break CPU instance - invalid CPU instance.\n");
+        return;
+    }
+
+    p_CPU->m_Break = true;
+}
+
+uint8_t TM_ReadByte (const TM_CPU* p_CPU, uint32_t p_Address)
+{
+    // Ensure the given CPU instance, and its bus read function pointer, are valid.
+    if (p_CPU == NULL || p_CPU->m_BusRead == NULL)
+    {
+        fprintf(stderr, "TM: Cannot read byte from CPU instance - invalid CPU instance or bus read function pointer.\n");
+        return 0xFF;
+    }
+
+    // Read a byte from the bus at the specified address.
+    uint8_t l_Byte0 = p_CPU->m_BusRead(p_CPU->m_Context, p_Address);
+    return l_Byte0;
+}
+
+uint16_t TM_ReadWord (const TM_CPU* p_CPU, uint32_t p_Address)
+{
+    // Ensure the given CPU instance, and its bus read function pointer, are valid.
+    if (p_CPU == NULL || p_CPU->m_BusRead == NULL)
+    {
+        fprintf(stderr, "TM: Cannot read word from CPU instance - invalid CPU instance or bus read function pointer.\n");
+        return 0xFFFF;
+    }
+
+    // If the whole word lies in plain memory, then read it directly.
+    if (p_CPU->m_BusPointer != NULL)
+    {
+        const uint8_t* l_Data = p_CPU->m_BusPointer(p_CPU->m_Context, p_Address, 2, false);
+        if (l_Data != NULL)
+        {
+            return (uint16_t) (l_Data[0] | (l_Data[1] << 8));
+        }
+    }
+
+    // Otherwise, read the two bytes making up the word from the bus at the specified address.
+    // Combine them, and return the result.
+    uint16_t l_Word0 = p_CPU->m_BusRead(p_CPU->m_Context, p_Address);
+    uint16_t l_Word1 = p_CPU->m_BusRead(p_CPU->m_Context, p_Address + 1);
+    return (l_Word0 | (l_Word1 << 8));
+}
+
+uint32_t TM_ReadDoubleWord (const TM_CPU* p_CPU, uint32_t p_Address)
+{
+    // Ensure the given CPU instance, and its bus read function pointer, are valid.
+    if (p_CPU == NULL || p_CPU->m_BusRead == NULL)
+    {
+        fprintf(stderr, "TM: Cannot read double word from CPU instance - invalid CPU instance or bus read function pointer.\n");
+        return 0xFFFFFFFF;
+    }
+
+    // If the whole double word lies in plain memory, then read it directly.
+    if (p_CPU->m_BusPointer != NULL)
+    {
+        const uint8_t* l_Data = p_CPU->m_BusPointer(p_CPU->m_Context, p_Address, 4, false);
+        if (l_Data != NULL)
+        {
+            return ((uint32_t) l_Data[0] | ((uint32_t) l_Data[1] << 8) |
+                ((uint32_t) l_Data[2] << 16) | ((uint32_t) l_Data[3] << 24));
+        }
+    }
+
+    // Otherwise, read the four bytes making up the double word from the bus at the specified
+    // address. Combine them, and return the result.
+    uint32_t l_DWord0 = p_CPU->m_BusRead(p_CPU->m_Context, p_Address);
+    uint32_t l_DWord1 = p_CPU->m_BusRead(p_CPU->m_Context, p_Address + 1);
+    uint32_t l_DWord2 = p_CPU->m_BusRead(p_CPU->m_Context, p_Address + 2);
+    uint32_t l_DWord3 = p_CPU->m_BusRead(p_CPU->m_Context, p_Address + 3);
+    return (l_DWord0 | (l_DWord1 << 8) | (l_DWord2 << 16) | (l_DWord3 << 24));
+}
+
+void TM_WriteByte (TM_CPU* p_CPU, uint32_t p_Address, uint8_t p_Data)
+{
+    // Ensure the given CPU instance, and its bus write function pointer, are valid.
+    if (p_CPU == NULL || p_CPU->m_BusWrite == NULL)
+    {
         fprintf(stderr, "TM: Cannot write byte to CPU instance - invalid CPU instance or bus write function pointer.\n");
         return;
     }
 
     // Write a byte to the bus at the specified address.
-    p_CPU->m_BusWrite(p_Address, p_Data);
+    p_CPU->m_BusWrite(p_CPU->m_Context, p_Address, p_Data);
+
+    // If the write landed in executable RAM, then discard any decoded instructions it overwrote.
+    if (p_Address >= TM_XRAM_BEGIN && p_Address <= TM_XRAM_END)
+    {
+        TM_InvalidateCPUCode(p_CPU, p_Address, 1);
+    }
 }
 
 void TM_WriteWord (TM_CPU* p_CPU, uint32_t p_Address, uint16_t p_Data)
@@ -2807,9 +4778,26 @@ void TM_WriteWord (TM_CPU* p_CPU, uint32_t p_Address, uint16_t p_Data)
         return;
     }
 
-    // Write the two bytes making up the word to the bus at the specified address.
-    p_CPU->m_BusWrite(p_Address, p_Data & 0xFF);
-    p_CPU->m_BusWrite(p_Address + 1, (p_Data >> 8) & 0xFF);
+    // If the whole word lies in plain memory, then write it directly. Otherwise, write the two
+    // bytes making up the word to the bus at the specified address.
+    uint8_t* l_Data = (p_CPU->m_BusPointer != NULL) ?
+        p_CPU->m_BusPointer(p_CPU->m_Context, p_Address, 2, true) : NULL;
+    if (l_Data != NULL)
+    {
+        l_Data[0] = p_Data & 0xFF;
+        l_Data[1] = (p_Data >> 8) & 0xFF;
+    }
+    else
+    {
+        p_CPU->m_BusWrite(p_CPU->m_Context, p_Address, p_Data & 0xFF);
+        p_CPU->m_BusWrite(p_CPU->m_Context, p_Address + 1, (p_Data >> 8) & 0xFF);
+    }
+
+    // If the write landed in executable RAM, then discard any decoded instructions it overwrote.
+    if (p_Address >= TM_XRAM_BEGIN && p_Address <= TM_XRAM_END)
+    {
+        TM_InvalidateCPUCode(p_CPU, p_Address, 2);
+    }
 }
 
 void TM_WriteDoubleWord (TM_CPU* p_CPU, uint32_t p_Address, uint32_t p_Data)
@@ -2821,11 +4809,30 @@ void TM_WriteDoubleWord (TM_CPU* p_CPU, uint32_t p_Address, uint32_t p_Data)
         return;
     }
 
-    // Write the four bytes making up the double word to the bus at the specified address.
-    p_CPU->m_BusWrite(p_Address, p_Data & 0xFF);
-    p_CPU->m_BusWrite(p_Address + 1, (p_Data >> 8) & 0xFF);
-    p_CPU->m_BusWrite(p_Address + 2, (p_Data >> 16) & 0xFF);
-    p_CPU->m_BusWrite(p_Address + 3, (p_Data >> 24) & 0xFF);
+    // If the whole double word lies in plain memory, then write it directly. Otherwise, write the
+    // four bytes making up the double word to the bus at the specified address.
+    uint8_t* l_Data = (p_CPU->m_BusPointer != NULL) ?
+        p_CPU->m_BusPointer(p_CPU->m_Context, p_Address, 4, true) : NULL;
+    if (l_Data != NULL)
+    {
+        l_Data[0] = p_Data & 0xFF;
+        l_Data[1] = (p_Data >> 8) & 0xFF;
+        l_Data[2] = (p_Data >> 16) & 0xFF;
+        l_Data[3] = (p_Data >> 24) & 0xFF;
+    }
+    else
+    {
+        p_CPU->m_BusWrite(p_CPU->m_Context, p_Address, p_Data & 0xFF);
+        p_CPU->m_BusWrite(p_CPU->m_Context, p_Address + 1, (p_Data >> 8) & 0xFF);
+        p_CPU->m_BusWrite(p_CPU->m_Context, p_Address + 2, (p_Data >> 16) & 0xFF);
+        p_CPU->m_BusWrite(p_CPU->m_Context, p_Address + 3, (p_Data >> 24) & 0xFF);
+    }
+
+    // If the write landed in executable RAM, then discard any decoded instructions it overwrote.
+    if (p_Address >= TM_XRAM_BEGIN && p_Address <= TM_XRAM_END)
+    {
+        TM_InvalidateCPUCode(p_CPU, p_Address, 4);
+    }
 }
 
 void TM_RequestInterrupt (TM_CPU* p_CPU, uint8_t p_Interrupt)
@@ -2850,29 +4857,15 @@ uint32_t TM_GetRegister (const TM_CPU* p_CPU, TM_CPURegister p_Register)
         return 0;
     }
 
-    // Return the value of the specified register.
-    switch (p_Register)
-    {
-        case TM_REG_A:  return p_CPU->m_A;
-        case TM_REG_AW: return p_CPU->m_A & 0xFFFF;
-        case TM_REG_AH: return (p_CPU->m_A >> 8) & 0xFF;
-        case TM_REG_AL: return p_CPU->m_A & 0xFF;
-        case TM_REG_B:  return p_CPU->m_B;
-        case TM_REG_BW: return p_CPU->m_B & 0xFFFF;
-        case TM_REG_BH: return (p_CPU->m_B >> 8) & 0xFF;
-        case TM_REG_BL: return p_CPU->m_B & 0xFF;
-        case TM_REG_C:  return p_CPU->m_C;
-        case TM_REG_CW: return p_CPU->m_C & 0xFFFF;
-        case TM_REG_CH: return (p_CPU->m_C >> 8) & 0xFF;
-        case TM_REG_CL: return p_CPU->m_C & 0xFF;
-        case TM_REG_E:  return p_CPU->m_E;
-        case TM_REG_EW: return p_CPU->m_E & 0xFFFF;
-        case TM_REG_EH: return (p_CPU->m_E >> 8) & 0xFF;
-        case TM_REG_EL: return p_CPU->m_E & 0xFF;
-        default:
-            fprintf(stderr, "TM: Invalid register specified.\n");
-            return 0;
+    // Ensure the given register is valid.
+    if ((unsigned) p_Register > TM_REG_EL)
+    {
+        fprintf(stderr, "TM: Invalid register specified.\n");
+        return 0;
     }
+
+    // Return the value of the specified register.
+    return TM_ReadRegister(p_CPU, p_Register);
 }
 
 void TM_SetRegister (TM_CPU* p_CPU, TM_CPURegister p_Register, uint32_t p_Value)
@@ -2884,29 +4877,15 @@ void TM_SetRegister (TM_CPU* p_CPU, TM_CPURegister p_Register, uint32_t p_Value)
         return;
     }
 
-    // Set the value of the specified register.
-    switch (p_Register)
-    {
-        case TM_REG_A:  p_CPU->m_A = p_Value; break;
-        case TM_REG_AW: p_CPU->m_A = (p_CPU->m_A & 0xFFFF0000) | (p_Value & 0xFFFF); break;
-        case TM_REG_AH: p_CPU->m_A = (p_CPU->m_A & 0xFFFF00FF) | ((p_Value & 0xFF) << 8); break;
-        case TM_REG_AL: p_CPU->m_A = (p_CPU->m_A & 0xFFFFFF00) | (p_Value & 0xFF); break;
-        case TM_REG_B:  p_CPU->m_B = p_Value; break;
-        case TM_REG_BW: p_CPU->m_B = (p_CPU->m_B & 0xFFFF0000) | (p_Value & 0xFFFF); break;
-        case TM_REG_BH: p_CPU->m_B = (p_CPU->m_B & 0xFFFF00FF) | ((p_Value & 0xFF) << 8); break;
-        case TM_REG_BL: p_CPU->m_B = (p_CPU->m_B & 0xFFFFFF00) | (p_Value & 0xFF); break;
-        case TM_REG_C:  p_CPU->m_C = p_Value; break;
-        case TM_REG_CW: p_CPU->m_C = (p_CPU->m_C & 0xFFFF0000) | (p_Value & 0xFFFF); break;
-        case TM_REG_CH: p_CPU->m_C = (p_CPU->m_C & 0xFFFF00FF) | ((p_Value & 0xFF) << 8); break;
-        case TM_REG_CL: p_CPU->m_C = (p_CPU->m_C & 0xFFFFFF00) | (p_Value & 0xFF); break;
-        case TM_REG_E:  p_CPU->m_E = p_Value; break;
-        case TM_REG_EW: p_CPU->m_E = (p_CPU->m_E & 0xFFFF0000) | (p_Value & 0xFFFF); break;
-        case TM_REG_EH: p_CPU->m_E = (p_CPU->m_E & 0xFFFF00FF) | ((p_Value & 0xFF) << 8); break;
-        case TM_REG_EL: p_CPU->m_E = (p_CPU->m_E & 0xFFFFFF00) | (p_Value & 0xFF); break;
-        default:
-            fprintf(stderr, "TM: Invalid register specified.\n");
-            break;
+    // Ensure the given register is valid.
+    if ((unsigned) p_Register > TM_REG_EL)
+    {
+        fprintf(stderr, "TM: Invalid register specified.\n");
+        return;
     }
+
+    // Set the value of the specified register.
+    TM_WriteRegister(p_CPU, p_Register, p_Value);
 }
 
 bool TM_GetFlag (const TM_CPU* p_CPU, TM_CPUFlag p_Flag)
@@ -2918,13 +4897,14 @@ bool TM_GetFlag (const TM_CPU* p_CPU, TM_CPUFlag p_Flag)
         return false;
     }
 
-    // Return the value of the specified flag.
+    // Return the value of the specified flag, including the effect of any deferred flags.
     switch (p_Flag)
     {
-        case TM_FLAG_Z: return p_CPU->m_Flags.m_Z;
-        case TM_FLAG_N: return p_CPU->m_Flags.m_N;
-        case TM_FLAG_H: return p_CPU->m_Flags.m_H;
-        case TM_FLAG_C: return p_CPU->m_Flags.m_C;
+        case TM_FLAG_Z:
+        case TM_FLAG_N:
+        case TM_FLAG_H:
+        case TM_FLAG_C:
+            return (TM_EvaluateFlags(p_CPU) >> p_Flag) & 1;
         default:
             fprintf(stderr, "TM: Invalid flag specified.\n");
             return false;
@@ -2940,6 +4920,8 @@ void TM_SetFlag (TM_CPU* p_CPU, TM_CPUFlag p_Flag, bool p_Value)
         return;
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the value of the specified flag.
     switch (p_Flag)
     {
@@ -2962,6 +4944,8 @@ void TM_SetFlags (TM_CPU* p_CPU, int8_t p_Z, int8_t p_N, int8_t p_H, int8_t p_C)
         return;
     }
 
+    TM_ResolveFlags(p_CPU);
+
     // Set the values of the specified flags. If negative values are passed, the flags are left unchanged.
     if (p_Z >= 0) { p_CPU->m_Flags.m_Z = (p_Z > 0); }
     if (p_N >= 0) { p_CPU->m_Flags.m_N = (p_N > 0); }
@@ -3140,3 +5124,99 @@ bool TM_IsStopped (const TM_CPU* p_CPU)
     // Return the value of the stop flag.
     return p_CPU->m_Stop;
 }
+
+void* TM_GetCPUContext (const TM_CPU* p_CPU)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot get context pointer - invalid CPU instance.\n");
+        return NULL;
+    }
+
+    // Return the context pointer.
+    return p_CPU->m_Context;
+}
+
+void TM_InvalidateCPUCode (TM_CPU* p_CPU, uint32_t p_Address, uint32_t p_Size)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot invalidate decoded code - invalid CPU instance.\n");
+        return;
+    }
+
+    // Only instructions in XRAM can be overwritten. If the range overlaps the range of XRAM covered
+    // by translated blocks, then invalidate every block which overlaps it.
+    uint64_t l_Begin = p_Address;
+    uint64_t l_End = (uint64_t) p_Address + p_Size;
+    if (l_End > p_CPU->m_XRAMCodeBegin && l_Begin < p_CPU->m_XRAMCodeEnd)
+    {
+        for (uint32_t i = 0; i < TM_BLOCK_CACHE_SIZE; ++i)
+        {
+            TM_BasicBlock* l_Block = &p_CPU->m_BlockCache[i];
+            if (l_End > l_Block->m_Address && l_Begin < l_Block->m_EndAddress)
+            {
+                l_Block->m_Valid = false;
+            }
+        }
+    }
+
+    // If the block being translated overlaps the range, including the instruction currently being
+    // translated, then abandon it.
+    TM_BasicBlock* l_Translating = p_CPU->m_Translating;
+    if (l_Translating != NULL &&
+        l_End > l_Translating->m_Address &&
+        l_Begin < (uint64_t) l_Translating->m_EndAddress + TM_MAX_INSTRUCTION_SIZE)
+    {
+        l_Translating->m_Length = 0;
+        p_CPU->m_Translating = NULL;
+        p_CPU->m_Decoding = NULL;
+    }
+}
+
+bool TM_SetJITCompilation (TM_CPU* p_CPU, bool p_Enabled)
+{
+    // Ensure the given CPU instance is valid.
+    if (p_CPU == NULL)
+    {
+        fprintf(stderr, "TM: Cannot set JIT compilation - invalid CPU instance.\n");
+        return false;
+    }
+
+    // Disabling the JIT compiler always succeeds. Any compiled code is kept, in case it is enabled
+    // again.
+    if (p_Enabled == false)
+    {
+        p_CPU->m_JITEnabled = false;
+        return true;
+    }
+
+#if defined(TM_JIT_SUPPORTED)
+
+    // Allocate the arena for compiled code, if it has not been already.
+    if (p_CPU->m_JITArena == NULL)
+    {
+        void* l_Arena = mmap(NULL, TM_JIT_ARENA_SIZE, PROT_READ | PROT_EXEC,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (l_Arena == MAP_FAILED)
+        {
+            perror("TM: Failed to allocate memory for the JIT compiler");
+            return false;
+        }
+
+        p_CPU->m_JITArena = (uint8_t*) l_Arena;
+        p_CPU->m_JITArenaUsed = 0;
+    }
+
+    p_CPU->m_JITEnabled = true;
+    return true;
+
+#else
+
+    fprintf(stderr, "TM: Cannot enable JIT compilation - not supported on this platform.\n");
+    return false;
+
+#endif
+}
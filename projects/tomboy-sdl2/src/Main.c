@@ -150,17 +150,29 @@ static void TOMBOY_Update ()
 
 static void TOMBOY_Render (TOMBOY_PPU* p_PPU)
 {
-    uint32_t*       l_Pixels = NULL;
-    int32_t         l_Pitch = 0;
+    const uint8_t* l_Screen = TOMBOY_GetScreenBuffer(p_PPU);
+    size_t l_Pitch = TOMBOY_GetScreenPitch(p_PPU);
 
-    // Lock the texture for writing.
-    SDL_LockTexture(s_RenderTarget, NULL, (void**) &l_Pixels, &l_Pitch);
+    // Upload only the scanlines which changed since the previous frame, a run of them at a time.
+    for (uint8_t l_Line = 0; l_Line < TOMBOY_PPU_SCREEN_HEIGHT; )
+    {
+        if (TOMBOY_IsScanlineDirty(p_PPU, l_Line) == false)
+        {
+            l_Line++;
+            continue;
+        }
 
-    // Get the screen buffer from the PPU. Copy its data into the pixels buffer.
-    SDL_memcpy(l_Pixels, TOMBOY_GetScreenBuffer(p_PPU), TOMBOY_PPU_SCREEN_BUFFER_SIZE);
+        uint8_t l_First = l_Line;
+        while (l_Line < TOMBOY_PPU_SCREEN_HEIGHT && TOMBOY_IsScanlineDirty(p_PPU, l_Line) == true)
+        {
+            l_Line++;
+        }
 
-    // Unlock the texture, then render it.
-    SDL_UnlockTexture(s_RenderTarget);
+        SDL_Rect l_Rect = { 0, l_First, TOMBOY_PPU_SCREEN_WIDTH, l_Line - l_First };
+        SDL_UpdateTexture(s_RenderTarget, &l_Rect, &l_Screen[l_First * l_Pitch], (int) l_Pitch);
+    }
+
+    // Render the texture.
     SDL_RenderCopy(s_Renderer, s_RenderTarget, NULL, NULL);
     SDL_RenderPresent(s_Renderer);
 }
@@ -187,6 +199,21 @@ static void TOMBOY_OnAudioMix (const TOMBOY_AudioSample* p_Sample)
 
 // Private Functions - Start and Exit //////////////////////////////////////////////////////////////
 
+static uint32_t TOMBOY_GetTextureFormat (TOMBOY_PixelFormat p_Format)
+{
+    // SDL's packed formats name their channels from the most significant bit down, as the engine's
+    // do, so the screen buffer can be uploaded to a texture of the same format as it is. SDL cannot
+    // stream to an indexed texture.
+    switch (p_Format)
+    {
+        case TOMBOY_PF_RGBA8888:    return SDL_PIXELFORMAT_RGBA8888;
+        case TOMBOY_PF_ARGB8888:    return SDL_PIXELFORMAT_ARGB8888;
+        case TOMBOY_PF_BGRA8888:    return SDL_PIXELFORMAT_BGRA8888;
+        case TOMBOY_PF_RGB565:      return SDL_PIXELFORMAT_RGB565;
+        default:                    return SDL_PIXELFORMAT_UNKNOWN;
+    }
+}
+
 static void TOMBOY_AtStart (const char* p_ProgramFilename)
 {
     // Initialize SDL.
@@ -250,10 +277,18 @@ static void TOMBOY_AtStart (const char* p_ProgramFilename)
         exit(EXIT_FAILURE);
     }
 
-    // Create the SDL texture for rendering.
+    // Create the SDL texture for rendering, in the pixel format the PPU draws in.
+    TOMBOY_PPU* l_PPU = TOMBOY_GetPPU(s_Engine);
+    uint32_t l_TextureFormat = TOMBOY_GetTextureFormat(TOMBOY_GetPixelFormat(l_PPU));
+    if (l_TextureFormat == SDL_PIXELFORMAT_UNKNOWN)
+    {
+        fprintf(stderr, "The PPU's pixel format has no matching SDL texture format.\n");
+        exit(EXIT_FAILURE);
+    }
+
     s_RenderTarget = SDL_CreateTexture(
         s_Renderer,
-        SDL_PIXELFORMAT_RGBA8888,
+        l_TextureFormat,
         SDL_TEXTUREACCESS_STREAMING,
         TOMBOY_PPU_SCREEN_WIDTH,
         TOMBOY_PPU_SCREEN_HEIGHT
@@ -264,6 +299,10 @@ static void TOMBOY_AtStart (const char* p_ProgramFilename)
         exit(EXIT_FAILURE);
     }
 
+    // Seed the texture with the whole screen buffer; only changed scanlines are uploaded after this.
+    SDL_UpdateTexture(s_RenderTarget, NULL, TOMBOY_GetScreenBuffer(l_PPU),
+        (int) TOMBOY_GetScreenPitch(l_PPU));
+
     // Prepare the audio device.
     SDL_AudioSpec l_DesiredSpec = { 0 }, l_ObtainedSpec = { 0 };
     l_DesiredSpec.freq = TOMBOY_AUDIO_SAMPLE_RATE;
@@ -319,10 +358,11 @@ int main (int argc, char** argv)
     atexit(TOMBOY_AtExit);
     TOMBOY_AtStart(argv[1]);
 
-    // Tick the engine until the program is finished.
+    // Run the engine, a frame's worth of CPU cycles at a time, until the program is finished. Each
+    // CPU cycle is four PPU dots.
     while (true)
     {
-        if (TOMBOY_TickEngine() == false)
+        if (TOMBOY_RunEngine(s_Engine, TOMBOY_PPU_DOTS_PER_FRAME / 4) == false)
         {
             break;
         }
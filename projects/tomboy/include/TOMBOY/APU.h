@@ -582,6 +582,32 @@ const TOMBOY_AudioSample* TOMBOY_GetLatestAudioSample (const TOMBOY_APU* p_APU);
  */
 bool TOMBOY_TickAPU (TOMBOY_APU* p_APU, bool p_DIV);
 
+/**
+ * @brief Advances the given TOMBOY APU instance by the given number of ticks at once, leaving it in
+ *        the same state, and making the same mix callbacks, as ticking it once per cycle would.
+ * 
+ * Between the cycles on which something happens - a mix, a tick of the noise channel, an overflow
+ * of a channel's period divider - the channels' period dividers are stepped in bulk.
+ * 
+ * @param p_APU    A pointer to the TOMBOY APU instance to advance.
+ * @param p_Cycle  The engine's cycle count before the first of the ticks.
+ * @param p_Ticks  The number of ticks to advance the APU by.
+ * @param p_DIV    Does the APU's internal divider need to be ticked on the last of the ticks?
+ * 
+ * @return `true` if the APU was advanced successfully; `false` otherwise.
+ */
+bool TOMBOY_AdvanceAPU (TOMBOY_APU* p_APU, uint64_t p_Cycle, uint32_t p_Ticks, bool p_DIV);
+
+/**
+ * @brief Gets the number of ticks until the given TOMBOY APU instance next mixes an audio sample.
+ * 
+ * @param p_APU    A pointer to the TOMBOY APU instance to check.
+ * @param p_Cycle  The engine's current cycle count.
+ * 
+ * @return The number of ticks until the next audio sample is mixed; at least 1.
+ */
+uint32_t TOMBOY_GetTicksUntilAudioMix (const TOMBOY_APU* p_APU, uint64_t p_Cycle);
+
 // Public Function Prototypes - Memory Access //////////////////////////////////////////////////////
 
 /**
@@ -103,9 +103,12 @@ void TOMBOY_ResetEngine (TOMBOY_Engine* p_Engine);
 void TOMBOY_DestroyEngine (TOMBOY_Engine* p_Engine);
 
 /**
- * @brief Makes the given TOMBOY emulator engine instance the current engine. The bus and cycle
- *        functions passed into the CPU component, as well the `TOMBOY_TickEngine` function, will
- *        use this engine instance.
+ * @brief Makes the given TOMBOY emulator engine instance the current engine. The shortform
+ *        `TOMBOY_TickEngine` function will use this engine instance.
+ * 
+ * The bus and cycle functions passed into the CPU component do not depend on the current engine;
+ * each engine's CPU is handed a pointer to its owning engine as its bus context. Multiple engines
+ * can therefore be run side-by-side, each driven by `TOMBOY_StepEngine`.
  * 
  * @param p_Engine      A pointer to the TOMBOY engine instance to set as the current engine.
  */
@@ -134,6 +137,52 @@ bool TOMBOY_IsCurrentEngineSet ();
  */
 bool TOMBOY_TickEngine ();
 
+/**
+ * @brief Steps the given TOMBOY emulator engine instance, prompting its CPU to execute the next
+ *        instruction, and updating the engine's components.
+ * 
+ * Unlike `TOMBOY_TickEngine`, this function does not depend on the current engine, and so may be
+ * used to drive several engine instances, including on separate threads, as long as each engine
+ * instance is only ever stepped by one thread at a time.
+ * 
+ * @param p_Engine      A pointer to the TOMBOY engine instance to step.
+ * 
+ * @return `true` if the engine's components ticked with no errors; `false` otherwise, or if the
+ *         engine instance is `NULL`.
+ */
+bool TOMBOY_StepEngine (TOMBOY_Engine* p_Engine);
+
+/**
+ * @brief Runs the given TOMBOY emulator engine instance for the given number of CPU cycles,
+ *        updating the engine's components as it goes.
+ * 
+ * This is equivalent to calling `TOMBOY_StepEngine` repeatedly, but far cheaper, as the CPU runs
+ * instructions back-to-back in a single call. A frame's worth of cycles is a sensible budget for a
+ * frontend's main loop.
+ * 
+ * @param p_Engine      A pointer to the TOMBOY engine instance to run.
+ * @param p_Cycles      The number of CPU cycles to run the engine for.
+ * 
+ * @return `true` if the engine's components ran with no errors; `false` otherwise, or if the
+ *         engine instance is `NULL`.
+ */
+bool TOMBOY_RunEngine (TOMBOY_Engine* p_Engine, uint64_t p_Cycles);
+
+/**
+ * @brief Sets whether the given TOMBOY emulator engine instance brings its timer, APU and PPU up to
+ *        date only as their scheduled events fall due, or when the program accesses them (the
+ *        default), or on every tick.
+ * 
+ * Updating the components on every tick is far slower, but does not rely on the event deadlines
+ * being correct, so it serves as a reference to check the scheduled mode against. The program
+ * observes the same component state, at the same cycles, in both modes.
+ * 
+ * @param p_Engine      A pointer to the TOMBOY engine instance to configure.
+ * @param p_Enabled     `true` to update the components by scheduled events; `false` to update them
+ *                      on every tick.
+ */
+void TOMBOY_SetEventScheduling (TOMBOY_Engine* p_Engine, bool p_Enabled);
+
 /**
  * @brief Gets the number of cycles elapsed on the given TOMBOY emulator engine instance.
  * 
@@ -193,6 +242,19 @@ TOMBOY_PPU* TOMBOY_GetPPU (TOMBOY_Engine* p_Engine);
  */
 TOMBOY_Joypad* TOMBOY_GetJoypad (TOMBOY_Engine* p_Engine);
 
+/**
+ * @brief Gets a pointer to the host memory backing a range of addresses on the given TOMBOY emulator
+ *        engine's bus, so that the range can be read in one block.
+ * 
+ * @param p_Engine      A pointer to the TOMBOY engine instance whose bus is to be read.
+ * @param p_Address     The address of the first byte of the range.
+ * @param p_Size        The size of the range, in bytes.
+ * 
+ * @return A pointer to the range's first byte, or `NULL` if any byte of the range lies outside of
+ *         plain memory (ROM, WRAM, SRAM, XRAM, the stacks or QRAM), or if the engine is not set.
+ */
+const uint8_t* TOMBOY_GetBusReadPointer (TOMBOY_Engine* p_Engine, uint32_t p_Address, uint32_t p_Size);
+
 /**
  * @brief Sets key callback functions for the given TOMBOY emulator engine instance.
  * 
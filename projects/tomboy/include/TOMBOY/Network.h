@@ -92,6 +92,16 @@ void TOMBOY_ResetNetwork (TOMBOY_Network* p_Network);
  */
 bool TOMBOY_TickNetwork (TOMBOY_Network* p_Network);
 
+/**
+ * @brief Checks whether the TOMBOY network interface has a network operation in progress, which
+ *        could complete, and request the network interrupt, on any tick.
+ * 
+ * @param p_Network     A pointer to the network interface to check.
+ * 
+ * @return `true` if a network operation is in progress, `false` otherwise.
+ */
+bool TOMBOY_IsNetworkBusy (const TOMBOY_Network* p_Network);
+
 /**
  * @brief Connects the TOMBOY network interface to a remote host.
  * 
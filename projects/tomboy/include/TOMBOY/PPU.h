@@ -316,8 +316,23 @@
 #define TOMBOY_PPU_SCREEN_WIDTH 160
 #define TOMBOY_PPU_SCREEN_HEIGHT 144
 #define TOMBOY_PPU_SCREEN_PIXEL_SIZE (TOMBOY_PPU_SCREEN_WIDTH * TOMBOY_PPU_SCREEN_HEIGHT)
+
+/** @brief The size of the PPU's screen buffer in bytes, in the widest output pixel format. */
 #define TOMBOY_PPU_SCREEN_BUFFER_SIZE (TOMBOY_PPU_SCREEN_PIXEL_SIZE * sizeof(uint32_t))
 
+/** @brief The number of 64-bit words in the bitmap of the screen buffer's changed scanlines. */
+#define TOMBOY_PPU_DIRTY_LINE_WORDS ((TOMBOY_PPU_SCREEN_HEIGHT + 63) / 64)
+
+/**
+ * @brief The number of colors in the palette of the indexed pixel format: the colors of the
+ *        background CRAM's palettes, then those of the object CRAM's palettes, then the four DMG
+ *        shades of gray, from lightest to darkest.
+ */
+#define TOMBOY_PPU_INDEXED_COLOR_COUNT (2 * TOMBOY_PPU_PALETTE_COUNT * TOMBOY_PPU_PALETTE_COLOR_COUNT + 4)
+
+/** @brief The number of screen buffers the PPU cycles through as it hands its frames off. */
+#define TOMBOY_PPU_FRAME_BUFFER_COUNT 3
+
 /** @brief The size of a bank of video RAM, and its partitions, each in bytes. */
 #define TOMBOY_PPU_VRAM_BANK_SIZE 0x2000
 #define TOMBOY_PPU_TDATA_PARTITION_SIZE 0x1800
@@ -420,6 +435,33 @@ typedef enum TOMBOY_ObjectPriorityMode
     TOMBOY_OPM_X_POSITION                ///< @brief The PPU uses the object's X position to determine its priority; objects with a smaller X position have higher priority over other objects, with ties broken by the object's index in OAM.
 } TOMBOY_ObjectPriorityMode;
 
+// Render Mode Enumeration /////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief An enumeration representing the ways in which the PPU can draw its scanlines.
+ */
+typedef enum TOMBOY_RenderMode
+{
+    TOMBOY_RM_ACCURATE = 0,     ///< @brief The pixel fetcher and FIFO draw each scanline a dot at a time, seeing register and memory writes made part-way through it.
+    TOMBOY_RM_FAST              ///< @brief Each scanline is drawn in one pass as its pixel transfer ends, using the registers as they stood when the transfer began.
+} TOMBOY_RenderMode;
+
+// Pixel Format Enumeration ////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief An enumeration representing the formats in which the PPU can write pixels to its screen
+ *        buffer. The 32-bit and 16-bit formats are packed into host-endian integers, and are named
+ *        as SDL names its packed pixel formats.
+ */
+typedef enum TOMBOY_PixelFormat
+{
+    TOMBOY_PF_RGBA8888 = 0,     ///< @brief 32 bits per pixel, as `0xRRGGBBAA`.
+    TOMBOY_PF_ARGB8888,         ///< @brief 32 bits per pixel, as `0xAARRGGBB`. On little-endian hosts, this is laid out in memory as BGRA, or BGRX, which many video encoders take.
+    TOMBOY_PF_BGRA8888,         ///< @brief 32 bits per pixel, as `0xBBGGRRAA`.
+    TOMBOY_PF_RGB565,           ///< @brief 16 bits per pixel, as `0bRRRRRGGGGGGBBBBB`.
+    TOMBOY_PF_INDEXED8          ///< @brief 8 bits per pixel, each an index into the palette given by @a TOMBOY_GetIndexedPalette.
+} TOMBOY_PixelFormat;
+
 // Graphics Mode Enumeration ///////////////////////////////////////////////////////////////////////
 
 /**
@@ -658,6 +700,34 @@ typedef struct TOMBOY_ColorRGB555
     uint16_t : 1;          ///< @brief The unused bit at the end of the color sequence.
 } TOMBOY_ColorRGB555;
 
+// Decoded Tile Structure //////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief A structure representing a tile from the tile data area of a VRAM bank, decoded from the
+ *        2bpp planar form in which it is stored into the color indices of its pixels.
+ */
+typedef struct TOMBOY_DecodedTile
+{
+    uint8_t m_Rows[8][8];         ///< @brief The color indices of the tile's pixels, row by row, from left to right.
+    uint8_t m_FlippedRows[8][8];  ///< @brief The same color indices, with each row mirrored, for tiles flipped horizontally.
+} TOMBOY_DecodedTile;
+
+// PPU Kernel Set Enumeration //////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief An enumeration representing the sets of kernels the PPU can decode tiles and color
+ *        scanlines with, each written for an instruction set the host may support. Of those the host
+ *        supports, the PPU picks the last set providing each kernel.
+ */
+typedef enum TOMBOY_PPUKernelSet
+{
+    TOMBOY_PKS_SCALAR = 0,      ///< @brief Both kernels, in plain C. Supported by every host.
+    TOMBOY_PKS_SSE2,            ///< @brief The tile decoding kernel, using SSE2.
+    TOMBOY_PKS_BMI2,            ///< @brief The tile decoding kernel, using BMI2's bit deposit instruction.
+    TOMBOY_PKS_AVX2,            ///< @brief The color lookup kernel, using AVX2's lane permute instruction.
+    TOMBOY_PKS_COUNT            ///< @brief The number of kernel sets.
+} TOMBOY_PPUKernelSet;
+
 // PPU Pixel Fetcher Structure /////////////////////////////////////////////////////////////////////
 
 /**
@@ -684,6 +754,8 @@ typedef struct TOMBOY_PixelFetcher
         TOMBOY_TileAttributes     m_TileAttributes;   ///< @brief The attributes of the fetched tile.
         uint8_t                   m_TileDataLow;      ///< @brief The low byte of the fetched tile data.
         uint8_t                   m_TileDataHigh;     ///< @brief The high byte of the fetched tile data.
+        const uint8_t*            m_TileRow;          ///< @brief The color indices of the fetched row of the tile, flipped as the tile is.
+        uint8_t                   m_RowBuffer[8];     ///< @brief Holds the fetched row's color indices if its low byte changed in VRAM before its high byte was fetched.
     } m_FetchedBGW;
 
     // Fetched Tile Data - Object Layer
@@ -692,6 +764,8 @@ typedef struct TOMBOY_PixelFetcher
         uint8_t                   m_ObjectIndices[3]; ///< @brief The indices of the fetched objects' tiles in the tile data buffer.
         uint8_t                   m_TileDataLow[3];   ///< @brief The low bytes of the fetched objects' tile data.
         uint8_t                   m_TileDataHigh[3];  ///< @brief The high bytes of the fetched objects' tile data.
+        const uint8_t*            m_TileRows[3];      ///< @brief The color indices of the fetched rows of the objects' tiles, flipped as the objects are.
+        uint8_t                   m_RowBuffers[3][8]; ///< @brief Hold the fetched rows' color indices if their low bytes changed in VRAM before their high bytes were fetched.
         uint8_t                   m_ObjectCount;      ///< @brief The number of objects fetched. Maximum of 3.
     } m_FetchedOBJ;
 
@@ -739,6 +813,137 @@ void TOMBOY_ResetPPU (TOMBOY_PPU* p_PPU);
  */
 void TOMBOY_SetFrameRenderedCallback (TOMBOY_PPU* p_PPU, TOMBOY_FrameRenderedCallback p_Callback);
 
+/**
+ * @brief Sets the way in which the PPU draws its scanlines, from the next scanline on. The PPU keeps
+ *        the same timing, and makes the same interrupt requests, in either mode. The mode is kept
+ *        when the PPU is reset.
+ * 
+ * @param p_PPU     A pointer to the PPU structure.
+ * @param p_Mode    The render mode to use.
+ */
+void TOMBOY_SetRenderMode (TOMBOY_PPU* p_PPU, TOMBOY_RenderMode p_Mode);
+
+/**
+ * @brief Gets the way in which the PPU draws its scanlines.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return The PPU's render mode.
+ */
+TOMBOY_RenderMode TOMBOY_GetRenderMode (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Sets whether the PPU skips drawing the frames it begins from now on. A skipped frame keeps
+ *        the same timing, makes the same interrupt requests and calls the frame rendered callback
+ *        as a drawn frame does, but its tiles and objects are not fetched, and the screen buffer
+ *        keeps the last frame drawn. The setting takes effect from the next frame's first scanline,
+ *        so it can be changed from the frame rendered callback to draw only every Nth frame. It is
+ *        kept when the PPU is reset.
+ * 
+ * @param p_PPU     A pointer to the PPU structure.
+ * @param p_Skip    `true` to skip drawing frames; `false` to draw them.
+ */
+void TOMBOY_SetFrameSkip (TOMBOY_PPU* p_PPU, bool p_Skip);
+
+/**
+ * @brief Gets whether the PPU skips drawing the frames it begins.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return `true` if the PPU skips drawing frames; `false` otherwise.
+ */
+bool TOMBOY_GetFrameSkip (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Checks whether the drawing of the PPU's current frame is skipped. From within the frame
+ *        rendered callback, this tells whether the screen buffer holds a newly drawn frame.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return `true` if the current frame is not being drawn; `false` otherwise.
+ */
+bool TOMBOY_IsFrameSkipped (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Sets whether the PPU hands its finished frames off to another thread. While this is set,
+ *        the PPU draws into one of `TOMBOY_PPU_FRAME_BUFFER_COUNT` screen buffers, and publishes
+ *        each frame which changed anything by swapping it with the pending buffer just before the
+ *        frame rendered callback is called. A render thread can then pick up the latest finished
+ *        frame with @a TOMBOY_AcquireFrame at any time, without locking, copying or tearing, while
+ *        the emulation keeps running. The setting is kept when the PPU is reset.
+ * 
+ * @param p_PPU     A pointer to the PPU structure.
+ * @param p_Handoff `true` to hand frames off; `false` to draw into a single screen buffer.
+ * 
+ * @note    This should be set before the render thread starts acquiring frames. That thread must
+ *          stop doing so before the PPU is reset or destroyed.
+ */
+void TOMBOY_SetFrameHandoff (TOMBOY_PPU* p_PPU, bool p_Handoff);
+
+/**
+ * @brief Gets whether the PPU hands its finished frames off to another thread.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return `true` if the PPU hands frames off; `false` otherwise.
+ */
+bool TOMBOY_GetFrameHandoff (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Sets the format in which the PPU writes pixels to its screen buffer. The palette caches
+ *        hold their colors in this format, so the PPU draws each pixel in it directly, and the
+ *        narrower formats cut the screen buffer's size, and the bytes written to it, accordingly.
+ *        Programs which access the screen buffer's memory see its pixels in this format, too.
+ *        Changing the format clears the screen buffer. The setting is kept when the PPU is reset.
+ * 
+ * @param p_PPU     A pointer to the PPU structure.
+ * @param p_Format  The pixel format to use.
+ * 
+ * @note    As with @a TOMBOY_SetFrameHandoff, this should not be called while another thread is
+ *          acquiring frames.
+ */
+void TOMBOY_SetPixelFormat (TOMBOY_PPU* p_PPU, TOMBOY_PixelFormat p_Format);
+
+/**
+ * @brief Gets the format in which the PPU writes pixels to its screen buffer.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return The PPU's pixel format.
+ */
+TOMBOY_PixelFormat TOMBOY_GetPixelFormat (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Decodes a tile's 16 bytes of data with the tile decoding kernel of the given set, whether
+ *        or not it is the one the PPU picked. This allows the kernels to be checked against one
+ *        another.
+ * 
+ * @param p_Set     The kernel set whose tile decoding kernel is to be used.
+ * @param p_Data    The tile's data, in the 2bpp planar form in which it is stored in VRAM.
+ * @param p_Tile    The decoded tile to fill.
+ * 
+ * @return `true` if the tile was decoded; `false` if the set has no tile decoding kernel, or the
+ *         host does not support it.
+ */
+bool TOMBOY_DecodeTileWithKernel (TOMBOY_PPUKernelSet p_Set, const uint8_t* p_Data,
+    TOMBOY_DecodedTile* p_Tile);
+
+/**
+ * @brief Looks up the colors of 8 color indices in a 4-color palette with the color lookup kernel
+ *        of the given set, whether or not it is the one the PPU picked. This allows the kernels to be
+ *        checked against one another.
+ * 
+ * @param p_Set     The kernel set whose color lookup kernel is to be used.
+ * @param p_Row     The 8 color indices, each from 0 to 3, as in a row of a decoded tile.
+ * @param p_Palette The palette's 4 colors.
+ * @param p_Colors  The array of 8 colors to fill.
+ * 
+ * @return `true` if the colors were looked up; `false` if the set has no color lookup kernel, or
+ *         the host does not support it.
+ */
+bool TOMBOY_LookupColorsWithKernel (TOMBOY_PPUKernelSet p_Set, const uint8_t* p_Row,
+    const uint32_t* p_Palette, uint32_t* p_Colors);
+
 /**
  * @brief Ticks the specified instance of the TOMBOY pixel processing unit (PPU) component, updating
  *        its internal state and continuing the rendering of the current frame.
@@ -748,15 +953,111 @@ void TOMBOY_SetFrameRenderedCallback (TOMBOY_PPU* p_PPU, TOMBOY_FrameRenderedCal
  */
 void TOMBOY_TickPPU (TOMBOY_PPU* p_PPU, bool p_ODMA);
 
+/**
+ * @brief Advances the specified instance of the TOMBOY pixel processing unit (PPU) component by the
+ *        given number of ticks at once, leaving it in the same state, and making the same interrupt
+ *        requests and frame rendered callbacks, as ticking it once per cycle would.
+ * 
+ * The dots of the blanking periods which only count towards the end of the scanline, those of the
+ * pixel transfer in the fast render mode, and those which pass while the display is disabled, are
+ * skipped in bulk.
+ * 
+ * @param p_PPU         A pointer to the PPU structure to advance.
+ * @param p_Cycle       The engine's cycle count before the first of the ticks.
+ * @param p_Ticks       The number of ticks to advance the PPU by.
+ * @param p_ODMAPeriod  The OAM DMA process is ticked on cycles which are a multiple of this.
+ */
+void TOMBOY_AdvancePPU (TOMBOY_PPU* p_PPU, uint64_t p_Cycle, uint32_t p_Ticks, uint8_t p_ODMAPeriod);
+
+/**
+ * @brief Gets the number of ticks until the next point at which the given PPU instance could
+ *        request an interrupt or call its frame rendered callback, assuming its registers are not
+ *        written in the meantime.
+ * 
+ * The count returned may be early, but is never late.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return The number of ticks until the PPU's next event, or `UINT32_MAX` if it has none pending.
+ */
+uint32_t TOMBOY_GetTicksUntilPPUEvent (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Checks whether the given PPU instance has an OAM DMA transfer in progress, including one
+ *        which is still waiting out its initial delay.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return `true` if an OAM DMA transfer is in progress; `false` otherwise.
+ */
+bool TOMBOY_IsODMAActive (const TOMBOY_PPU* p_PPU);
+
 /**
  * @brief Gets the given PPU instance's screen buffer, which contains the pixels which have been
- *        rendered to the screen.
+ *        rendered to the screen, in the PPU's pixel format.
  * 
  * @param p_PPU  A pointer to the PPU structure.
  * 
  * @return A pointer to the PPU's screen buffer.
  */
-const uint32_t* TOMBOY_GetScreenBuffer (const TOMBOY_PPU* p_PPU);
+const void* TOMBOY_GetScreenBuffer (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Gets the number of bytes each scanline takes up in the given PPU instance's screen
+ *        buffer, in its pixel format.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return The screen buffer's pitch, in bytes.
+ */
+size_t TOMBOY_GetScreenPitch (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Gets the RGBA8888 colors which the pixels of the indexed pixel format stand for. The
+ *        background and object CRAM's colors are given as they stand when this is called, so a
+ *        frame whose palettes were changed part-way through it is best followed by a call to this
+ *        from within the frame rendered callback.
+ * 
+ * @param p_PPU     A pointer to the PPU structure.
+ * @param p_Colors  The array of `TOMBOY_PPU_INDEXED_COLOR_COUNT` colors to fill.
+ */
+void TOMBOY_GetIndexedPalette (const TOMBOY_PPU* p_PPU, uint32_t* p_Colors);
+
+/**
+ * @brief Acquires the latest frame the PPU has handed off. This may be called from a thread other
+ *        than the one running the emulation, but only one thread may acquire frames at a time.
+ * 
+ * @param p_PPU     A pointer to the PPU structure.
+ * @param p_IsNew   If not `NULL`, set to `true` if a newer frame was picked up by this call, or to
+ *                  `false` if the one acquired last is still the latest.
+ * 
+ * @return A pointer to the frame's pixels, which stay untouched until the next call to this
+ *         function. If the PPU does not hand frames off, this is the screen buffer it draws into.
+ */
+const void* TOMBOY_AcquireFrame (TOMBOY_PPU* p_PPU, bool* p_IsNew);
+
+/**
+ * @brief Gets a bitmap of the scanlines whose pixels in the screen buffer have changed since the
+ *        frame rendered callback was last called, with scanline `N` in bit `N % 64` of word
+ *        `N / 64`. From within the callback, these are the scanlines which differ from the previous
+ *        frame, so a frontend need only upload or send those.
+ * 
+ * @param p_PPU  A pointer to the PPU structure.
+ * 
+ * @return A pointer to the bitmap's `TOMBOY_PPU_DIRTY_LINE_WORDS` words.
+ */
+const uint64_t* TOMBOY_GetDirtyScanlines (const TOMBOY_PPU* p_PPU);
+
+/**
+ * @brief Checks whether a scanline's pixels in the screen buffer have changed since the frame
+ *        rendered callback was last called.
+ * 
+ * @param p_PPU     A pointer to the PPU structure.
+ * @param p_Line    The scanline to check.
+ * 
+ * @return `true` if the scanline has changed; `false` otherwise, or if it is off the screen.
+ */
+bool TOMBOY_IsScanlineDirty (const TOMBOY_PPU* p_PPU, uint8_t p_Line);
 
 // Public Functions - Memory Access ////////////////////////////////////////////////////////////////
 
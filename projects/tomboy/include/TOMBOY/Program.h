@@ -42,6 +42,17 @@ void TOMBOY_DestroyProgram (TOMBOY_Program* p_Program);
  */
 uint8_t TOMBOY_ReadProgramByte (const TOMBOY_Program* p_Program, uint32_t p_Address);
 
+/**
+ * @brief      Gets a pointer to the TOMBOY program's data, so that it can be read without going
+ *             through `TOMBOY_ReadProgramByte`.
+ * 
+ * @param      p_Program  A pointer to the TOMBOY program instance.
+ * @param      p_Size     If not `NULL`, receives the size of the program's data, in bytes.
+ * 
+ * @return     A pointer to the program's data, or `NULL` if the program is `NULL`.
+ */
+const uint8_t* TOMBOY_GetProgramData (const TOMBOY_Program* p_Program, uint32_t* p_Size);
+
 /**
  * @brief      Gets the requested size of the program's static RAM (SRAM).
  * 
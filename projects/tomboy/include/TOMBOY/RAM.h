@@ -12,6 +12,21 @@
  */
 typedef struct TOMBOY_RAM TOMBOY_RAM;
 
+// RAM Region Enumeration //////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Enumerates the buffers held by the TOMBOY RAM context.
+ */
+typedef enum TOMBOY_RAMRegion
+{
+    TOMBOY_RR_WRAM = 0,     ///< @brief Working RAM (WRAM)
+    TOMBOY_RR_SRAM,         ///< @brief Static RAM (SRAM)
+    TOMBOY_RR_XRAM,         ///< @brief Executable RAM (XRAM)
+    TOMBOY_RR_QRAM,         ///< @brief Quick RAM (QRAM)
+    TOMBOY_RR_DSTACK,       ///< @brief Data Stack
+    TOMBOY_RR_CSTACK,       ///< @brief Call Stack
+} TOMBOY_RAMRegion;
+
 // Public Function Prototypes //////////////////////////////////////////////////////////////////////
 
 /**
@@ -178,3 +193,19 @@ uint8_t TOMBOY_ReadCallStackByte (const TOMBOY_RAM* p_RAM, uint32_t p_Address);
  * @param   p_Value    The byte value to write.
  */
 void TOMBOY_WriteCallStackByte (TOMBOY_RAM* p_RAM, uint32_t p_Address, uint8_t p_Value);
+
+// Public Function Prototypes - Direct Access //////////////////////////////////////////////////////
+
+/**
+ * @brief   Gets a pointer to one of the TOMBOY RAM context's buffers, so that it can be accessed
+ *          without going through the byte accessors above.
+ * 
+ * The buffer stays at the same location for the lifetime of the RAM context.
+ * 
+ * @param   p_RAM      A pointer to the TOMBOY RAM context.
+ * @param   p_Region   The buffer to get.
+ * @param   p_Size     If not `NULL`, receives the size of the buffer, in bytes.
+ * 
+ * @return  A pointer to the buffer, or `NULL` if it was not allocated.
+ */
+uint8_t* TOMBOY_GetRAMBuffer (TOMBOY_RAM* p_RAM, TOMBOY_RAMRegion p_Region, uint32_t* p_Size);
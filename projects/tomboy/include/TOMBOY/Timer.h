@@ -84,6 +84,17 @@ void TOMBOY_DestroyTimer (TOMBOY_Timer* p_Timer);
  */
 bool TOMBOY_TickTimer (TOMBOY_Timer* p_Timer);
 
+/**
+ * @brief Advances the given TOMBOY timer instance by the given number of ticks at once, leaving it
+ *        in the same state as that many calls to @a `TOMBOY_TickTimer` would.
+ * 
+ * @param p_Timer      A pointer to the TOMBOY timer instance to advance.
+ * @param p_Ticks      The number of ticks to advance the timer by.
+ * 
+ * @return `true` if the timer was advanced successfully; `false` otherwise.
+ */
+bool TOMBOY_AdvanceTimer (TOMBOY_Timer* p_Timer, uint32_t p_Ticks);
+
 /**
  * @brief Tests the given bit of the given engine's timer's 16-bit divider register, to see if it
  *        has changed from high to low (from 1 to 0).
@@ -95,6 +106,28 @@ bool TOMBOY_TickTimer (TOMBOY_Timer* p_Timer);
  */
 bool TOMBOY_TestTimerDividerBit (const TOMBOY_Timer* p_Timer, uint8_t p_Bit);
 
+/**
+ * @brief Gets the number of ticks until the given bit of the given timer's 16-bit divider register
+ *        next changes from high to low (from 1 to 0).
+ * 
+ * @param p_Timer      A pointer to the TOMBOY timer instance to check.
+ * @param p_Bit        The bit of the divider register to check.
+ * 
+ * @return The number of ticks until the bit next falls; at least 1.
+ */
+uint32_t TOMBOY_GetTicksUntilDividerFall (const TOMBOY_Timer* p_Timer, uint8_t p_Bit);
+
+/**
+ * @brief Gets the number of ticks until the given timer's counter register, `TIMA`, next overflows
+ *        and requests the timer interrupt, assuming its registers are not written in the meantime.
+ * 
+ * @param p_Timer      A pointer to the TOMBOY timer instance to check.
+ * 
+ * @return The number of ticks until the timer interrupt is requested, or `UINT32_MAX` if the timer
+ *         is disabled.
+ */
+uint32_t TOMBOY_GetTicksUntilTimerInterrupt (const TOMBOY_Timer* p_Timer);
+
 // Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
 
 /**
@@ -137,6 +137,8 @@ static void TOMBOY_TickLengthTimers (TOMBOY_APU* p_APU);
 static void TOMBOY_TickFrequencySweep (TOMBOY_APU* p_APU);
 static void TOMBOY_TickEnvelopeSweeps (TOMBOY_APU* p_APU);
 static void TOMBOY_UpdateAudioSample (TOMBOY_Engine* p_Engine, TOMBOY_APU* p_APU);
+static void TOMBOY_TickAPUAt (TOMBOY_APU* p_APU, uint64_t p_Cycle, bool p_DIV);
+static uint32_t TOMBOY_GetPeriodDividerSteps (uint16_t p_PeriodDivider);
 
 // Static Functions ////////////////////////////////////////////////////////////////////////////////
 
@@ -685,6 +687,52 @@ void TOMBOY_UpdateAudioSample (TOMBOY_Engine* p_Engine, TOMBOY_APU* p_APU)
 
 }
 
+void TOMBOY_TickAPUAt (TOMBOY_APU* p_APU, uint64_t p_Cycle, bool p_DIV)
+{
+
+    // Tick the channels:
+    // - Wave channel every two ticks.
+    // - Pulse channels every four ticks.
+    // - Noise channel at a rate of ticks dictated by the channel's clock frequency.
+    if (p_Cycle % 2 == 0) 
+        { TOMBOY_TickWaveChannel(p_APU); }
+    if (p_Cycle % 4 == 0) 
+        { TOMBOY_TickPulseChannels(p_APU); }
+    if (p_Cycle % p_APU->m_NoiseChannel.m_CurrentClockFrequency == 0) 
+        { TOMBOY_TickNoiseChannel(p_APU); }
+
+    // If the APU's internal divider needs to be ticked, then do so here.
+    if (p_DIV == true)
+    {
+        // Increment the APU's internal divider.
+        p_APU->m_Divider++;
+
+        // Tick...
+        // - ...the length timers every 2 DIV-APU ticks.
+        // . ...`PC1`'s frequency sweep unit every 4 DIV-APU ticks.
+        // - ...the envelope sweeps every 8 DIV-APU ticks.
+        if (p_APU->m_Divider % 2 == 0) 
+            { TOMBOY_TickLengthTimers(p_APU); }
+        if (p_APU->m_Divider % 4 == 0) 
+            { TOMBOY_TickFrequencySweep(p_APU); }
+        if (p_APU->m_Divider % 8 == 0) 
+            { TOMBOY_TickEnvelopeSweeps(p_APU); }
+    }
+
+    // If the APU's mix clock frequency has been reached, then update the audio sample.
+    if (p_Cycle % p_APU->m_MixClockFrequency == 0)
+    {
+        TOMBOY_UpdateAudioSample(p_APU->m_ParentEngine, p_APU);
+    }
+
+}
+
+uint32_t TOMBOY_GetPeriodDividerSteps (uint16_t p_PeriodDivider)
+{
+    // A channel's period divider overflows on the step which takes it past 2048 (0x800).
+    return (p_PeriodDivider >= 0x800) ? 1 : (0x801 - p_PeriodDivider);
+}
+
 // Public Functions ////////////////////////////////////////////////////////////////////////////////
 
 TOMBOY_APU* TOMBOY_CreateAPU (TOMBOY_Engine* p_Engine)
@@ -810,47 +858,94 @@ bool TOMBOY_TickAPU (TOMBOY_APU* p_APU, bool p_DIV)
         return false;
     }
 
-    // Get the parent engine's cycle count.
-    uint64_t l_Cycles = TOMBOY_GetCycleCount(p_APU->m_ParentEngine);
+    // Tick the APU as of the parent engine's cycle count.
+    TOMBOY_TickAPUAt(p_APU, TOMBOY_GetCycleCount(p_APU->m_ParentEngine), p_DIV);
 
-    // Tick the channels:
-    // - Wave channel every two ticks.
-    // - Pulse channels every four ticks.
-    // - Noise channel at a rate of ticks dictated by the channel's clock frequency.
-    if (l_Cycles % 2 == 0) 
-        { TOMBOY_TickWaveChannel(p_APU); }
-    if (l_Cycles % 4 == 0) 
-        { TOMBOY_TickPulseChannels(p_APU); }
-    if (l_Cycles % p_APU->m_NoiseChannel.m_CurrentClockFrequency == 0) 
-        { TOMBOY_TickNoiseChannel(p_APU); }
+    return true;
+}
 
-    // If the APU's internal divider needs to be ticked, then do so here.
-    if (p_DIV == true)
+bool TOMBOY_AdvanceAPU (TOMBOY_APU* p_APU, uint64_t p_Cycle, uint32_t p_Ticks, bool p_DIV)
+{
+    if (p_APU == NULL)
     {
-        // Increment the APU's internal divider.
-        p_APU->m_Divider++;
-
-        // Tick...
-        // - ...the length timers every 2 DIV-APU ticks.
-        // . ...`PC1`'s frequency sweep unit every 4 DIV-APU ticks.
-        // - ...the envelope sweeps every 8 DIV-APU ticks.
-        if (p_APU->m_Divider % 2 == 0) 
-            { TOMBOY_TickLengthTimers(p_APU); }
-        if (p_APU->m_Divider % 4 == 0) 
-            { TOMBOY_TickFrequencySweep(p_APU); }
-        if (p_APU->m_Divider % 8 == 0) 
-            { TOMBOY_TickEnvelopeSweeps(p_APU); }
+        TM_error("APU context is NULL!");
+        return false;
     }
 
-    // If the APU's mix clock frequency has been reached, then update the audio sample.
-    if (l_Cycles % p_APU->m_MixClockFrequency == 0)
+    TOMBOY_WaveChannel* l_Wave = &p_APU->m_WaveChannel;
+    TOMBOY_PulseChannel* l_Pulse1 = &p_APU->m_PulseChannel1;
+    TOMBOY_PulseChannel* l_Pulse2 = &p_APU->m_PulseChannel2;
+    uint64_t l_End = p_Cycle + p_Ticks;
+
+    while (p_Cycle < l_End)
     {
-        TOMBOY_UpdateAudioSample(p_APU->m_ParentEngine, p_APU);
+        // Find the next cycle on which the APU does more than step its channels' period dividers:
+        // a mix, a tick of the noise channel, an overflow of a period divider, or the DIV-APU tick.
+        uint64_t l_Next = (p_DIV == true) ? l_End : UINT64_MAX;
+        uint64_t l_Event = (p_Cycle / p_APU->m_MixClockFrequency + 1) * p_APU->m_MixClockFrequency;
+        if (l_Event < l_Next) { l_Next = l_Event; }
+
+        if (p_APU->m_MasterControl.m_NCEnable)
+        {
+            uint64_t l_Frequency = p_APU->m_NoiseChannel.m_CurrentClockFrequency;
+            l_Event = (p_Cycle / l_Frequency + 1) * l_Frequency;
+            if (l_Event < l_Next) { l_Next = l_Event; }
+        }
+
+        if (p_APU->m_MasterControl.m_WCEnable)
+        {
+            l_Event = (p_Cycle / 2 + TOMBOY_GetPeriodDividerSteps(l_Wave->m_PeriodDivider)) * 2;
+            if (l_Event < l_Next) { l_Next = l_Event; }
+        }
+
+        if (p_APU->m_MasterControl.m_PC1Enable)
+        {
+            l_Event = (p_Cycle / 4 + TOMBOY_GetPeriodDividerSteps(l_Pulse1->m_PeriodDivider)) * 4;
+            if (l_Event < l_Next) { l_Next = l_Event; }
+        }
+
+        if (p_APU->m_MasterControl.m_PC2Enable)
+        {
+            l_Event = (p_Cycle / 4 + TOMBOY_GetPeriodDividerSteps(l_Pulse2->m_PeriodDivider)) * 4;
+            if (l_Event < l_Next) { l_Next = l_Event; }
+        }
+
+        // Step the enabled channels' period dividers over the cycles before that one, none of
+        // which overflow them.
+        uint64_t l_Last = (l_Next - 1 < l_End) ? (l_Next - 1) : l_End;
+        if (p_APU->m_MasterControl.m_WCEnable)
+            { l_Wave->m_PeriodDivider += (l_Last / 2) - (p_Cycle / 2); }
+        if (p_APU->m_MasterControl.m_PC1Enable)
+            { l_Pulse1->m_PeriodDivider += (l_Last / 4) - (p_Cycle / 4); }
+        if (p_APU->m_MasterControl.m_PC2Enable)
+            { l_Pulse2->m_PeriodDivider += (l_Last / 4) - (p_Cycle / 4); }
+
+        // If that cycle lies past the end of the advance, then the APU is done. Otherwise, tick it
+        // as usual.
+        if (l_Next > l_End)
+        {
+            break;
+        }
+
+        TOMBOY_TickAPUAt(p_APU, l_Next, p_DIV == true && l_Next == l_End);
+        p_Cycle = l_Next;
     }
 
     return true;
 }
 
+uint32_t TOMBOY_GetTicksUntilAudioMix (const TOMBOY_APU* p_APU, uint64_t p_Cycle)
+{
+    if (p_APU == NULL)
+    {
+        TM_error("APU context is NULL!");
+        return 1;
+    }
+
+    // A sample is mixed on each cycle which is a multiple of the mix clock frequency.
+    return p_APU->m_MixClockFrequency - (p_Cycle % p_APU->m_MixClockFrequency);
+}
+
 // Public Functions - Memory Access ////////////////////////////////////////////////////////////////
 
 uint8_t TOMBOY_ReadWaveByte (const TOMBOY_APU* p_APU, uint32_t p_Address)
@@ -12,6 +12,45 @@
 #include <TOMBOY/RAM.h>
 #include <TOMBOY/Engine.h>
 
+// Constants ///////////////////////////////////////////////////////////////////////////////////////
+
+#define TOMBOY_BUS_PAGE_SHIFT   16                              ///< @brief The number of address bits within a bus page.
+#define TOMBOY_BUS_PAGE_SIZE    (1 << TOMBOY_BUS_PAGE_SHIFT)    ///< @brief The size of a bus page, in bytes.
+#define TOMBOY_BUS_PAGE_MASK    (TOMBOY_BUS_PAGE_SIZE - 1)      ///< @brief Masks an address down to its offset within its bus page.
+#define TOMBOY_BUS_PAGE_COUNT   (1 << (32 - TOMBOY_BUS_PAGE_SHIFT)) ///< @brief The number of pages in the 32-bit address space.
+
+// Bus Page Structure //////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Describes how one page of the bus maps onto plain memory. Offsets into the page below
+ *          the relevant limit are read from, or written to, the host buffer directly; any other
+ *          access is handled by `TOMBOY_BusReadHandler` or `TOMBOY_BusWriteHandler`.
+ */
+typedef struct TOMBOY_BusPage
+{
+    const uint8_t*  m_Read;         ///< @brief Points to the start of the page in the buffer backing its reads.
+    uint8_t*        m_Write;        ///< @brief Points to the start of the page in the buffer backing its writes.
+    uint32_t        m_ReadLimit;    ///< @brief The number of bytes at the start of the page which can be read directly.
+    uint32_t        m_WriteLimit;   ///< @brief The number of bytes at the start of the page which can be written directly.
+} TOMBOY_BusPage;
+
+// Engine Event Enumeration ////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Enumerates the events the engine schedules for its components. Between events, the timer,
+ *          APU and PPU are left alone, and are brought up to date in bulk only when an event falls
+ *          due or the CPU accesses their memory or one of the hardware ports.
+ */
+typedef enum TOMBOY_EngineEvent
+{
+    TOMBOY_EE_TIMER = 0,    ///< @brief The timer's `TIMA` register overflows, requesting the timer interrupt.
+    TOMBOY_EE_APU,          ///< @brief The APU mixes its next audio sample.
+    TOMBOY_EE_PPU,          ///< @brief The PPU could next request an interrupt or finish a frame.
+    TOMBOY_EE_ODMA,         ///< @brief The PPU's OAM DMA transfer copies its next byte from the bus.
+    TOMBOY_EE_NETWORK,      ///< @brief The network interface advances a transfer in progress.
+    TOMBOY_EE_COUNT         ///< @brief The number of engine events.
+} TOMBOY_EngineEvent;
+
 // TOMBOY Emulator Engine Structure ////////////////////////////////////////////////////////////////
 
 typedef struct TOMBOY_Engine
@@ -27,6 +66,12 @@ typedef struct TOMBOY_Engine
     TOMBOY_RAM*             m_RAM;              ///< @brief The TOMBOY RAM instance.
     uint64_t                m_Cycles;           ///< @brief The number of cycles elapsed on the engine.
     bool                    m_DoubleSpeed;      ///< @brief Whether the engine is in double-speed mode.
+    uint64_t                m_SyncedCycles;     ///< @brief The cycle count the timer and APU have been brought up to.
+    uint64_t                m_PPUCycles;        ///< @brief The cycle count the PPU has been brought up to.
+    uint64_t                m_Deadlines[TOMBOY_EE_COUNT]; ///< @brief The cycle count on which each event is next due, or `UINT64_MAX` if never.
+    uint64_t                m_NextDeadline;     ///< @brief The soonest of the event deadlines.
+    bool                    m_EventScheduling;  ///< @brief Whether components are brought up to date by scheduled events, rather than on every tick.
+    TOMBOY_BusPage          m_Pages[TOMBOY_BUS_PAGE_COUNT]; ///< @brief The bus page table, indexed by the upper bits of an address.
 } TOMBOY_Engine;
 
 /*
@@ -41,367 +86,695 @@ static TOMBOY_Engine* s_CurrentEngine = NULL;
 
 // Private Function Prototypes /////////////////////////////////////////////////////////////////////
 
-static uint8_t TOMBOY_BusRead (uint32_t p_Address);
-static void TOMBOY_BusWrite (uint32_t p_Address, uint8_t p_Data);
-static bool TOMBOY_Cycle (uint32_t p_Cycles);
+static void TOMBOY_MapBusPages (TOMBOY_Engine* p_Engine, uint32_t p_Start, uint32_t p_End,
+    const uint8_t* p_ReadBuffer, uint8_t* p_WriteBuffer, uint32_t p_Size);
+static void TOMBOY_MapBus (TOMBOY_Engine* p_Engine);
+static uint8_t TOMBOY_BusReadHandler (TOMBOY_Engine* p_Engine, uint32_t p_Address);
+static void TOMBOY_BusWriteHandler (TOMBOY_Engine* p_Engine, uint32_t p_Address, uint8_t p_Data);
+static uint8_t TOMBOY_BusRead (void* p_Context, uint32_t p_Address);
+static void TOMBOY_BusWrite (void* p_Context, uint32_t p_Address, uint8_t p_Data);
+static uint8_t* TOMBOY_BusPointer (void* p_Context, uint32_t p_Address, uint32_t p_Size,
+    bool p_Write);
+static void TOMBOY_SyncTimerAndAPU (TOMBOY_Engine* p_Engine);
+static void TOMBOY_SyncPPU (TOMBOY_Engine* p_Engine);
+static void TOMBOY_SyncEngine (TOMBOY_Engine* p_Engine);
+static void TOMBOY_ScheduleEvents (TOMBOY_Engine* p_Engine);
+static void TOMBOY_RunEvents (TOMBOY_Engine* p_Engine);
+static bool TOMBOY_Cycle (void* p_Context, uint32_t p_Cycles);
+static uint32_t TOMBOY_NextEvent (void* p_Context);
 
 // Private Functions ///////////////////////////////////////////////////////////////////////////////
 
-uint8_t TOMBOY_BusRead (uint32_t p_Address)
+void TOMBOY_MapBusPages (TOMBOY_Engine* p_Engine, uint32_t p_Start, uint32_t p_End,
+    const uint8_t* p_ReadBuffer, uint8_t* p_WriteBuffer, uint32_t p_Size)
 {
-    assert(s_CurrentEngine != NULL);
+    assert(p_Engine != NULL);
+
+    // Map each page of the range onto the buffer, as far as the buffer reaches. Whatever lies past
+    // the end of the buffer or the range is left to the bus handlers, which return `0xFF` for, and
+    // ignore writes to, the unbacked part of a memory space.
+    for (uint64_t l_Address = p_Start; l_Address <= p_End; l_Address += TOMBOY_BUS_PAGE_SIZE)
+    {
+        uint64_t l_Offset = l_Address - p_Start;
+        if (l_Offset >= p_Size)
+        {
+            break;
+        }
+
+        uint64_t l_Limit = TOMBOY_BUS_PAGE_SIZE;
+        if (l_Limit > p_Size - l_Offset)    { l_Limit = p_Size - l_Offset; }
+        if (l_Limit > p_End - l_Address + 1) { l_Limit = p_End - l_Address + 1; }
+
+        TOMBOY_BusPage* l_Page = &p_Engine->m_Pages[l_Address >> TOMBOY_BUS_PAGE_SHIFT];
+        if (p_ReadBuffer != NULL)
+        {
+            l_Page->m_Read = p_ReadBuffer + l_Offset;
+            l_Page->m_ReadLimit = (uint32_t) l_Limit;
+        }
+        if (p_WriteBuffer != NULL)
+        {
+            l_Page->m_Write = p_WriteBuffer + l_Offset;
+            l_Page->m_WriteLimit = (uint32_t) l_Limit;
+        }
+    }
+}
+
+void TOMBOY_MapBus (TOMBOY_Engine* p_Engine)
+{
+    assert(p_Engine != NULL);
+
+    uint32_t l_Size = 0;
+    uint8_t* l_Buffer = NULL;
+
+    // `0x00000000` - `0x7FFFFFFF`: ROM Space. Read-only; writes fall through to the handler, which
+    // ignores them.
+    const uint8_t* l_ProgramData = TOMBOY_GetProgramData(p_Engine->m_Program, &l_Size);
+    TOMBOY_MapBusPages(p_Engine, TM_ROM_BEGIN, TM_ROM_END, l_ProgramData, NULL, l_Size);
+
+    // `0x80000000` - `0xBFFFFFFF`: Working RAM Space
+    l_Buffer = TOMBOY_GetRAMBuffer(p_Engine->m_RAM, TOMBOY_RR_WRAM, &l_Size);
+    TOMBOY_MapBusPages(p_Engine, TOMBOY_WRAM_START, TOMBOY_WRAM_END, l_Buffer, l_Buffer, l_Size);
+
+    // `0xC0000000` - `0xDFFCFFFF`: Static RAM Space
+    l_Buffer = TOMBOY_GetRAMBuffer(p_Engine->m_RAM, TOMBOY_RR_SRAM, &l_Size);
+    TOMBOY_MapBusPages(p_Engine, TOMBOY_SRAM_START, TOMBOY_SRAM_END, l_Buffer, l_Buffer, l_Size);
+
+    // `0xE0000000` - `0xFFFCFFFF`: Executable RAM Space
+    l_Buffer = TOMBOY_GetRAMBuffer(p_Engine->m_RAM, TOMBOY_RR_XRAM, &l_Size);
+    TOMBOY_MapBusPages(p_Engine, TM_XRAM_BEGIN, TM_XRAM_END, l_Buffer, l_Buffer, l_Size);
+
+    // `0xFFFD0000` - `0xFFFEFFFF`: Data Stack and Call Stack Spaces. Both are backed by the data
+    // stack buffer, as they are in the bus handlers.
+    l_Buffer = TOMBOY_GetRAMBuffer(p_Engine->m_RAM, TOMBOY_RR_DSTACK, &l_Size);
+    TOMBOY_MapBusPages(p_Engine, TM_DSTACK_BEGIN, TM_DSTACK_END, l_Buffer, l_Buffer, l_Size);
+    TOMBOY_MapBusPages(p_Engine, TM_CSTACK_BEGIN, TM_CSTACK_END, l_Buffer, l_Buffer, l_Size);
+
+    // `0xFFFF0000` - `0xFFFFFEFF`: Quick RAM Space. The rest of its page holds the I/O ports.
+    l_Buffer = TOMBOY_GetRAMBuffer(p_Engine->m_RAM, TOMBOY_RR_QRAM, &l_Size);
+    TOMBOY_MapBusPages(p_Engine, TM_QRAM_BEGIN, TM_QRAM_END, l_Buffer, l_Buffer, l_Size);
+
+    // The remaining spaces - the screen buffer, network RAM, video RAM, color RAM, OAM, wave RAM
+    // and the I/O ports - belong to components which check their own access rules, and so are
+    // left to the bus handlers.
+}
+
+uint8_t TOMBOY_BusReadHandler (TOMBOY_Engine* p_Engine, uint32_t p_Address)
+{
+    assert(p_Engine != NULL);
 
     // `0x80000000` - `0xBFFFFFFF`: Working RAM Space
     if (p_Address >= TOMBOY_WRAM_START && p_Address <= TOMBOY_WRAM_END)
     {
-        return TOMBOY_ReadWRAMByte(s_CurrentEngine->m_RAM, p_Address - TOMBOY_WRAM_START);
+        return TOMBOY_ReadWRAMByte(p_Engine->m_RAM, p_Address - TOMBOY_WRAM_START);
     }
 
     // `0xC0000000` - `0xDFFCFFFF`: Static RAM Space
     if (p_Address >= TOMBOY_SRAM_START && p_Address <= TOMBOY_SRAM_END)
     {
-        return TOMBOY_ReadSRAMByte(s_CurrentEngine->m_RAM, p_Address - TOMBOY_SRAM_START);
+        return TOMBOY_ReadSRAMByte(p_Engine->m_RAM, p_Address - TOMBOY_SRAM_START);
     }
 
     // `0xE0000000` - `0xFFFCFFFF`: Executable RAM Space
     if (p_Address >= TM_XRAM_BEGIN && p_Address <= TM_XRAM_END)
     {
-        return TOMBOY_ReadXRAMByte(s_CurrentEngine->m_RAM, p_Address - TM_XRAM_BEGIN);
+        return TOMBOY_ReadXRAMByte(p_Engine->m_RAM, p_Address - TM_XRAM_BEGIN);
     }
 
     // `0xDFFD0000` - `0xDFFE7FFF`: Screen Buffer Space
     if (p_Address >= TOMBOY_SCREEN_START && p_Address <= TOMBOY_SCREEN_END)
     {
-        return TOMBOY_ReadScreenByte(s_CurrentEngine->m_PPU, p_Address - TOMBOY_SCREEN_START);
+        TOMBOY_SyncPPU(p_Engine);
+        return TOMBOY_ReadScreenByte(p_Engine->m_PPU, p_Address - TOMBOY_SCREEN_START);
     }
 
     // `0xDFFF0000` - `0xDFFF00FF`: Network Send RAM Space
     if (p_Address >= TOMBOY_NSEND_START && p_Address <= TOMBOY_NSEND_END)
     {
-        return TOMBOY_ReadNetSendByte(s_CurrentEngine->m_Network, p_Address - TOMBOY_NSEND_START);
+        return TOMBOY_ReadNetSendByte(p_Engine->m_Network, p_Address - TOMBOY_NSEND_START);
     }
 
     // `0xDFFF0100` - `0xDFFF01FF`: Network Receive RAM Space
     if (p_Address >= TOMBOY_NRECV_START && p_Address <= TOMBOY_NRECV_END)
     {
-        return TOMBOY_ReadNetRecvByte(s_CurrentEngine->m_Network, p_Address - TOMBOY_NRECV_START);
+        return TOMBOY_ReadNetRecvByte(p_Engine->m_Network, p_Address - TOMBOY_NRECV_START);
     }
 
     // `0x00000000` - `0x7FFFFFFF`: ROM Space
     if (p_Address >= TM_ROM_BEGIN && p_Address <= TM_ROM_END)
     {
-        return TOMBOY_ReadProgramByte(s_CurrentEngine->m_Program, p_Address);
+        return TOMBOY_ReadProgramByte(p_Engine->m_Program, p_Address);
     }
 
     // `0xDFFF8000` - `0xDFFF9FFF`: Video RAM Space
     if (p_Address >= TOMBOY_VRAM_START && p_Address <= TOMBOY_VRAM_END)
     {
-        return TOMBOY_ReadVRAMByte(s_CurrentEngine->m_PPU, p_Address - TOMBOY_VRAM_START);
+        TOMBOY_SyncPPU(p_Engine);
+        return TOMBOY_ReadVRAMByte(p_Engine->m_PPU, p_Address - TOMBOY_VRAM_START);
     }
 
     // `0xDFFFA000` - `0xDFFFA07F`: Color RAM Space
     if (p_Address >= TOMBOY_CRAM_START && p_Address <= TOMBOY_CRAM_END)
     {
-        return TOMBOY_ReadCRAMByte(s_CurrentEngine->m_PPU, p_Address - TOMBOY_CRAM_START);
+        TOMBOY_SyncPPU(p_Engine);
+        return TOMBOY_ReadCRAMByte(p_Engine->m_PPU, p_Address - TOMBOY_CRAM_START);
     }
 
     // `0xDFFFFE00` - `0xDFFFFE9F`: OAM Space
     if (p_Address >= TOMBOY_OAM_START && p_Address <= TOMBOY_OAM_END)
     {
-        return TOMBOY_ReadOAMByte(s_CurrentEngine->m_PPU, p_Address - TOMBOY_OAM_START);
+        TOMBOY_SyncPPU(p_Engine);
+        return TOMBOY_ReadOAMByte(p_Engine->m_PPU, p_Address - TOMBOY_OAM_START);
     }
 
     // `0xDFFFFF30` - `0xDFFFFF3F`: Wave RAM Space
     if (p_Address >= TOMBOY_WAVE_START && p_Address <= TOMBOY_WAVE_END)
     {
-        return TOMBOY_ReadWaveByte(s_CurrentEngine->m_APU, p_Address - TOMBOY_WAVE_START);
+        TOMBOY_SyncEngine(p_Engine);
+        return TOMBOY_ReadWaveByte(p_Engine->m_APU, p_Address - TOMBOY_WAVE_START);
     }
 
     // `0xFFFD0000` - `0xFFFDFFFF`: Data Stack Space
     if (p_Address >= TM_DSTACK_BEGIN && p_Address <= TM_DSTACK_END)
     {
-        return TOMBOY_ReadDataStackByte(s_CurrentEngine->m_RAM, p_Address - TM_DSTACK_BEGIN);
+        return TOMBOY_ReadDataStackByte(p_Engine->m_RAM, p_Address - TM_DSTACK_BEGIN);
     }
 
     // `0xFFFE0000` - `0xFFFEFFFF`: Call Stack Space
     if (p_Address >= TM_CSTACK_BEGIN && p_Address <= TM_CSTACK_END)
     {
-        return TOMBOY_ReadDataStackByte(s_CurrentEngine->m_RAM, p_Address - TM_CSTACK_BEGIN);
+        return TOMBOY_ReadDataStackByte(p_Engine->m_RAM, p_Address - TM_CSTACK_BEGIN);
     }
 
     // `0xFFFE8000` - `0xFFFEFFFF`: Quick RAM Space
     if (p_Address >= TM_QRAM_BEGIN && p_Address <= TM_QRAM_END)
     {
-        return TOMBOY_ReadQRAMByte(s_CurrentEngine->m_RAM, p_Address - TM_QRAM_BEGIN);
+        return TOMBOY_ReadQRAMByte(p_Engine->m_RAM, p_Address - TM_QRAM_BEGIN);
     }
 
-    // `0xFFFFFF00` - `0xFFFFFFFF`: IO Space
+    // `0xFFFFFF00` - `0xFFFFFFFF`: IO Space. Bring the timer and APU up to date before reading their
+    // ports.
+    TOMBOY_SyncEngine(p_Engine);
     switch (p_Address)
     {
-        case TOMBOY_HP_JOYP:  return TOMBOY_ReadJOYP(s_CurrentEngine->m_Joypad);
-        case TOMBOY_HP_NTC:   return TOMBOY_ReadNTC(s_CurrentEngine->m_Network);
-        case TOMBOY_HP_DIV:   return TOMBOY_ReadDIV(s_CurrentEngine->m_Timer);
-        case TOMBOY_HP_TIMA:  return TOMBOY_ReadTIMA(s_CurrentEngine->m_Timer);
-        case TOMBOY_HP_TMA:   return TOMBOY_ReadTMA(s_CurrentEngine->m_Timer);
-        case TOMBOY_HP_TAC:   return TOMBOY_ReadTAC(s_CurrentEngine->m_Timer);
-        case TOMBOY_HP_RTCS:  return TOMBOY_ReadRTCS(s_CurrentEngine->m_Realtime);
-        case TOMBOY_HP_RTCM:  return TOMBOY_ReadRTCM(s_CurrentEngine->m_Realtime);
-        case TOMBOY_HP_RTCH:  return TOMBOY_ReadRTCH(s_CurrentEngine->m_Realtime);
-        case TOMBOY_HP_RTCDH: return TOMBOY_ReadRTCDH(s_CurrentEngine->m_Realtime);
-        case TOMBOY_HP_RTCDL: return TOMBOY_ReadRTCDL(s_CurrentEngine->m_Realtime);
+        case TOMBOY_HP_JOYP:  return TOMBOY_ReadJOYP(p_Engine->m_Joypad);
+        case TOMBOY_HP_NTC:   return TOMBOY_ReadNTC(p_Engine->m_Network);
+        case TOMBOY_HP_DIV:   return TOMBOY_ReadDIV(p_Engine->m_Timer);
+        case TOMBOY_HP_TIMA:  return TOMBOY_ReadTIMA(p_Engine->m_Timer);
+        case TOMBOY_HP_TMA:   return TOMBOY_ReadTMA(p_Engine->m_Timer);
+        case TOMBOY_HP_TAC:   return TOMBOY_ReadTAC(p_Engine->m_Timer);
+        case TOMBOY_HP_RTCS:  return TOMBOY_ReadRTCS(p_Engine->m_Realtime);
+        case TOMBOY_HP_RTCM:  return TOMBOY_ReadRTCM(p_Engine->m_Realtime);
+        case TOMBOY_HP_RTCH:  return TOMBOY_ReadRTCH(p_Engine->m_Realtime);
+        case TOMBOY_HP_RTCDH: return TOMBOY_ReadRTCDH(p_Engine->m_Realtime);
+        case TOMBOY_HP_RTCDL: return TOMBOY_ReadRTCDL(p_Engine->m_Realtime);
         case TOMBOY_HP_RTCL:  return 0xFF; // Write-only register
-        case TOMBOY_HP_RTCR:  return TOMBOY_ReadRTCR(s_CurrentEngine->m_Realtime);
-        case TOMBOY_HP_IF:    return TM_GetInterruptFlags(s_CurrentEngine->m_CPU);
-        case TOMBOY_HP_NR10:  return TOMBOY_ReadNR10(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR11:  return TOMBOY_ReadNR11(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR12:  return TOMBOY_ReadNR12(s_CurrentEngine->m_APU);
+        case TOMBOY_HP_RTCR:  return TOMBOY_ReadRTCR(p_Engine->m_Realtime);
+        case TOMBOY_HP_IF:    return TM_GetInterruptFlags(p_Engine->m_CPU);
+        case TOMBOY_HP_NR10:  return TOMBOY_ReadNR10(p_Engine->m_APU);
+        case TOMBOY_HP_NR11:  return TOMBOY_ReadNR11(p_Engine->m_APU);
+        case TOMBOY_HP_NR12:  return TOMBOY_ReadNR12(p_Engine->m_APU);
         case TOMBOY_HP_NR13:  return 0xFF; // Write-only register.
-        case TOMBOY_HP_NR14:  return TOMBOY_ReadNR14(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR21:  return TOMBOY_ReadNR21(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR22:  return TOMBOY_ReadNR22(s_CurrentEngine->m_APU);
+        case TOMBOY_HP_NR14:  return TOMBOY_ReadNR14(p_Engine->m_APU);
+        case TOMBOY_HP_NR21:  return TOMBOY_ReadNR21(p_Engine->m_APU);
+        case TOMBOY_HP_NR22:  return TOMBOY_ReadNR22(p_Engine->m_APU);
         case TOMBOY_HP_NR23:  return 0xFF; // Write-only register.
-        case TOMBOY_HP_NR24:  return TOMBOY_ReadNR24(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR30:  return TOMBOY_ReadNR30(s_CurrentEngine->m_APU);
+        case TOMBOY_HP_NR24:  return TOMBOY_ReadNR24(p_Engine->m_APU);
+        case TOMBOY_HP_NR30:  return TOMBOY_ReadNR30(p_Engine->m_APU);
         case TOMBOY_HP_NR31:  return 0xFF; // Write-only register.
-        case TOMBOY_HP_NR32:  return TOMBOY_ReadNR32(s_CurrentEngine->m_APU);
+        case TOMBOY_HP_NR32:  return TOMBOY_ReadNR32(p_Engine->m_APU);
         case TOMBOY_HP_NR33:  return 0xFF; // Write-only register.
-        case TOMBOY_HP_NR34:  return TOMBOY_ReadNR34(s_CurrentEngine->m_APU);
+        case TOMBOY_HP_NR34:  return TOMBOY_ReadNR34(p_Engine->m_APU);
         case TOMBOY_HP_NR41:  return 0xFF; // Write-only register.
-        case TOMBOY_HP_NR42:  return TOMBOY_ReadNR42(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR43:  return TOMBOY_ReadNR43(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR44:  return TOMBOY_ReadNR44(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR50:  return TOMBOY_ReadNR50(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR51:  return TOMBOY_ReadNR51(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_NR52:  return TOMBOY_ReadNR52(s_CurrentEngine->m_APU);
-        case TOMBOY_HP_LCDC:  return TOMBOY_ReadLCDC(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_STAT:  return TOMBOY_ReadSTAT(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_SCY:   return TOMBOY_ReadSCY(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_SCX:   return TOMBOY_ReadSCX(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_LY:    return TOMBOY_ReadLY(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_LYC:   return TOMBOY_ReadLYC(s_CurrentEngine->m_PPU);
+        case TOMBOY_HP_NR42:  return TOMBOY_ReadNR42(p_Engine->m_APU);
+        case TOMBOY_HP_NR43:  return TOMBOY_ReadNR43(p_Engine->m_APU);
+        case TOMBOY_HP_NR44:  return TOMBOY_ReadNR44(p_Engine->m_APU);
+        case TOMBOY_HP_NR50:  return TOMBOY_ReadNR50(p_Engine->m_APU);
+        case TOMBOY_HP_NR51:  return TOMBOY_ReadNR51(p_Engine->m_APU);
+        case TOMBOY_HP_NR52:  return TOMBOY_ReadNR52(p_Engine->m_APU);
+        case TOMBOY_HP_LCDC:  return TOMBOY_ReadLCDC(p_Engine->m_PPU);
+        case TOMBOY_HP_STAT:  return TOMBOY_ReadSTAT(p_Engine->m_PPU);
+        case TOMBOY_HP_SCY:   return TOMBOY_ReadSCY(p_Engine->m_PPU);
+        case TOMBOY_HP_SCX:   return TOMBOY_ReadSCX(p_Engine->m_PPU);
+        case TOMBOY_HP_LY:    return TOMBOY_ReadLY(p_Engine->m_PPU);
+        case TOMBOY_HP_LYC:   return TOMBOY_ReadLYC(p_Engine->m_PPU);
         case TOMBOY_HP_DMA1:  return 0xFF; // Write-only register
         case TOMBOY_HP_DMA2:  return 0xFF; // Write-only register
         case TOMBOY_HP_DMA3:  return 0xFF; // Write-only register
-        case TOMBOY_HP_DMA:   return TOMBOY_ReadDMA(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_BGP:   return TOMBOY_ReadBGP(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_OBP0:  return TOMBOY_ReadOBP0(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_OBP1:  return TOMBOY_ReadOBP1(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_WY:    return TOMBOY_ReadWY(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_WX:    return TOMBOY_ReadWX(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_KEY1:  return s_CurrentEngine->m_DoubleSpeed ? 0x01 : 0x00;
-        case TOMBOY_HP_VBK:   return TOMBOY_ReadVBK(s_CurrentEngine->m_PPU);
+        case TOMBOY_HP_DMA:   return TOMBOY_ReadDMA(p_Engine->m_PPU);
+        case TOMBOY_HP_BGP:   return TOMBOY_ReadBGP(p_Engine->m_PPU);
+        case TOMBOY_HP_OBP0:  return TOMBOY_ReadOBP0(p_Engine->m_PPU);
+        case TOMBOY_HP_OBP1:  return TOMBOY_ReadOBP1(p_Engine->m_PPU);
+        case TOMBOY_HP_WY:    return TOMBOY_ReadWY(p_Engine->m_PPU);
+        case TOMBOY_HP_WX:    return TOMBOY_ReadWX(p_Engine->m_PPU);
+        case TOMBOY_HP_KEY1:  return p_Engine->m_DoubleSpeed ? 0x01 : 0x00;
+        case TOMBOY_HP_VBK:   return TOMBOY_ReadVBK(p_Engine->m_PPU);
         case TOMBOY_HP_HDMA1: return 0xFF; // Write-only register
         case TOMBOY_HP_HDMA2: return 0xFF; // Write-only register
         case TOMBOY_HP_HDMA3: return 0xFF; // Write-only register
         case TOMBOY_HP_HDMA4: return 0xFF; // Write-only register
         case TOMBOY_HP_HDMA5: return 0xFF; // Write-only register
         case TOMBOY_HP_HDMA6: return 0xFF; // Write-only register
-        case TOMBOY_HP_HDMA7: return TOMBOY_ReadHDMA7(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_BGPI:  return TOMBOY_ReadBGPI(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_BGPD:  return TOMBOY_ReadBGPD(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_OBPI:  return TOMBOY_ReadOBPI(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_OBPD:  return TOMBOY_ReadOBPD(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_OPRI:  return TOMBOY_ReadOPRI(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_GRPM:  return TOMBOY_ReadGRPM(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_VBP:   return TOMBOY_ReadVBP(s_CurrentEngine->m_PPU);
-        case TOMBOY_HP_IE:    return TM_GetInterruptEnable(s_CurrentEngine->m_CPU);
+        case TOMBOY_HP_HDMA7: return TOMBOY_ReadHDMA7(p_Engine->m_PPU);
+        case TOMBOY_HP_BGPI:  return TOMBOY_ReadBGPI(p_Engine->m_PPU);
+        case TOMBOY_HP_BGPD:  return TOMBOY_ReadBGPD(p_Engine->m_PPU);
+        case TOMBOY_HP_OBPI:  return TOMBOY_ReadOBPI(p_Engine->m_PPU);
+        case TOMBOY_HP_OBPD:  return TOMBOY_ReadOBPD(p_Engine->m_PPU);
+        case TOMBOY_HP_OPRI:  return TOMBOY_ReadOPRI(p_Engine->m_PPU);
+        case TOMBOY_HP_GRPM:  return TOMBOY_ReadGRPM(p_Engine->m_PPU);
+        case TOMBOY_HP_VBP:   return TOMBOY_ReadVBP(p_Engine->m_PPU);
+        case TOMBOY_HP_IE:    return TM_GetInterruptEnable(p_Engine->m_CPU);
         default:              return 0xFF; // Invalid address
     }
 }
 
-void TOMBOY_BusWrite (uint32_t p_Address, uint8_t p_Data)
+void TOMBOY_BusWriteHandler (TOMBOY_Engine* p_Engine, uint32_t p_Address, uint8_t p_Data)
 {
-    assert(s_CurrentEngine != NULL);
+    assert(p_Engine != NULL);
 
     // `0x80000000` - `0xBFFFFFFF`: Working RAM Space
     if (p_Address >= TOMBOY_WRAM_START && p_Address <= TOMBOY_WRAM_END)
     {
-        TOMBOY_WriteWRAMByte(s_CurrentEngine->m_RAM, p_Address - TOMBOY_WRAM_START, p_Data);
+        TOMBOY_WriteWRAMByte(p_Engine->m_RAM, p_Address - TOMBOY_WRAM_START, p_Data);
         return;
     }
 
     // `0xC0000000` - `0xDFFCFFFF`: Static RAM Space
     if (p_Address >= TOMBOY_SRAM_START && p_Address <= TOMBOY_SRAM_END)
     {
-        TOMBOY_WriteSRAMByte(s_CurrentEngine->m_RAM, p_Address - TOMBOY_SRAM_START, p_Data);
+        TOMBOY_WriteSRAMByte(p_Engine->m_RAM, p_Address - TOMBOY_SRAM_START, p_Data);
         return;
     }
 
     // `0xE0000000` - `0xFFFCFFFF`: Executable RAM Space
     if (p_Address >= TM_XRAM_BEGIN && p_Address <= TM_XRAM_END)
     {
-        TOMBOY_WriteXRAMByte(s_CurrentEngine->m_RAM, p_Address - TM_XRAM_BEGIN, p_Data);
+        TOMBOY_WriteXRAMByte(p_Engine->m_RAM, p_Address - TM_XRAM_BEGIN, p_Data);
         return;
     }
 
     // `0xDFFD0000` - `0xDFFE7FFF`: Screen Buffer Space
     if (p_Address >= TOMBOY_SCREEN_START && p_Address <= TOMBOY_SCREEN_END)
     {
-        TOMBOY_WriteScreenByte(s_CurrentEngine->m_PPU, p_Address - TOMBOY_SCREEN_START, p_Data);
+        TOMBOY_SyncPPU(p_Engine);
+        TOMBOY_WriteScreenByte(p_Engine->m_PPU, p_Address - TOMBOY_SCREEN_START, p_Data);
         return;
     }
 
     // `0xDFFF0000` - `0xDFFF00FF`: Network Send RAM Space
     if (p_Address >= TOMBOY_NSEND_START && p_Address <= TOMBOY_NSEND_END)
     {
-        TOMBOY_WriteNetSendByte(s_CurrentEngine->m_Network, p_Address - TOMBOY_NSEND_START, p_Data);
+        TOMBOY_WriteNetSendByte(p_Engine->m_Network, p_Address - TOMBOY_NSEND_START, p_Data);
         return;
     }
 
     // `0xDFFF8000` - `0xDFFF9FFF`: Video RAM Space
     if (p_Address >= TOMBOY_VRAM_START && p_Address <= TOMBOY_VRAM_END)
     {
-        TOMBOY_WriteVRAMByte(s_CurrentEngine->m_PPU, p_Address - TOMBOY_VRAM_START, p_Data);
+        TOMBOY_SyncPPU(p_Engine);
+        TOMBOY_WriteVRAMByte(p_Engine->m_PPU, p_Address - TOMBOY_VRAM_START, p_Data);
         return;
     }
 
     // `0xDFFFA000` - `0xDFFFA07F`: Color RAM Space
     if (p_Address >= TOMBOY_CRAM_START && p_Address <= TOMBOY_CRAM_END)
     {
-        TOMBOY_WriteCRAMByte(s_CurrentEngine->m_PPU, p_Address - TOMBOY_CRAM_START, p_Data);
+        TOMBOY_SyncPPU(p_Engine);
+        TOMBOY_WriteCRAMByte(p_Engine->m_PPU, p_Address - TOMBOY_CRAM_START, p_Data);
         return;
     }
 
     // `0xDFFFFE00` - `0xDFFFFE9F`: OAM Space
     if (p_Address >= TOMBOY_OAM_START && p_Address <= TOMBOY_OAM_END)
     {
-        TOMBOY_WriteOAMByte(s_CurrentEngine->m_PPU, p_Address - TOMBOY_OAM_START, p_Data);
+        TOMBOY_SyncPPU(p_Engine);
+        TOMBOY_WriteOAMByte(p_Engine->m_PPU, p_Address - TOMBOY_OAM_START, p_Data);
         return;
     }
 
     // `0xDFFFFF30` - `0xDFFFFF3F`: Wave RAM Space
     if (p_Address >= TOMBOY_WAVE_START && p_Address <= TOMBOY_WAVE_END)
     {
-        TOMBOY_WriteWaveByte(s_CurrentEngine->m_APU, p_Address - TOMBOY_WAVE_START, p_Data);
+        TOMBOY_SyncEngine(p_Engine);
+        TOMBOY_WriteWaveByte(p_Engine->m_APU, p_Address - TOMBOY_WAVE_START, p_Data);
         return;
     }
 
     // `0xFFFD0000` - `0xFFFDFFFF`: Data Stack Space
     if (p_Address >= TM_DSTACK_BEGIN && p_Address <= TM_DSTACK_END)
     {
-        TOMBOY_WriteDataStackByte(s_CurrentEngine->m_RAM, p_Address - TM_DSTACK_BEGIN, p_Data);
+        TOMBOY_WriteDataStackByte(p_Engine->m_RAM, p_Address - TM_DSTACK_BEGIN, p_Data);
         return;
     }
 
     // `0xFFFE0000` - `0xFFFEFFFF`: Call Stack Space
     if (p_Address >= TM_CSTACK_BEGIN && p_Address <= TM_CSTACK_END)
     {
-        TOMBOY_WriteDataStackByte(s_CurrentEngine->m_RAM, p_Address - TM_CSTACK_BEGIN, p_Data);
+        TOMBOY_WriteDataStackByte(p_Engine->m_RAM, p_Address - TM_CSTACK_BEGIN, p_Data);
         return;
     }
 
     // `0xFFFE8000` - `0xFFFEFFFF`: Quick RAM Space
     if (p_Address >= TM_QRAM_BEGIN && p_Address <= TM_QRAM_END)
     {
-        TOMBOY_WriteQRAMByte(s_CurrentEngine->m_RAM, p_Address - TM_QRAM_BEGIN, p_Data);
+        TOMBOY_WriteQRAMByte(p_Engine->m_RAM, p_Address - TM_QRAM_BEGIN, p_Data);
         return;
     }
 
-    // `0xFFFFFF00` - `0xFFFFFFFF`: IO Space
+    // `0xFFFFFF00` - `0xFFFFFFFF`: IO Space. Bring the timer and APU up to date before writing their
+    // ports, as the write may change when the engine's events fall due.
+    TOMBOY_SyncEngine(p_Engine);
     switch (p_Address)
     {
-        case TOMBOY_HP_JOYP:  TOMBOY_WriteJOYP(s_CurrentEngine->m_Joypad, p_Data); break;
-        case TOMBOY_HP_NTC:   TOMBOY_WriteNTC(s_CurrentEngine->m_Network, p_Data); break;
-        case TOMBOY_HP_DIV:   TOMBOY_WriteDIV(s_CurrentEngine->m_Timer, p_Data); break;
-        case TOMBOY_HP_TIMA:  TOMBOY_WriteTIMA(s_CurrentEngine->m_Timer, p_Data); break;
-        case TOMBOY_HP_TMA:   TOMBOY_WriteTMA(s_CurrentEngine->m_Timer, p_Data); break;
-        case TOMBOY_HP_TAC:   TOMBOY_WriteTAC(s_CurrentEngine->m_Timer, p_Data); break;
+        case TOMBOY_HP_JOYP:  TOMBOY_WriteJOYP(p_Engine->m_Joypad, p_Data); break;
+        case TOMBOY_HP_NTC:   TOMBOY_WriteNTC(p_Engine->m_Network, p_Data); break;
+        case TOMBOY_HP_DIV:   TOMBOY_WriteDIV(p_Engine->m_Timer, p_Data); break;
+        case TOMBOY_HP_TIMA:  TOMBOY_WriteTIMA(p_Engine->m_Timer, p_Data); break;
+        case TOMBOY_HP_TMA:   TOMBOY_WriteTMA(p_Engine->m_Timer, p_Data); break;
+        case TOMBOY_HP_TAC:   TOMBOY_WriteTAC(p_Engine->m_Timer, p_Data); break;
         case TOMBOY_HP_RTCS:  break; // Read-only register
         case TOMBOY_HP_RTCM:  break; // Read-only register
         case TOMBOY_HP_RTCH:  break; // Read-only register
         case TOMBOY_HP_RTCDH: break; // Read-only register
         case TOMBOY_HP_RTCDL: break; // Read-only register
-        case TOMBOY_HP_RTCL:  TOMBOY_WriteRTCL(s_CurrentEngine->m_Realtime, p_Data); break;
+        case TOMBOY_HP_RTCL:  TOMBOY_WriteRTCL(p_Engine->m_Realtime, p_Data); break;
         case TOMBOY_HP_RTCR:  break; // Read-only register
-        case TOMBOY_HP_IF:    TM_SetInterruptFlags(s_CurrentEngine->m_CPU, p_Data); break;
-        case TOMBOY_HP_NR10:  TOMBOY_WriteNR10(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR11:  TOMBOY_WriteNR11(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR12:  TOMBOY_WriteNR12(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR13:  TOMBOY_WriteNR13(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR14:  TOMBOY_WriteNR14(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR21:  TOMBOY_WriteNR21(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR22:  TOMBOY_WriteNR22(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR23:  TOMBOY_WriteNR23(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR24:  TOMBOY_WriteNR24(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR30:  TOMBOY_WriteNR30(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR31:  TOMBOY_WriteNR31(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR32:  TOMBOY_WriteNR32(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR33:  TOMBOY_WriteNR33(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR34:  TOMBOY_WriteNR34(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR41:  TOMBOY_WriteNR41(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR42:  TOMBOY_WriteNR42(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR43:  TOMBOY_WriteNR43(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR44:  TOMBOY_WriteNR44(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR50:  TOMBOY_WriteNR50(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR51:  TOMBOY_WriteNR51(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_NR52:  TOMBOY_WriteNR52(s_CurrentEngine->m_APU, p_Data); break;
-        case TOMBOY_HP_LCDC:  TOMBOY_WriteLCDC(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_STAT:  TOMBOY_WriteSTAT(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_SCY:   TOMBOY_WriteSCY(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_SCX:   TOMBOY_WriteSCX(s_CurrentEngine->m_PPU, p_Data); break;
+        case TOMBOY_HP_IF:    TM_SetInterruptFlags(p_Engine->m_CPU, p_Data); break;
+        case TOMBOY_HP_NR10:  TOMBOY_WriteNR10(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR11:  TOMBOY_WriteNR11(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR12:  TOMBOY_WriteNR12(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR13:  TOMBOY_WriteNR13(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR14:  TOMBOY_WriteNR14(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR21:  TOMBOY_WriteNR21(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR22:  TOMBOY_WriteNR22(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR23:  TOMBOY_WriteNR23(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR24:  TOMBOY_WriteNR24(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR30:  TOMBOY_WriteNR30(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR31:  TOMBOY_WriteNR31(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR32:  TOMBOY_WriteNR32(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR33:  TOMBOY_WriteNR33(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR34:  TOMBOY_WriteNR34(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR41:  TOMBOY_WriteNR41(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR42:  TOMBOY_WriteNR42(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR43:  TOMBOY_WriteNR43(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR44:  TOMBOY_WriteNR44(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR50:  TOMBOY_WriteNR50(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR51:  TOMBOY_WriteNR51(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_NR52:  TOMBOY_WriteNR52(p_Engine->m_APU, p_Data); break;
+        case TOMBOY_HP_LCDC:  TOMBOY_WriteLCDC(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_STAT:  TOMBOY_WriteSTAT(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_SCY:   TOMBOY_WriteSCY(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_SCX:   TOMBOY_WriteSCX(p_Engine->m_PPU, p_Data); break;
         case TOMBOY_HP_LY:    break; // Read-only register
-        case TOMBOY_HP_LYC:   TOMBOY_WriteLYC(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_DMA1:  TOMBOY_WriteDMA1(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_DMA2:  TOMBOY_WriteDMA2(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_DMA3:  TOMBOY_WriteDMA3(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_DMA:   TOMBOY_WriteDMA(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_BGP:   TOMBOY_WriteBGP(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_OBP0:  TOMBOY_WriteOBP0(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_OBP1:  TOMBOY_WriteOBP1(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_WY:    TOMBOY_WriteWY(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_WX:    TOMBOY_WriteWX(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_KEY1:  s_CurrentEngine->m_DoubleSpeed = (p_Data > 0); break;
-        case TOMBOY_HP_VBK:   TOMBOY_WriteVBK(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_HDMA1: TOMBOY_WriteHDMA1(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_HDMA2: TOMBOY_WriteHDMA2(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_HDMA3: TOMBOY_WriteHDMA3(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_HDMA4: TOMBOY_WriteHDMA4(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_HDMA5: TOMBOY_WriteHDMA5(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_HDMA6: TOMBOY_WriteHDMA6(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_HDMA7: TOMBOY_WriteHDMA7(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_BGPI:  TOMBOY_WriteBGPI(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_BGPD:  TOMBOY_WriteBGPD(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_OBPI:  TOMBOY_WriteOBPI(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_OBPD:  TOMBOY_WriteOBPD(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_OPRI:  TOMBOY_WriteOPRI(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_GRPM:  TOMBOY_WriteGRPM(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_VBP:   TOMBOY_WriteVBP(s_CurrentEngine->m_PPU, p_Data); break;
-        case TOMBOY_HP_IE:    TM_SetInterruptEnable(s_CurrentEngine->m_CPU, p_Data); break;
+        case TOMBOY_HP_LYC:   TOMBOY_WriteLYC(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_DMA1:  TOMBOY_WriteDMA1(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_DMA2:  TOMBOY_WriteDMA2(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_DMA3:  TOMBOY_WriteDMA3(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_DMA:   TOMBOY_WriteDMA(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_BGP:   TOMBOY_WriteBGP(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_OBP0:  TOMBOY_WriteOBP0(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_OBP1:  TOMBOY_WriteOBP1(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_WY:    TOMBOY_WriteWY(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_WX:    TOMBOY_WriteWX(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_KEY1:  p_Engine->m_DoubleSpeed = (p_Data > 0); break;
+        case TOMBOY_HP_VBK:   TOMBOY_WriteVBK(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_HDMA1: TOMBOY_WriteHDMA1(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_HDMA2: TOMBOY_WriteHDMA2(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_HDMA3: TOMBOY_WriteHDMA3(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_HDMA4: TOMBOY_WriteHDMA4(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_HDMA5: TOMBOY_WriteHDMA5(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_HDMA6: TOMBOY_WriteHDMA6(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_HDMA7: TOMBOY_WriteHDMA7(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_BGPI:  TOMBOY_WriteBGPI(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_BGPD:  TOMBOY_WriteBGPD(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_OBPI:  TOMBOY_WriteOBPI(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_OBPD:  TOMBOY_WriteOBPD(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_OPRI:  TOMBOY_WriteOPRI(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_GRPM:  TOMBOY_WriteGRPM(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_VBP:   TOMBOY_WriteVBP(p_Engine->m_PPU, p_Data); break;
+        case TOMBOY_HP_IE:    TM_SetInterruptEnable(p_Engine->m_CPU, p_Data); break;
         default:              break; // Invalid address
     }
+
+    TOMBOY_ScheduleEvents(p_Engine);
+}
+
+uint8_t TOMBOY_BusRead (void* p_Context, uint32_t p_Address)
+{
+    TOMBOY_Engine* l_Engine = (TOMBOY_Engine*) p_Context;
+    assert(l_Engine != NULL);
+
+    // Read plain memory straight from its page; leave anything else to the handler.
+    const TOMBOY_BusPage* l_Page = &l_Engine->m_Pages[p_Address >> TOMBOY_BUS_PAGE_SHIFT];
+    uint32_t l_Offset = p_Address & TOMBOY_BUS_PAGE_MASK;
+    if (l_Offset < l_Page->m_ReadLimit)
+    {
+        return l_Page->m_Read[l_Offset];
+    }
+
+    return TOMBOY_BusReadHandler(l_Engine, p_Address);
+}
+
+void TOMBOY_BusWrite (void* p_Context, uint32_t p_Address, uint8_t p_Data)
+{
+    TOMBOY_Engine* l_Engine = (TOMBOY_Engine*) p_Context;
+    assert(l_Engine != NULL);
+
+    // Write plain memory straight to its page; leave anything else to the handler.
+    TOMBOY_BusPage* l_Page = &l_Engine->m_Pages[p_Address >> TOMBOY_BUS_PAGE_SHIFT];
+    uint32_t l_Offset = p_Address & TOMBOY_BUS_PAGE_MASK;
+    if (l_Offset < l_Page->m_WriteLimit)
+    {
+        l_Page->m_Write[l_Offset] = p_Data;
+        return;
+    }
+
+    TOMBOY_BusWriteHandler(l_Engine, p_Address, p_Data);
+}
+
+uint8_t* TOMBOY_BusPointer (void* p_Context, uint32_t p_Address, uint32_t p_Size, bool p_Write)
+{
+    TOMBOY_Engine* l_Engine = (TOMBOY_Engine*) p_Context;
+    assert(l_Engine != NULL);
+
+    // The access can be made directly only if all of its bytes lie below the limit of the one page.
+    // The CPU never writes through a pointer it asked for only to read, so read-only memory, such
+    // as the program ROM, can be handed out for reads.
+    const TOMBOY_BusPage* l_Page = &l_Engine->m_Pages[p_Address >> TOMBOY_BUS_PAGE_SHIFT];
+    uint32_t l_Offset = p_Address & TOMBOY_BUS_PAGE_MASK;
+    if (p_Write == true)
+    {
+        return (l_Offset + p_Size <= l_Page->m_WriteLimit) ? l_Page->m_Write + l_Offset : NULL;
+    }
+
+    return (l_Offset + p_Size <= l_Page->m_ReadLimit) ? (uint8_t*) l_Page->m_Read + l_Offset : NULL;
+}
+
+void TOMBOY_SyncTimerAndAPU (TOMBOY_Engine* p_Engine)
+{
+    assert(p_Engine != NULL);
+
+    uint64_t l_Cycle = p_Engine->m_SyncedCycles;
+    if (l_Cycle >= p_Engine->m_Cycles)
+    {
+        return;
+    }
+
+    // Advance the APU first, in stretches ending on each tick of its internal divider - each fall
+    // of the timer's DIV-APU bit. The timer has not been advanced yet, so its divider still holds
+    // its value as of the last sync.
+    uint8_t l_AudioDividerTimerBit = (p_Engine->m_DoubleSpeed) ? 12 : 13;
+    uint64_t l_Fall = l_Cycle + TOMBOY_GetTicksUntilDividerFall(p_Engine->m_Timer,
+        l_AudioDividerTimerBit);
+    while (l_Cycle < p_Engine->m_Cycles)
+    {
+        uint64_t l_Stop = (l_Fall < p_Engine->m_Cycles) ? l_Fall : p_Engine->m_Cycles;
+        TOMBOY_AdvanceAPU(p_Engine->m_APU, l_Cycle, (uint32_t) (l_Stop - l_Cycle),
+            l_Stop == l_Fall);
+
+        l_Cycle = l_Stop;
+        l_Fall += (1u << (l_AudioDividerTimerBit + 1));
+    }
+
+    // Then advance the timer, which requests the timer interrupt if its counter overflows.
+    TOMBOY_AdvanceTimer(p_Engine->m_Timer, (uint32_t) (p_Engine->m_Cycles - p_Engine->m_SyncedCycles));
+    p_Engine->m_SyncedCycles = p_Engine->m_Cycles;
+}
+
+void TOMBOY_SyncPPU (TOMBOY_Engine* p_Engine)
+{
+    assert(p_Engine != NULL);
+
+    uint64_t l_Cycle = p_Engine->m_PPUCycles;
+    if (l_Cycle >= p_Engine->m_Cycles)
+    {
+        return;
+    }
+
+    // Mark the PPU as up to date before advancing it: its DMA transfers read from the bus, and may
+    // land back here through the bus handlers.
+    p_Engine->m_PPUCycles = p_Engine->m_Cycles;
+
+    uint8_t l_ODMATickFrequency = (p_Engine->m_DoubleSpeed) ? 2 : 4;
+    TOMBOY_AdvancePPU(p_Engine->m_PPU, l_Cycle, (uint32_t) (p_Engine->m_Cycles - l_Cycle),
+        l_ODMATickFrequency);
+}
+
+void TOMBOY_SyncEngine (TOMBOY_Engine* p_Engine)
+{
+    assert(p_Engine != NULL);
+
+    TOMBOY_SyncTimerAndAPU(p_Engine);
+    TOMBOY_SyncPPU(p_Engine);
+}
+
+void TOMBOY_ScheduleEvents (TOMBOY_Engine* p_Engine)
+{
+    assert(p_Engine != NULL);
+
+    // The events are scheduled from the components' current state, so bring them up to date.
+    TOMBOY_SyncEngine(p_Engine);
+
+    uint64_t l_Now = p_Engine->m_Cycles;
+    uint8_t l_NetworkDividerTimerBit = (p_Engine->m_DoubleSpeed) ? 14 : 15;
+    uint8_t l_ODMATickFrequency = (p_Engine->m_DoubleSpeed) ? 2 : 4;
+
+    // The timer's next overflow, if it is enabled.
+    uint32_t l_TimerTicks = TOMBOY_GetTicksUntilTimerInterrupt(p_Engine->m_Timer);
+    p_Engine->m_Deadlines[TOMBOY_EE_TIMER] =
+        (l_TimerTicks == UINT32_MAX) ? UINT64_MAX : l_Now + l_TimerTicks;
+
+    // The APU's next audio mix.
+    p_Engine->m_Deadlines[TOMBOY_EE_APU] =
+        l_Now + TOMBOY_GetTicksUntilAudioMix(p_Engine->m_APU, l_Now);
+
+    // The PPU's next mode or scanline change, or frame rendered callback.
+    uint32_t l_PPUTicks = TOMBOY_GetTicksUntilPPUEvent(p_Engine->m_PPU);
+    p_Engine->m_Deadlines[TOMBOY_EE_PPU] =
+        (l_PPUTicks == UINT32_MAX) ? UINT64_MAX : l_Now + l_PPUTicks;
+
+    // The next byte of an OAM DMA transfer, if one is in progress. The PPU is kept up to date while
+    // the transfer runs, so that it copies each byte from the bus as it stands at that point.
+    p_Engine->m_Deadlines[TOMBOY_EE_ODMA] =
+        (TOMBOY_IsODMAActive(p_Engine->m_PPU) == true) ?
+            (l_Now / l_ODMATickFrequency + 1) * l_ODMATickFrequency :
+            UINT64_MAX;
+
+    // The network interface's next tick, if it has a transfer in progress.
+    p_Engine->m_Deadlines[TOMBOY_EE_NETWORK] =
+        (TOMBOY_IsNetworkBusy(p_Engine->m_Network) == true) ?
+            l_Now + TOMBOY_GetTicksUntilDividerFall(p_Engine->m_Timer, l_NetworkDividerTimerBit) :
+            UINT64_MAX;
+
+    // Note the soonest of them.
+    p_Engine->m_NextDeadline = UINT64_MAX;
+    for (uint8_t i = 0; i < TOMBOY_EE_COUNT; ++i)
+    {
+        if (p_Engine->m_Deadlines[i] < p_Engine->m_NextDeadline)
+        {
+            p_Engine->m_NextDeadline = p_Engine->m_Deadlines[i];
+        }
+    }
+}
+
+void TOMBOY_RunEvents (TOMBOY_Engine* p_Engine)
+{
+    assert(p_Engine != NULL);
+
+    // Bringing the timer, APU and PPU up to date runs their events: the timer requests its interrupt
+    // on overflowing, the APU mixes its sample, and the PPU changes mode, requesting its interrupts
+    // and calling the frame rendered callback as it goes.
+    TOMBOY_SyncEngine(p_Engine);
+
+    // Tick the network interface, if its event is due.
+    if (p_Engine->m_Deadlines[TOMBOY_EE_NETWORK] <= p_Engine->m_Cycles)
+    {
+        TOMBOY_TickNetwork(p_Engine->m_Network);
+    }
+
+    // Schedule the next round of events.
+    TOMBOY_ScheduleEvents(p_Engine);
 }
 
-bool TOMBOY_Cycle (uint32_t p_Cycles)
+bool TOMBOY_Cycle (void* p_Context, uint32_t p_Cycles)
 {
-    assert(s_CurrentEngine != NULL);
+    TOMBOY_Engine* l_Engine = (TOMBOY_Engine*) p_Context;
+    assert(l_Engine != NULL);
     
-    uint8_t l_TicksPerCycle             = (s_CurrentEngine->m_DoubleSpeed) ? 8 : 4;
-    uint8_t l_AudioDividerTimerBit      = (s_CurrentEngine->m_DoubleSpeed) ? 12 : 13;
-    uint8_t l_NetworkDividerTimerBit    = (s_CurrentEngine->m_DoubleSpeed) ? 14 : 15;
-    uint8_t l_ODMATickFrequency          = (s_CurrentEngine->m_DoubleSpeed) ? 2 : 4;
+    uint8_t l_TicksPerCycle             = (l_Engine->m_DoubleSpeed) ? 8 : 4;
+    uint8_t l_ODMATickFrequency         = (l_Engine->m_DoubleSpeed) ? 2 : 4;
+    uint64_t l_Target = l_Engine->m_Cycles + (uint64_t) p_Cycles * l_TicksPerCycle;
 
-    for (uint32_t l_MachineCycle = 0; l_MachineCycle < p_Cycles; ++l_MachineCycle)
+    // With event scheduling disabled, bring the timer and APU up to date, and tick the PPU, on
+    // every tick, then run any events which have fallen due.
+    if (l_Engine->m_EventScheduling == false)
     {
-        for (uint8_t l_Tick = 0; l_Tick < l_TicksPerCycle; ++l_Tick)
+        while (l_Engine->m_Cycles < l_Target)
         {
-            s_CurrentEngine->m_Cycles++;
-
-            TOMBOY_TickTimer(s_CurrentEngine->m_Timer);
-            TOMBOY_TickAPU(s_CurrentEngine->m_APU, 
-                TOMBOY_TestTimerDividerBit(s_CurrentEngine->m_Timer, l_AudioDividerTimerBit));
-            TOMBOY_TickPPU(s_CurrentEngine->m_PPU,
-                (s_CurrentEngine->m_Cycles % l_ODMATickFrequency) == 0);
-            
-            if (TOMBOY_TestTimerDividerBit(s_CurrentEngine->m_Timer, l_NetworkDividerTimerBit))
+            l_Engine->m_Cycles++;
+            TOMBOY_SyncTimerAndAPU(l_Engine);
+            l_Engine->m_PPUCycles = l_Engine->m_Cycles;
+            TOMBOY_TickPPU(l_Engine->m_PPU, (l_Engine->m_Cycles % l_ODMATickFrequency) == 0);
+
+            if (l_Engine->m_Cycles >= l_Engine->m_NextDeadline)
             {
-                TOMBOY_TickNetwork(s_CurrentEngine->m_Network);
+                TOMBOY_RunEvents(l_Engine);
             }
         }
+
+        return true;
     }
 
+    // Run the events which fall due within the cycles given, in order. Nothing needs to happen in
+    // between them.
+    while (l_Engine->m_NextDeadline <= l_Target)
+    {
+        l_Engine->m_Cycles = l_Engine->m_NextDeadline;
+        TOMBOY_RunEvents(l_Engine);
+    }
+
+    l_Engine->m_Cycles = l_Target;
     return true;
 }
 
+uint32_t TOMBOY_NextEvent (void* p_Context)
+{
+    TOMBOY_Engine* l_Engine = (TOMBOY_Engine*) p_Context;
+    assert(l_Engine != NULL);
+
+    uint8_t l_TicksPerCycle             = (l_Engine->m_DoubleSpeed) ? 8 : 4;
+
+    // Find the soonest event, in ticks, which could request an interrupt: a timer overflow, a PPU
+    // mode or scanline change, or a network tick while a transfer is in progress. The joypad and
+    // real-time clock only request interrupts in response to the host or the program, and the host
+    // gets a chance to run at least once a frame, through the frame rendered callback. The timer
+    // and network events are already scheduled; the audio mix and OAM DMA transfer never request an
+    // interrupt. The PPU's event is found afresh from its current state.
+    TOMBOY_SyncPPU(l_Engine);
+
+    uint64_t l_Deadline = l_Engine->m_Deadlines[TOMBOY_EE_TIMER];
+    if (l_Engine->m_Deadlines[TOMBOY_EE_NETWORK] < l_Deadline)
+    {
+        l_Deadline = l_Engine->m_Deadlines[TOMBOY_EE_NETWORK];
+    }
+
+    uint64_t l_Ticks = (l_Deadline > l_Engine->m_Cycles) ? (l_Deadline - l_Engine->m_Cycles) : 1;
+
+    uint32_t l_PPUTicks = TOMBOY_GetTicksUntilPPUEvent(l_Engine->m_PPU);
+    if (l_PPUTicks < l_Ticks)
+    {
+        l_Ticks = l_PPUTicks;
+    }
+
+    // Skip at most a frame at a time, even with nothing scheduled.
+    if (l_Ticks > TOMBOY_PPU_DOTS_PER_FRAME)
+    {
+        l_Ticks = TOMBOY_PPU_DOTS_PER_FRAME;
+    }
+
+    // An event on any tick of a cycle is seen by the CPU at the end of that cycle, so round up.
+    return (l_Ticks + l_TicksPerCycle - 1) / l_TicksPerCycle;
+}
+
 // Public Functions ////////////////////////////////////////////////////////////////////////////////
 
 TOMBOY_Engine* TOMBOY_CreateEngine (const TOMBOY_Program* p_Program)
@@ -417,9 +790,19 @@ TOMBOY_Engine* TOMBOY_CreateEngine (const TOMBOY_Program* p_Program)
     TM_pexpect(l_Engine != NULL, "Failed to allocate TOMBOY Engine");
 
     // Create the CPU instance.
-    l_Engine->m_CPU = TM_CreateCPU(TOMBOY_BusRead, TOMBOY_BusWrite, TOMBOY_Cycle);
+    l_Engine->m_CPU = TM_CreateCPU(TOMBOY_BusRead, TOMBOY_BusWrite, TOMBOY_Cycle, l_Engine);
     TM_expect(l_Engine->m_CPU != NULL, "Failed to create TOMBOY CPU!");
 
+    // Let the CPU pass its cycles to the engine in batches, rather than one call per bus access.
+    TM_SetCycleBatching(l_Engine->m_CPU, true);
+
+    // Let the CPU access words and double words in plain memory directly, through the bus pages.
+    TM_SetBusPointerFunction(l_Engine->m_CPU, TOMBOY_BusPointer);
+
+    // While the CPU is halted, let it skip ahead to the next event which could wake it.
+    TM_SetNextEventFunction(l_Engine->m_CPU, TOMBOY_NextEvent);
+    l_Engine->m_EventScheduling = true;
+
     // Create the timer instance.
     l_Engine->m_Timer = TOMBOY_CreateTimer(l_Engine);
     TM_expect(l_Engine->m_Timer != NULL, "Failed to create TOMBOY Timer!");
@@ -454,6 +837,12 @@ TOMBOY_Engine* TOMBOY_CreateEngine (const TOMBOY_Program* p_Program)
     // Load the program into the engine.
     l_Engine->m_Program = p_Program;
 
+    // Map the program ROM and the plain RAM spaces into the bus page tables.
+    TOMBOY_MapBus(l_Engine);
+
+    // Schedule the components' first events.
+    TOMBOY_ScheduleEvents(l_Engine);
+
     // If there is no current engine context set, then make this engine the current engine.
     if (TOMBOY_IsCurrentEngineSet() == false)
     {
@@ -475,6 +864,9 @@ void TOMBOY_ResetEngine (TOMBOY_Engine* p_Engine)
     TOMBOY_ResetRealtime(p_Engine->m_Realtime);
     TOMBOY_ResetAPU(p_Engine->m_APU);
     p_Engine->m_Cycles = 0;
+    p_Engine->m_SyncedCycles = 0;
+    p_Engine->m_PPUCycles = 0;
+    TOMBOY_ScheduleEvents(p_Engine);
 }
 
 void TOMBOY_DestroyEngine (TOMBOY_Engine* p_Engine)
@@ -525,19 +917,71 @@ bool TOMBOY_TickEngine ()
         return false;
     }
 
-    TM_StepCPU(s_CurrentEngine->m_CPU);
+    return TOMBOY_StepEngine(s_CurrentEngine);
+}
+
+bool TOMBOY_StepEngine (TOMBOY_Engine* p_Engine)
+{
+    if (p_Engine == NULL)
+    {
+        TM_error("Engine context is NULL!");
+        return false;
+    }
+
+    TM_StepCPU(p_Engine->m_CPU);
+
+    // Check if the CPU is stopped.
+    bool l_Stopped = TM_IsStopped(p_Engine->m_CPU);
+    if (l_Stopped == true)
+    {
+        // If the CPU has been stopped, then report the error code before returning.
+        TM_info("Program exited with code %u.", TM_GetErrorCode(p_Engine->m_CPU));
+    }
+
+    return l_Stopped == false;
+}
+
+bool TOMBOY_RunEngine (TOMBOY_Engine* p_Engine, uint64_t p_Cycles)
+{
+    if (p_Engine == NULL)
+    {
+        TM_error("Engine context is NULL!");
+        return false;
+    }
+
+    TM_RunCPU(p_Engine->m_CPU, p_Cycles, NULL, NULL);
 
     // Check if the CPU is stopped.
-    bool l_Stopped = TM_IsStopped(s_CurrentEngine->m_CPU);
+    bool l_Stopped = TM_IsStopped(p_Engine->m_CPU);
     if (l_Stopped == true)
     {
         // If the CPU has been stopped, then report the error code before returning.
-        TM_info("Program exited with code %u.", TM_GetErrorCode(s_CurrentEngine->m_CPU));
+        TM_info("Program exited with code %u.", TM_GetErrorCode(p_Engine->m_CPU));
     }
 
     return l_Stopped == false;
 }
 
+void TOMBOY_SetEventScheduling (TOMBOY_Engine* p_Engine, bool p_Enabled)
+{
+    if (p_Engine == NULL)
+    {
+        TM_error("Engine context is NULL!");
+        return;
+    }
+
+    // Bring every component up to date before switching, so that neither mode inherits work left
+    // over by the other.
+    TM_FlushCPUCycles(p_Engine->m_CPU);
+    TOMBOY_SyncEngine(p_Engine);
+
+    // Without event scheduling, the CPU passes on every cycle as it completes it, and waits out a
+    // halt one cycle at a time.
+    p_Engine->m_EventScheduling = p_Enabled;
+    TM_SetCycleBatching(p_Engine->m_CPU, p_Enabled);
+    TM_SetNextEventFunction(p_Engine->m_CPU, (p_Enabled == true) ? TOMBOY_NextEvent : NULL);
+}
+
 uint64_t TOMBOY_GetCycleCount (const TOMBOY_Engine* p_Engine)
 {
     if (p_Engine == NULL)
@@ -607,6 +1051,17 @@ TOMBOY_Joypad* TOMBOY_GetJoypad (TOMBOY_Engine* p_Engine)
     return p_Engine->m_Joypad;
 }
 
+const uint8_t* TOMBOY_GetBusReadPointer (TOMBOY_Engine* p_Engine, uint32_t p_Address, uint32_t p_Size)
+{
+    if (p_Engine == NULL)
+    {
+        TM_error("Engine context is NULL!");
+        return NULL;
+    }
+
+    return TOMBOY_BusPointer(p_Engine, p_Address, p_Size, false);
+}
+
 void TOMBOY_SetCallbacks (TOMBOY_Engine* p_Engine, TOMBOY_FrameRenderedCallback p_FrameCallback, TOMBOY_AudioMixCallback p_AudioCallback)
 {
     if (p_Engine == NULL)
@@ -216,6 +216,17 @@ bool TOMBOY_TickNetwork (TOMBOY_Network* p_Network)
     return true;
 }
 
+bool TOMBOY_IsNetworkBusy (const TOMBOY_Network* p_Network)
+{
+    if (p_Network == NULL)
+    {
+        TM_error("Network interface is NULL.");
+        return false;
+    }
+
+    return p_Network->m_NTC.m_Enable == true && p_Network->m_NTC.m_Status == TOMBOY_NS_BUSY;
+}
+
 bool TOMBOY_ConnectNetwork (TOMBOY_Network* p_Network, const char* p_Host, uint16_t p_Port)
 {
     if (p_Network == NULL)
@@ -4,6 +4,15 @@
 
 #include <TOMBOY/Engine.h>
 #include <TOMBOY/PPU.h>
+#include <stdatomic.h>
+
+// The vector kernels are written with x86-64 intrinsics. GCC and Clang can compile each of them for
+// its own instruction set, so the one build can check which the host supports as it runs. Define
+// `TOMBOY_NO_SIMD` to build only the portable scalar kernels.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(TOMBOY_NO_SIMD)
+    #include <immintrin.h>
+    #define TOMBOY_SIMD_SUPPORTED
+#endif
 
 // Static Constants ////////////////////////////////////////////////////////////////////////////////
 
@@ -29,6 +38,31 @@ static const uint8_t TOMBOY_PPU_DMG_PALETTE_RGB555[8] = {
     0b00000000, 0b00000000
 };
 
+// The number of dots the pixel fetcher and FIFO take to push a scanline's 160 pixels to the screen
+// buffer, by the fine scroll, `SCX % 8`. The fast render mode holds its pixel transfer for as long.
+static const uint8_t TOMBOY_PPU_PIXEL_TRANSFER_DOTS[8] =
+{
+    216, 219, 220, 221, 222, 223, 224, 225
+};
+
+// The number of bytes each pixel takes up in the screen buffer, by pixel format.
+static const uint8_t TOMBOY_PPU_PIXEL_SIZES[] =
+{
+    [TOMBOY_PF_RGBA8888] = 4,
+    [TOMBOY_PF_ARGB8888] = 4,
+    [TOMBOY_PF_BGRA8888] = 4,
+    [TOMBOY_PF_RGB565]   = 2,
+    [TOMBOY_PF_INDEXED8] = 1
+};
+
+// The first index of each part of the indexed pixel format's palette.
+static const uint8_t TOMBOY_PPU_INDEXED_OBJ_START = TOMBOY_PPU_PALETTE_COUNT * TOMBOY_PPU_PALETTE_COLOR_COUNT;
+static const uint8_t TOMBOY_PPU_INDEXED_DMG_START = 2 * TOMBOY_PPU_PALETTE_COUNT * TOMBOY_PPU_PALETTE_COLOR_COUNT;
+
+// Set in the index of the pending screen buffer if it holds a frame the render thread has not yet
+// acquired.
+static const uint8_t TOMBOY_PPU_FRESH_FRAME = 0x80;
+
 // TOMBOY PPU Context Structure ////////////////////////////////////////////////////////////////////
 
 typedef struct TOMBOY_PPU
@@ -44,7 +78,9 @@ typedef struct TOMBOY_PPU
     TOMBOY_PixelFetcher m_PixelFetcher;     ///< @brief The pixel fetcher.
 
     // Memory Buffers
-    uint32_t        m_ScreenBuffer[TOMBOY_PPU_SCREEN_PIXEL_SIZE];   ///< @brief The screen buffer.
+    uint32_t        m_ScreenBuffers[TOMBOY_PPU_FRAME_BUFFER_COUNT][TOMBOY_PPU_SCREEN_PIXEL_SIZE];  ///< @brief The screen buffers, which the PPU draws into in turn while it hands frames off. Each is sized for the widest pixel format.
+    uint8_t*        m_ScreenBuffer;                                 ///< @brief Points to the screen buffer the PPU is drawing into.
+    uint64_t        m_DirtyLines[TOMBOY_PPU_DIRTY_LINE_WORDS];      ///< @brief A bitmap of the scanlines whose pixels have changed since the last frame was delivered.
     uint8_t         m_VRAM0[TOMBOY_PPU_VRAM_BANK_SIZE];             ///< @brief The first VRAM bank.
     uint8_t         m_VRAM1[TOMBOY_PPU_VRAM_BANK_SIZE];             ///< @brief The second VRAM bank.
     TOMBOY_Object   m_OAM[TOMBOY_PPU_OAM_SIZE];                     ///< @brief The object attribute memory (OAM) buffer.
@@ -52,6 +88,20 @@ typedef struct TOMBOY_PPU
     uint8_t         m_ObjCRAM[TOMBOY_PPU_CRAM_SIZE];                ///< @brief The object color RAM (CRAM) buffer.
     uint8_t*        m_VRAM;                                         ///< @brief A pointer to the currently-selected VRAM bank.
 
+    // Decoded Tile Cache
+    TOMBOY_DecodedTile  m_TileCache[2][TOMBOY_PPU_TILES_PER_BLOCK];         ///< @brief The tiles in each VRAM bank's tile data area, decoded as they are drawn.
+    bool                m_TileCacheValid[2][TOMBOY_PPU_TILES_PER_BLOCK];    ///< @brief Whether each tile in the cache is up to date with its data in VRAM.
+
+    // Palette Caches
+    uint32_t        m_CRAMColors[2][TOMBOY_PPU_PALETTE_COUNT][TOMBOY_PPU_PALETTE_COLOR_COUNT]; ///< @brief The colors in the background (`[0]`) and object (`[1]`) CRAM buffers, in the pixel format.
+    uint32_t        m_DMGColors[3][TOMBOY_PPU_PALETTE_COLOR_COUNT];                           ///< @brief The colors the `BGP`, `OBP0` and `OBP1` registers map each color index to, in the pixel format.
+    uint32_t        m_BlankColors[TOMBOY_PPU_PALETTE_COLOR_COUNT];                            ///< @brief The colors used for the background/window layer in DMG mode while `LCDC` bit 0 is clear, which make every pixel of that layer transparent.
+
+    // Pixel Format
+    TOMBOY_PixelFormat  m_PixelFormat;  ///< @brief The format in which pixels are written to the screen buffer, and in which the palette caches hold their colors.
+    uint8_t             m_PixelSize;    ///< @brief The number of bytes each pixel takes up in the screen buffer.
+    uint16_t            m_ScreenPitch;  ///< @brief The number of bytes each scanline takes up in the screen buffer.
+
     // Hardware Registers
     TOMBOY_DisplayControl           m_LCDC;     ///< @brief The display control register.
     TOMBOY_DisplayStatus            m_STAT;     ///< @brief The display status register.
@@ -86,6 +136,7 @@ typedef struct TOMBOY_PPU
     uint8_t     m_WindowLine;                   ///< @brief The current line of the window layer.
     uint16_t    m_CurrentDot;                   ///< @brief The current dot in the current scanline.
     uint32_t    m_ODMASource;                   ///< @brief The source address of the OAM DMA transfer.
+    const uint8_t* m_ODMAHostSource;            ///< @brief Points to the host memory backing the OAM DMA transfer's source, if it is plain memory; `NULL` otherwise.
     uint8_t     m_ODMATicks;                    ///< @brief The number of ticks elapsed in the OAM DMA transfer, also indicates the low byte of the destination address.
     uint8_t     m_ODMADelay;                    ///< @brief The number of ticks to wait until initiating the OAM DMA transfer.
     uint32_t    m_HDMASource;                   ///< @brief The source address of the HDMA transfer.
@@ -93,19 +144,88 @@ typedef struct TOMBOY_PPU
     uint8_t     m_HDMABlocksLeft;               ///< @brief The number of 16-byte blocks left to transfer in the HDMA transfer.
     uint8_t     m_LineObjectIndices[10];        ///< @brief The indices of the objects residing on the current scanline.
     uint8_t     m_LineObjectCount;              ///< @brief The number of objects residing on the current scanline.
+    uint64_t    m_ObjectLineMasks[2][TOMBOY_PPU_SCREEN_HEIGHT]; ///< @brief For 8- and 16-pixel tall objects, masks of the objects in OAM which reside on each visible scanline.
+    uint8_t     m_ObjectsByX[TOMBOY_PPU_OBJECT_COUNT];          ///< @brief The indices of the objects in OAM, sorted by their X positions, then by their indices.
     uint32_t    m_InactiveDivider;              ///< @brief A divider to increment when the PPU is disabled.
 
+    // Frame Handoff
+    bool            m_FrameHandoff;     ///< @brief Does the PPU hand its finished frames off to another thread?
+    uint8_t         m_BackBuffer;       ///< @brief The index of the screen buffer the PPU is drawing into.
+    _Atomic uint8_t m_PendingBuffer;    ///< @brief The index of the screen buffer passed between the PPU and the render thread, with `TOMBOY_PPU_FRESH_FRAME` set if its frame is yet to be acquired.
+    uint8_t         m_FrontBuffer;      ///< @brief The index of the screen buffer last acquired by the render thread. Only that thread touches this.
+    uint64_t        m_StaleLines[TOMBOY_PPU_FRAME_BUFFER_COUNT][TOMBOY_PPU_DIRTY_LINE_WORDS];  ///< @brief For each screen buffer, a bitmap of the scanlines which differ from the latest frame handed off.
+
+    // Scanline Renderer
+    TOMBOY_RenderMode       m_RenderMode;       ///< @brief The way in which the PPU draws its scanlines.
+    TOMBOY_RenderMode       m_LineRenderMode;   ///< @brief The render mode, latched as the current scanline's pixel transfer began.
+    bool                    m_FrameSkip;        ///< @brief Does the PPU skip drawing the frames it begins?
+    bool                    m_SkippingFrame;    ///< @brief Is the current frame's drawing skipped? Latched as its first scanline's pixel transfer began.
+    TOMBOY_DisplayControl   m_LineLCDC;         ///< @brief The `LCDC` register, latched as the current scanline's pixel transfer began.
+    uint8_t                 m_LineSCY;          ///< @brief The `SCY` register, latched as the current scanline's pixel transfer began.
+    uint8_t                 m_LineSCX;          ///< @brief The `SCX` register, latched as the current scanline's pixel transfer began.
+    uint8_t                 m_LineWY;           ///< @brief The `WY` register, latched as the current scanline's pixel transfer began.
+    uint8_t                 m_LineWX;           ///< @brief The `WX` register, latched as the current scanline's pixel transfer began.
+
 } TOMBOY_PPU;
 
+// PPU Kernel Table Structure //////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief   Contains the kernels the PPU uses to decode tiles and to color scanlines. A kernel set
+ *          leaves `NULL` the kernels it does not provide.
+ */
+typedef struct TOMBOY_PPUKernels
+{
+    void (*m_DecodeTile) (const uint8_t*, TOMBOY_DecodedTile*);                 ///< @brief Decodes a tile's 16 bytes of data into its rows of color indices.
+    void (*m_LookupColors) (const uint8_t*, const uint32_t*, uint32_t*);        ///< @brief Looks up the colors of 8 color indices in a 4-color palette.
+} TOMBOY_PPUKernels;
+
 // Static Function Prototypes - Misc. Helper Functions /////////////////////////////////////////////
 
 static bool TOMBOY_IsWindowVisible (TOMBOY_PPU* p_PPU);
 static void TOMBOY_IncrementLY (TOMBOY_PPU* p_PPU);
+static void TOMBOY_MarkScanlineDirty (TOMBOY_PPU* p_PPU, uint8_t p_Line);
+static bool TOMBOY_StorePixel (TOMBOY_PPU* p_PPU, uint32_t p_Index, uint32_t p_Color);
+static const uint8_t* TOMBOY_PackPixels (const TOMBOY_PPU* p_PPU, const uint32_t* p_Colors, uint8_t* p_Buffer);
+static void TOMBOY_PublishFrame (TOMBOY_PPU* p_PPU);
+static void TOMBOY_DeliverFrame (TOMBOY_PPU* p_PPU);
+
+// Static Function Prototypes - PPU Kernels ///////////////////////////////////////////////////////
+
+static void TOMBOY_DecodeTileScalar (const uint8_t* p_Data, TOMBOY_DecodedTile* p_Tile);
+static void TOMBOY_LookupColorsScalar (const uint8_t* p_Row, const uint32_t* p_Palette, uint32_t* p_Colors);
+#if defined(TOMBOY_SIMD_SUPPORTED)
+static void TOMBOY_DecodeTileSSE2 (const uint8_t* p_Data, TOMBOY_DecodedTile* p_Tile);
+static void TOMBOY_DecodeTileBMI2 (const uint8_t* p_Data, TOMBOY_DecodedTile* p_Tile);
+static void TOMBOY_LookupColorsAVX2 (const uint8_t* p_Row, const uint32_t* p_Palette, uint32_t* p_Colors);
+#endif
+static bool TOMBOY_IsKernelSetSupported (TOMBOY_PPUKernelSet p_Set);
+#if defined(TOMBOY_SIMD_SUPPORTED)
+__attribute__((constructor))
+static void TOMBOY_SelectKernels (void);
+#endif
+
+// Static Function Prototypes - Decoded Tile Cache /////////////////////////////////////////////////
+
+static uint8_t TOMBOY_GetVRAMBankIndex (const TOMBOY_PPU* p_PPU);
+static void TOMBOY_DecodeTile (TOMBOY_PPU* p_PPU, uint8_t p_Bank, uint16_t p_Tile);
+static const uint8_t* TOMBOY_GetDecodedTileRow (TOMBOY_PPU* p_PPU, uint16_t p_Address, bool p_Flip);
+static const uint8_t* TOMBOY_GetFetchedTileRow (TOMBOY_PPU* p_PPU, uint16_t p_Address, uint8_t p_Low, bool p_Flip, uint8_t* p_Buffer);
+
+// Static Function Prototypes - Palette Caches ////////////////////////////////////////////////////
+
+static uint32_t TOMBOY_EncodeColor (const TOMBOY_PPU* p_PPU, uint32_t p_RGBA, uint8_t p_Index);
+static void TOMBOY_UpdateCRAMColor (TOMBOY_PPU* p_PPU, bool p_Object, uint8_t p_ByteIndex);
+static void TOMBOY_UpdateDMGColors (TOMBOY_PPU* p_PPU, uint8_t p_Palette, uint8_t p_Value);
+static void TOMBOY_FillPaletteCaches (TOMBOY_PPU* p_PPU);
 
 // Static Function Prototypes - Object Scan ////////////////////////////////////////////////////////
 
 static void TOMBOY_ClearLineObjects (TOMBOY_PPU* p_PPU);
-static void TOMBOY_FindLineObject (TOMBOY_PPU* p_PPU);
+static void TOMBOY_BucketObject (TOMBOY_PPU* p_PPU, uint8_t p_Index, bool p_Add);
+static void TOMBOY_SortObjectByX (TOMBOY_PPU* p_PPU, uint8_t p_Index);
+static void TOMBOY_ResetObjectBuckets (TOMBOY_PPU* p_PPU);
+static void TOMBOY_FindLineObjects (TOMBOY_PPU* p_PPU);
 
 // Static Function Prototypes - Pixel Transfer /////////////////////////////////////////////////////
 
@@ -113,9 +233,11 @@ static uint32_t TOMBOY_GetBackgroundColorInternal (TOMBOY_PPU* p_PPU, uint8_t p_
 static uint32_t TOMBOY_GetObjectColorInternal (TOMBOY_PPU* p_PPU, uint8_t p_PaletteIndex, uint8_t p_ColorIndex, TOMBOY_ColorRGB555* p_RGB555);
 static void TOMBOY_PushColor (TOMBOY_PixelFetcher* p_Fetcher, uint32_t p_Color);
 static void TOMBOY_PopColor (TOMBOY_PixelFetcher* p_Fetcher, uint32_t* p_Color);
+static const uint32_t* TOMBOY_GetBackgroundPalette (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher);
+static uint32_t TOMBOY_GetFetchedPixelColor (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher, uint8_t p_Index);
 static bool TOMBOY_TryAddPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher);
 static void TOMBOY_ShiftNextPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher);
-static uint32_t TOMBOY_FetchObjectPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher, uint8_t p_Bit, uint8_t p_ColorIndex, uint32_t p_RGBAColorValue, uint8_t p_BGWindowPriority);
+static uint32_t TOMBOY_FetchObjectPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher, uint8_t p_ColorIndex, uint32_t p_RGBAColorValue, uint8_t p_BGWindowPriority);
 static void TOMBOY_FetchBackgroundTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher);
 static void TOMBOY_FetchWindowTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher);
 static void TOMBOY_FetchObjectTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher);
@@ -128,12 +250,20 @@ static void TOMBOY_FetchSleep (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher
 static void TOMBOY_TickPixelFetcher (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher);
 static void TOMBOY_ResetPixelFetcher (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher);
 
+// Static Function Prototypes - Scanline Renderer /////////////////////////////////////////////////
+
+static uint16_t TOMBOY_GetPixelTransferEndDot (const TOMBOY_PPU* p_PPU);
+static void TOMBOY_LatchLineRegisters (TOMBOY_PPU* p_PPU);
+static void TOMBOY_SwapLineRegisters (TOMBOY_PPU* p_PPU);
+static void TOMBOY_RenderScanline (TOMBOY_PPU* p_PPU);
+
 // Static Function Prototypes - PPU State Machine //////////////////////////////////////////////////
 
 static void TOMBOY_TickHorizontalBlank (TOMBOY_PPU* p_PPU);
 static void TOMBOY_TickVerticalBlank (TOMBOY_PPU* p_PPU);
 static void TOMBOY_TickObjectScan (TOMBOY_PPU* p_PPU);
 static void TOMBOY_TickPixelTransfer (TOMBOY_PPU* p_PPU);
+static void TOMBOY_TickPPUDot (TOMBOY_PPU* p_PPU, bool p_ODMA);
 
 // Static Function Prototypes - Direct Memory Access (DMA) /////////////////////////////////////////
 
@@ -180,1021 +310,2138 @@ void TOMBOY_IncrementLY (TOMBOY_PPU* p_PPU)
 
 }
 
-// Static Functions - Object Scan //////////////////////////////////////////////////////////////////
+// Static Variables ////////////////////////////////////////////////////////////////////////////////
 
-void TOMBOY_ClearLineObjects (TOMBOY_PPU* p_PPU)
+static const TOMBOY_PPUKernels s_KernelSets[TOMBOY_PKS_COUNT] =
 {
-    p_PPU->m_LineObjectCount = 0;
-}
+    [TOMBOY_PKS_SCALAR] = { TOMBOY_DecodeTileScalar, TOMBOY_LookupColorsScalar },
+#if defined(TOMBOY_SIMD_SUPPORTED)
+    [TOMBOY_PKS_SSE2]   = { TOMBOY_DecodeTileSSE2, NULL },
+    [TOMBOY_PKS_BMI2]   = { TOMBOY_DecodeTileBMI2, NULL },
+    [TOMBOY_PKS_AVX2]   = { NULL, TOMBOY_LookupColorsAVX2 },
+#endif
+};
 
-void TOMBOY_FindLineObject (TOMBOY_PPU* p_PPU)
+// The kernels in use start out as the scalar ones, and are replaced before `main` runs, so they are
+// never written while the PPU may be using them.
+static TOMBOY_PPUKernels s_Kernels =
 {
+    .m_DecodeTile = TOMBOY_DecodeTileScalar,
+    .m_LookupColors = TOMBOY_LookupColorsScalar
+};
 
-    // There is a limit of 10 objects per scanline. Don't process more than 10 objects.
-    if (p_PPU->m_LineObjectCount >= 10)
-    {
-        return;
-    }
-
-    // Check the `LCDC` register for the current object height.
-    uint8_t l_ObjectHeight = (p_PPU->m_LCDC.m_ObjectSize == 1) ? 16 : 8;
-
-    // The index of the object to seek in the OAM buffer depends on the current scanline dot.
-    uint8_t l_ObjectIndex = (p_PPU->m_CurrentDot / 2) % TOMBOY_PPU_OBJECT_COUNT;
-
-    // Pointer to the object in the OAM buffer.
-    const TOMBOY_Object* l_Object = &p_PPU->m_OAM[l_ObjectIndex];
+// Static Functions - PPU Kernels //////////////////////////////////////////////////////////////////
 
-    // Check if the object is visible on the current scanline.
-    bool l_ObjectIsVisible =
-        l_Object->m_X > 0 &&
-        p_PPU->m_LY + 16 >= l_Object->m_Y &&
-        p_PPU->m_LY + 16 < l_Object->m_Y + l_ObjectHeight;
+void TOMBOY_DecodeTileScalar (const uint8_t* p_Data, TOMBOY_DecodedTile* p_Tile)
+{
 
-    // If the object is visible, add it to the list of objects on the current scanline.
-    if (l_ObjectIsVisible == true)
+    // Each row of a tile is stored in two bytes: the low bits of its pixels' color indices, then the
+    // high bits, with the leftmost pixel in bit 7 of each.
+    for (uint8_t y = 0; y < 8; ++y)
     {
-        p_PPU->m_LineObjectIndices[p_PPU->m_LineObjectCount++] = l_ObjectIndex;
-    }
+        uint8_t l_Low = p_Data[y * 2];
+        uint8_t l_High = p_Data[y * 2 + 1];
 
-    // If `GRPM` is set to zero (DMG mode), or if `OPRI` is non-zero (priority by X position), then
-    // the objects need to be sorted by their X position:
-    // - Objects with smaller X positions have higher priority.
-    // - Objects with the same X position are assigned priority based on their index in the OAM buffer.
-    if (p_PPU->m_GRPM == 0 || p_PPU->m_OPRI != 0)
-    {
-        // Sort the objects by their X position.
-        for (uint8_t i = 0; i < p_PPU->m_LineObjectCount; i++)
+        for (uint8_t x = 0; x < 8; ++x)
         {
-            for (uint8_t j = i + 1; j < p_PPU->m_LineObjectCount; j++)
-            {
-                // Get the objects to compare.
-                const TOMBOY_Object* l_ObjectA = &p_PPU->m_OAM[p_PPU->m_LineObjectIndices[i]];
-                const TOMBOY_Object* l_ObjectB = &p_PPU->m_OAM[p_PPU->m_LineObjectIndices[j]];
-
-                // Compare the X positions of the objects.
-                if (l_ObjectA->m_X > l_ObjectB->m_X)
-                {
-                    // Swap the object indices.
-                    uint8_t l_Temp = p_PPU->m_LineObjectIndices[i];
-                    p_PPU->m_LineObjectIndices[i] = p_PPU->m_LineObjectIndices[j];
-                    p_PPU->m_LineObjectIndices[j] = l_Temp;
-                }
-            }
+            uint8_t l_ColorIndex = (((l_High >> (7 - x)) & 1) << 1) | ((l_Low >> (7 - x)) & 1);
+            p_Tile->m_Rows[y][x] = l_ColorIndex;
+            p_Tile->m_FlippedRows[y][7 - x] = l_ColorIndex;
         }
     }
 
 }
 
-// Static Functions - Pixel Transfer ///////////////////////////////////////////////////////////////
-
-uint32_t TOMBOY_GetBackgroundColorInternal (TOMBOY_PPU* p_PPU, uint8_t p_PaletteIndex, uint8_t p_ColorIndex, TOMBOY_ColorRGB555* p_RGB555)
+void TOMBOY_LookupColorsScalar (const uint8_t* p_Row, const uint32_t* p_Palette, uint32_t* p_Colors)
 {
-    // Correct the palette index to be in the range of 0-7.
-    p_PaletteIndex &= 0b111;
+    for (uint8_t i = 0; i < 8; ++i)
+    {
+        p_Colors[i] = p_Palette[p_Row[i] & 0b11];
+    }
+}
 
-    // Correct the color index to be in the range of 0-3.
-    p_ColorIndex &= 0b11;
+#if defined(TOMBOY_SIMD_SUPPORTED)
 
-    // Determine the start index of the color in the CRAM buffer.
-    uint8_t l_StartIndex = (p_PaletteIndex * TOMBOY_PPU_PALETTE_COLOR_COUNT * 2) + (p_ColorIndex * 2);
+void TOMBOY_DecodeTileSSE2 (const uint8_t* p_Data, TOMBOY_DecodedTile* p_Tile)
+{
 
-    // Get the color data from the CRAM buffer.
-    uint8_t l_ColorData[2] = { p_PPU->m_BgCRAM[l_StartIndex], p_PPU->m_BgCRAM[l_StartIndex + 1] };
+    // Each lane of a vector holds one pixel of two rows, and tests that pixel's bit in its row's
+    // bytes. The masks run from bit 7 to bit 0 for the rows as stored, and the other way for the
+    // mirrored rows.
+    const __m128i l_Bits = _mm_set_epi8(
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char) 0x80,
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char) 0x80
+    );
+    const __m128i l_FlippedBits = _mm_set_epi8(
+        (char) 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+        (char) 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01
+    );
+    const __m128i l_Ones = _mm_set1_epi8(1);
 
-    // Extract the RGB555 color data. Remember that the color data is laid out as follows:
-    // `0bRRRRRGGG` `0bGGBBBBB0`
-    uint8_t l_Red   = (l_ColorData[0] & 0b11111000) >> 3;
-    uint8_t l_Green = ((l_ColorData[0] & 0b00000111) << 2) | ((l_ColorData[1] & 0b11000000) >> 6);
-    uint8_t l_Blue  = (l_ColorData[1] & 0b00111110) >> 1;
-    
-    // If a color structure was provided, store the color data in it.
-    if (p_RGB555 != NULL)
+    for (uint8_t y = 0; y < 8; y += 2)
     {
-        p_RGB555->m_Red   = l_Red;
-        p_RGB555->m_Green = l_Green;
-        p_RGB555->m_Blue  = l_Blue;
-    }
 
-    // Return the RGBA color value.
-    return (
-        ((l_Red * 8) << 24) |
-        ((l_Green * 8) << 16) |
-        ((l_Blue * 8) << 8) |
-        0xFF
-    );
-}
+        // Load the two rows' four bytes, `L0 H0 L1 H1`, and spread them out so that one vector holds
+        // `L0` eight times then `L1` eight times, and the other holds `H0` and `H1` the same way.
+        int32_t l_Bytes = 0;
+        memcpy(&l_Bytes, &p_Data[y * 2], sizeof(l_Bytes));
+        __m128i l_Spread = _mm_cvtsi32_si128(l_Bytes);
+        l_Spread = _mm_unpacklo_epi8(l_Spread, l_Spread);
+        l_Spread = _mm_unpacklo_epi16(l_Spread, l_Spread);
+        __m128i l_Row0 = _mm_unpacklo_epi32(l_Spread, l_Spread);
+        __m128i l_Row1 = _mm_unpackhi_epi32(l_Spread, l_Spread);
+        __m128i l_Low = _mm_unpacklo_epi64(l_Row0, l_Row1);
+        __m128i l_High = _mm_unpackhi_epi64(l_Row0, l_Row1);
 
-uint32_t TOMBOY_GetObjectColorInternal (TOMBOY_PPU* p_PPU, uint8_t p_PaletteIndex, uint8_t p_ColorIndex, TOMBOY_ColorRGB555* p_RGB555)
-{
-    // Correct the palette index to be in the range of 0-7.
-    p_PaletteIndex &= 0b111;
+        // A lane's bit is set when the byte, masked by its lane's bit, still equals that bit. The
+        // comparisons give all ones for set bits, which are then narrowed to the color index bits.
+        __m128i l_Rows = _mm_or_si128(
+            _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(l_Low, l_Bits), l_Bits), l_Ones),
+            _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(l_High, l_Bits), l_Bits), _mm_add_epi8(l_Ones, l_Ones))
+        );
+        __m128i l_FlippedRows = _mm_or_si128(
+            _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(l_Low, l_FlippedBits), l_FlippedBits), l_Ones),
+            _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(l_High, l_FlippedBits), l_FlippedBits), _mm_add_epi8(l_Ones, l_Ones))
+        );
 
-    // Correct the color index to be in the range of 0-3.
-    p_ColorIndex &= 0b11;
+        // The tile's rows are stored back to back, so both rows are stored at once.
+        _mm_storeu_si128((__m128i*) p_Tile->m_Rows[y], l_Rows);
+        _mm_storeu_si128((__m128i*) p_Tile->m_FlippedRows[y], l_FlippedRows);
 
-    // Determine the start index of the color in the CRAM buffer.
-    uint8_t l_StartIndex = (p_PaletteIndex * TOMBOY_PPU_PALETTE_COLOR_COUNT * 2) + (p_ColorIndex * 2);
+    }
 
-    // Get the color data from the CRAM buffer.
-    uint8_t l_ColorData[2] = { p_PPU->m_ObjCRAM[l_StartIndex], p_PPU->m_ObjCRAM[l_StartIndex + 1] };
+}
 
-    // Extract the RGB555 color data. Remember that the color data is laid out as follows:
-    // `0bRRRRRGGG` `0bGGBBBBB0`
-    uint8_t l_Red   = (l_ColorData[0] & 0b11111000) >> 3;
-    uint8_t l_Green = ((l_ColorData[0] & 0b00000111) << 2) | ((l_ColorData[1] & 0b11000000) >> 6);
-    uint8_t l_Blue  = (l_ColorData[1] & 0b00111110) >> 1;
+__attribute__((target("bmi2")))
+void TOMBOY_DecodeTileBMI2 (const uint8_t* p_Data, TOMBOY_DecodedTile* p_Tile)
+{
 
-    // If a color structure was provided, store the color data in it.
-    if (p_RGB555 != NULL)
+    // Depositing a row's low and high bytes into bit 0 and bit 1 of each byte of a 64-bit word puts
+    // the pixel in bit `N` into byte `N`. Stored little-endian, that is the row mirrored, with its
+    // rightmost pixel first. Swapping the word's bytes gives the row as stored.
+    for (uint8_t y = 0; y < 8; ++y)
     {
-        p_RGB555->m_Red   = l_Red;
-        p_RGB555->m_Green = l_Green;
-        p_RGB555->m_Blue  = l_Blue;
+        uint64_t l_FlippedRow =
+            _pdep_u64(p_Data[y * 2], 0x0101010101010101) |
+            _pdep_u64(p_Data[y * 2 + 1], 0x0202020202020202);
+        uint64_t l_Row = __builtin_bswap64(l_FlippedRow);
+
+        memcpy(p_Tile->m_Rows[y], &l_Row, sizeof(l_Row));
+        memcpy(p_Tile->m_FlippedRows[y], &l_FlippedRow, sizeof(l_FlippedRow));
     }
 
-    // Return the RGBA color value.
-    return (
-        ((l_Red * 8) << 24) |
-        ((l_Green * 8) << 16) |
-        ((l_Blue * 8) << 8) |
-        0xFF
-    );
 }
 
-void TOMBOY_PushColor (TOMBOY_PixelFetcher* p_Fetcher, uint32_t p_Color)
+__attribute__((target("avx2")))
+void TOMBOY_LookupColorsAVX2 (const uint8_t* p_Row, const uint32_t* p_Palette, uint32_t* p_Colors)
 {
-    p_Fetcher->m_PixelFIFO.m_Buffer[p_Fetcher->m_PixelFIFO.m_Tail] = p_Color;
-    p_Fetcher->m_PixelFIFO.m_Tail = (p_Fetcher->m_PixelFIFO.m_Tail + 1) % TOMBOY_PPU_FIFO_SIZE;
-    p_Fetcher->m_PixelFIFO.m_Size++;
+
+    // The palette's four colors fill the low half of a vector, and the 8 color indices, widened to
+    // 32 bits, select a color from it for each lane. The indices never exceed 3, so the vector's
+    // upper half is never selected.
+    __m256i l_Palette = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) p_Palette));
+    __m256i l_Indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) p_Row));
+    _mm256_storeu_si256((__m256i*) p_Colors, _mm256_permutevar8x32_epi32(l_Palette, l_Indices));
+
 }
 
-void TOMBOY_PopColor (TOMBOY_PixelFetcher* p_Fetcher, uint32_t* p_Color)
+#endif
+
+bool TOMBOY_IsKernelSetSupported (TOMBOY_PPUKernelSet p_Set)
 {
-    *p_Color = p_Fetcher->m_PixelFIFO.m_Buffer[p_Fetcher->m_PixelFIFO.m_Head];
-    p_Fetcher->m_PixelFIFO.m_Head = (p_Fetcher->m_PixelFIFO.m_Head + 1) % TOMBOY_PPU_FIFO_SIZE;
-    p_Fetcher->m_PixelFIFO.m_Size--;
+    // Every x86-64 processor supports SSE2. The CPU's features are looked up here, rather than
+    // relied upon having been already, as this is called from a constructor.
+    switch (p_Set)
+    {
+        case TOMBOY_PKS_SCALAR: return true;
+    #if defined(TOMBOY_SIMD_SUPPORTED)
+        case TOMBOY_PKS_SSE2:   return true;
+        case TOMBOY_PKS_BMI2:   __builtin_cpu_init(); return __builtin_cpu_supports("bmi2");
+        case TOMBOY_PKS_AVX2:   __builtin_cpu_init(); return __builtin_cpu_supports("avx2");
+    #endif
+        default:                return false;
+    }
 }
 
-bool TOMBOY_TryAddPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
-{
+#if defined(TOMBOY_SIMD_SUPPORTED)
 
-    // The pixel fetcher's FIFO is considered full if it contains more than 8 pixels, enough pixels
-    // to render the current line of the current tile.
-    if (p_Fetcher->m_PixelFIFO.m_Size > 8)
+void TOMBOY_SelectKernels (void)
+{
+    // The later sets use fewer instructions, so each supported set replaces the kernels it provides.
+    for (uint8_t i = TOMBOY_PKS_SCALAR + 1; i < TOMBOY_PKS_COUNT; ++i)
     {
-        return false;
+        if (TOMBOY_IsKernelSetSupported(i) == false)
+        {
+            continue;
+        }
+
+        if (s_KernelSets[i].m_DecodeTile != NULL)
+        {
+            s_Kernels.m_DecodeTile = s_KernelSets[i].m_DecodeTile;
+        }
+
+        if (s_KernelSets[i].m_LookupColors != NULL)
+        {
+            s_Kernels.m_LookupColors = s_KernelSets[i].m_LookupColors;
+        }
     }
+}
 
-    // Get the fetched tile's attributes.
-    TOMBOY_TileAttributes l_TileAttributes = p_Fetcher->m_FetchedBGW.m_TileAttributes;
+#endif
 
-    // Offset the pixel fetcher's X-coordinate by the scroll X register. Ensure that the resultant
-    // X-coordinate is within the screen's bounds.
-    int32_t l_OffsetX = p_Fetcher->m_FetchingX - (8 - (p_PPU->m_SCX % 8));
-    if (l_OffsetX < 0) { return true; }
+void TOMBOY_MarkScanlineDirty (TOMBOY_PPU* p_PPU, uint8_t p_Line)
+{
+    p_PPU->m_DirtyLines[p_Line / 64] |= (uint64_t) 1 << (p_Line % 64);
+}
 
-    // Iterate over the eight pixels which need to be shifted into the pixel FIFO.
-    for (uint8_t i = 0; i < 8; ++i)
+bool TOMBOY_StorePixel (TOMBOY_PPU* p_PPU, uint32_t p_Index, uint32_t p_Color)
+{
+    // Write the pixel at its width in the pixel format, reporting whether it changed.
+    switch (p_PPU->m_PixelSize)
     {
+        case 4:
+        {
+            uint32_t* l_Pixel = &((uint32_t*) p_PPU->m_ScreenBuffer)[p_Index];
+            if (*l_Pixel == p_Color) { return false; }
+            *l_Pixel = p_Color;
+        } break;
 
-        // Which bit of the tile data high and low bytes need to be added?
-        uint8_t l_Bit = (l_TileAttributes.m_HorizontalFlip == 0) ? 7 - i : i;
+        case 2:
+        {
+            uint16_t* l_Pixel = &((uint16_t*) p_PPU->m_ScreenBuffer)[p_Index];
+            if (*l_Pixel == (uint16_t) p_Color) { return false; }
+            *l_Pixel = (uint16_t) p_Color;
+        } break;
 
-        // Grab the proper bit from the tile data low and high bytes.
-        uint8_t l_LowBit = (p_Fetcher->m_FetchedBGW.m_TileDataLow >> l_Bit) & 1;
-        uint8_t l_HighBit = (p_Fetcher->m_FetchedBGW.m_TileDataHigh >> l_Bit) & 1;
+        default:
+        {
+            uint8_t* l_Pixel = &p_PPU->m_ScreenBuffer[p_Index];
+            if (*l_Pixel == (uint8_t) p_Color) { return false; }
+            *l_Pixel = (uint8_t) p_Color;
+        } break;
+    }
 
-        // Calculate the color index of the pixel.
-        uint8_t l_ColorIndex = (l_HighBit << 1) | l_LowBit;
+    return true;
+}
 
-        // If the `GRPM` register is set to 1, then the PPU is in CGB graphics mode. Retrieve the
-        // color from the background color RAM.
-        uint32_t l_RGBAColorValue = 0;
-        if (p_PPU->m_GRPM != 0)
+const uint8_t* TOMBOY_PackPixels (const TOMBOY_PPU* p_PPU, const uint32_t* p_Colors, uint8_t* p_Buffer)
+{
+    // The colors are already in the pixel format. The 32-bit formats need only be copied as they
+    // are; the narrower ones are packed into the buffer at their width.
+    if (p_PPU->m_PixelSize == 4)
+    {
+        return (const uint8_t*) p_Colors;
+    }
+    else if (p_PPU->m_PixelSize == 2)
+    {
+        uint16_t* l_Pixels = (uint16_t*) p_Buffer;
+        for (uint8_t i = 0; i < 8; ++i)
         {
-            l_RGBAColorValue = TOMBOY_GetBackgroundColorInternal(
-                p_PPU,
-                l_TileAttributes.m_PaletteIndex,
-                l_ColorIndex,
-                NULL
-            );
+            l_Pixels[i] = (uint16_t) p_Colors[i];
         }
-        
-        // If the `GRPM` register is set to 0, then the PPU is in DMG graphics mode. The color
-        // should not be fetched if `LCDC` bit 0 is clear.
-        else if (p_PPU->m_LCDC.m_BGWEnableOrPriority == true)
+    }
+    else
+    {
+        for (uint8_t i = 0; i < 8; ++i)
         {
-            // Get the proper two bits from the `BGP` register.
-            uint8_t l_BitPair = (p_PPU->m_BGP >> (l_ColorIndex * 2)) & 0b11;
-
-            // Get the RGBA color value from the DMG palette.
-            l_RGBAColorValue = TOMBOY_PPU_DMG_PALETTE[l_BitPair];
+            p_Buffer[i] = (uint8_t) p_Colors[i];
         }
+    }
 
-        // Otherwise, this is DMG mode where the background/window layer is disabled. The pixel is
-        // transparent.
-        else
+    return p_Buffer;
+}
+
+void TOMBOY_PublishFrame (TOMBOY_PPU* p_PPU)
+{
+    // A frame which changed nothing is not handed off again.
+    uint64_t l_Changed = 0;
+    for (uint8_t i = 0; i < TOMBOY_PPU_DIRTY_LINE_WORDS; ++i)
+    {
+        l_Changed |= p_PPU->m_DirtyLines[i];
+    }
+
+    if (l_Changed == 0)
+    {
+        return;
+    }
+
+    // The scanlines this frame changed are now out of date in every other screen buffer.
+    uint8_t l_Published = p_PPU->m_BackBuffer;
+    for (uint8_t i = 0; i < TOMBOY_PPU_FRAME_BUFFER_COUNT; ++i)
+    {
+        if (i == l_Published) { continue; }
+        for (uint8_t j = 0; j < TOMBOY_PPU_DIRTY_LINE_WORDS; ++j)
         {
-            l_RGBAColorValue = TOMBOY_PPU_DMG_PALETTE[0];
+            p_PPU->m_StaleLines[i][j] |= p_PPU->m_DirtyLines[j];
         }
+    }
 
-        // If the object layer is enabled, and there is at least one object residing on this pixel,
-        // then fetch the object pixel's color.
-        if (p_PPU->m_LCDC.m_ObjectEnable == true)
+    // Swap the finished frame in as the pending one. The buffer it replaces held either an older
+    // frame which was never acquired, or the frame the render thread has just let go of.
+    uint8_t l_Back = atomic_exchange_explicit(&p_PPU->m_PendingBuffer,
+        l_Published | TOMBOY_PPU_FRESH_FRAME, memory_order_acq_rel) & ~TOMBOY_PPU_FRESH_FRAME;
+
+    // Bring the scanlines of that buffer which are out of date in line with the finished frame, so
+    // the next frame is drawn over it just as it would be over a single screen buffer.
+    const uint8_t* l_Source = (const uint8_t*) p_PPU->m_ScreenBuffers[l_Published];
+    uint8_t* l_Destination = (uint8_t*) p_PPU->m_ScreenBuffers[l_Back];
+    for (uint8_t l_Line = 0; l_Line < TOMBOY_PPU_SCREEN_HEIGHT; ++l_Line)
+    {
+        if (p_PPU->m_StaleLines[l_Back][l_Line / 64] & ((uint64_t) 1 << (l_Line % 64)))
         {
-            l_RGBAColorValue = TOMBOY_FetchObjectPixel(
-                p_PPU,
-                p_Fetcher,
-                l_Bit,
-                l_ColorIndex,
-                l_RGBAColorValue,
-                p_PPU->m_LCDC.m_BGWEnableOrPriority
-            );
+            memcpy(&l_Destination[l_Line * p_PPU->m_ScreenPitch],
+                &l_Source[l_Line * p_PPU->m_ScreenPitch], p_PPU->m_ScreenPitch);
         }
+    }
 
-        // Shift the pixel into the pixel FIFO.
-        TOMBOY_PushColor(p_Fetcher, l_RGBAColorValue);
-        p_Fetcher->m_QueueX++;
+    memset(p_PPU->m_StaleLines[l_Back], 0, sizeof(p_PPU->m_StaleLines[l_Back]));
+    p_PPU->m_BackBuffer = l_Back;
+    p_PPU->m_ScreenBuffer = l_Destination;
+}
 
+void TOMBOY_DeliverFrame (TOMBOY_PPU* p_PPU)
+{
+    // Hand the frame off to the render thread, if the PPU does so.
+    if (p_PPU->m_FrameHandoff == true)
+    {
+        TOMBOY_PublishFrame(p_PPU);
     }
 
-    return true;
+    // Call the frame rendered callback, if it is set. The scanlines changed by the next frame are
+    // noted afresh from here.
+    if (p_PPU->m_OnFrameRendered != NULL)
+    {
+        p_PPU->m_OnFrameRendered(p_PPU);
+    }
 
+    memset(p_PPU->m_DirtyLines, 0, sizeof(p_PPU->m_DirtyLines));
 }
 
-void TOMBOY_ShiftNextPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+// Static Functions - Decoded Tile Cache ///////////////////////////////////////////////////////////
+
+uint8_t TOMBOY_GetVRAMBankIndex (const TOMBOY_PPU* p_PPU)
 {
+    return (p_PPU->m_VRAM == p_PPU->m_VRAM1) ? 1 : 0;
+}
 
-    // Only shift a pixel from the FIFO if it's full.
-    if (p_Fetcher->m_PixelFIFO.m_Size > 8)
-    {
+void TOMBOY_DecodeTile (TOMBOY_PPU* p_PPU, uint8_t p_Bank, uint16_t p_Tile)
+{
+    const uint8_t* l_Data = ((p_Bank == 0) ? p_PPU->m_VRAM0 : p_PPU->m_VRAM1) + (p_Tile * 16);
+    s_Kernels.m_DecodeTile(l_Data, &p_PPU->m_TileCache[p_Bank][p_Tile]);
+    p_PPU->m_TileCacheValid[p_Bank][p_Tile] = true;
 
-        // Pop the pixel's color from the FIFO.
-        uint32_t l_RGBAColorValue = 0;
-        TOMBOY_PopColor(p_Fetcher, &l_RGBAColorValue);
+}
 
-        // Ensure that the pixel is within the bounds of the screen buffer.
-        if (p_Fetcher->m_LineX >= (p_PPU->m_SCX % 8))
-        {
+const uint8_t* TOMBOY_GetDecodedTileRow (TOMBOY_PPU* p_PPU, uint16_t p_Address, bool p_Flip)
+{
 
-            // Determine the index of the pixel in the screen buffer.
-            uint32_t l_ScreenIndex = p_Fetcher->m_PushedX + (p_PPU->m_LY * TOMBOY_PPU_SCREEN_WIDTH);
+    // The address given is that of either byte of the row, relative to the start of the currently
+    // selected VRAM bank. Decode its tile first, if it has changed since it was last decoded.
+    uint8_t l_Bank = TOMBOY_GetVRAMBankIndex(p_PPU);
+    uint16_t l_Tile = p_Address / 16;
+    if (p_PPU->m_TileCacheValid[l_Bank][l_Tile] == false)
+    {
+        TOMBOY_DecodeTile(p_PPU, l_Bank, l_Tile);
+    }
 
-            // Emplace the pixel into the screen buffer. Advance the fetcher's pushed X-coordinate.
-            p_PPU->m_ScreenBuffer[l_ScreenIndex] = l_RGBAColorValue;
-            p_Fetcher->m_PushedX++;
+    uint8_t l_Row = (p_Address % 16) / 2;
+    return (p_Flip == true) ?
+        p_PPU->m_TileCache[l_Bank][l_Tile].m_FlippedRows[l_Row] :
+        p_PPU->m_TileCache[l_Bank][l_Tile].m_Rows[l_Row];
 
-        }
+}
 
-        // Move the fetcher's X-coordinate to the next pixel.
-        p_Fetcher->m_LineX++;
+const uint8_t* TOMBOY_GetFetchedTileRow (TOMBOY_PPU* p_PPU, uint16_t p_Address, uint8_t p_Low, bool p_Flip, uint8_t* p_Buffer)
+{
+
+    // The address given is that of the row's high byte, just fetched. The cached row is decoded from
+    // the row's bytes as they are now, which is right unless the low byte, fetched a step earlier,
+    // has changed since.
+    if (p_PPU->m_VRAM[p_Address - 1] == p_Low)
+    {
+        return TOMBOY_GetDecodedTileRow(p_PPU, p_Address, p_Flip);
+    }
 
+    // Otherwise, decode the row from the bytes as they were fetched.
+    uint8_t l_High = p_PPU->m_VRAM[p_Address];
+    for (uint8_t x = 0; x < 8; ++x)
+    {
+        uint8_t l_ColorIndex = (((l_High >> (7 - x)) & 1) << 1) | ((p_Low >> (7 - x)) & 1);
+        p_Buffer[(p_Flip == true) ? 7 - x : x] = l_ColorIndex;
     }
 
+    return p_Buffer;
+
 }
 
-uint32_t TOMBOY_FetchObjectPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher, uint8_t p_Bit, uint8_t p_ColorIndex, uint32_t p_RGBAColorValue, uint8_t p_BGWindowPriority)
+// Static Functions - Palette Caches //////////////////////////////////////////////////////////////
+
+uint32_t TOMBOY_EncodeColor (const TOMBOY_PPU* p_PPU, uint32_t p_RGBA, uint8_t p_Index)
 {
 
-    // The `p_ColorIndex` parameter contains the index of the color used to render a background-
-    // or window-layer tile over which one or more of the objects fetched by the pixel fetcher may
-    // be residing.
-    //
-    // Store that old color index here, as we may need to restore it later.
-    uint8_t l_OldColorIndex = p_ColorIndex;
+    // Break the RGBA color down into its channels.
+    uint32_t l_Red   = (p_RGBA >> 24) & 0xFF;
+    uint32_t l_Green = (p_RGBA >> 16) & 0xFF;
+    uint32_t l_Blue  = (p_RGBA >> 8) & 0xFF;
+    uint32_t l_Alpha = p_RGBA & 0xFF;
 
-    // Iterate over the indices of the objects fetched by the pixel fetcher as it was processing the
-    // current pixel.
-    for (uint8_t i = 0; i < p_Fetcher->m_FetchedOBJ.m_ObjectCount; ++i)
+    // Put the channels back together in the pixel format. The indexed format uses the color's index
+    // in its palette instead.
+    switch (p_PPU->m_PixelFormat)
     {
+        case TOMBOY_PF_ARGB8888:
+            return (l_Alpha << 24) | (l_Red << 16) | (l_Green << 8) | l_Blue;
+        case TOMBOY_PF_BGRA8888:
+            return (l_Blue << 24) | (l_Green << 16) | (l_Red << 8) | l_Alpha;
+        case TOMBOY_PF_RGB565:
+            return ((l_Red >> 3) << 11) | ((l_Green >> 2) << 5) | (l_Blue >> 3);
+        case TOMBOY_PF_INDEXED8:
+            return p_Index;
+        default:
+            return p_RGBA;
+    }
 
-        // Point to the object in the OAM buffer.
-        const TOMBOY_Object* l_Object = &p_PPU->m_OAM[p_Fetcher->m_FetchedOBJ.m_ObjectIndices[i]];
+}
 
-        // Calculate the X-coordinate of the object's left edge on the screen.
-        // Ensure the object is within the bounds of the screen.
-        uint8_t l_ObjectX = (l_Object->m_X - 8) + (p_PPU->m_SCX % 8);
-        if (l_ObjectX + 8 < p_Fetcher->m_QueueX)
-        {
-            continue;
-        }
+void TOMBOY_UpdateCRAMColor (TOMBOY_PPU* p_PPU, bool p_Object, uint8_t p_ByteIndex)
+{
 
-        // Calculate the offset of the current pixel within the object's tile data.
-        // Ensure the offset is within the bounds of the tile data.
-        int8_t l_Offset = p_Fetcher->m_QueueX - l_ObjectX;
-        if (l_Offset < 0 || l_Offset >= 8)
-        {
-            continue;
-        }
+    // Each color takes up two bytes of its CRAM buffer. Convert the color the written byte belongs
+    // to afresh.
+    uint8_t l_PaletteIndex = (p_ByteIndex / 2) / TOMBOY_PPU_PALETTE_COLOR_COUNT;
+    uint8_t l_ColorIndex = (p_ByteIndex / 2) % TOMBOY_PPU_PALETTE_COLOR_COUNT;
 
-        // Correct the provided `p_Bit` parameter to account for the object's X-flip attribute.
-        p_Bit = (l_Object->m_Attributes.m_HorizontalFlip == 0) ? 7 - l_Offset : l_Offset;
+    uint32_t l_RGBA = (p_Object == true) ?
+        TOMBOY_GetObjectColorInternal(p_PPU, l_PaletteIndex, l_ColorIndex, NULL) :
+        TOMBOY_GetBackgroundColorInternal(p_PPU, l_PaletteIndex, l_ColorIndex, NULL);
+    uint8_t l_Index = ((p_Object == true) ? TOMBOY_PPU_INDEXED_OBJ_START : 0) + (p_ByteIndex / 2);
 
-        // Get the proper bit of the object's tile data low and high bytes.
-        uint8_t l_LowBit = (p_Fetcher->m_FetchedOBJ.m_TileDataLow[i] >> p_Bit) & 1;
-        uint8_t l_HighBit = (p_Fetcher->m_FetchedOBJ.m_TileDataHigh[i] >> p_Bit) & 1;
+    p_PPU->m_CRAMColors[p_Object][l_PaletteIndex][l_ColorIndex] =
+        TOMBOY_EncodeColor(p_PPU, l_RGBA, l_Index);
 
-        // Calculate the color index of the pixel.
-        uint8_t l_ColorIndex = (l_HighBit << 1) | l_LowBit;
+}
 
-        // If the color index is zero, then the pixel is transparent and does not overwrite the
-        // background or window layer.
-        if (l_ColorIndex == 0)
-        {
-            continue;
-        }
-        
-        // Check if one of the following conditions is met:
-        // - The old color index is zero.
-        // - The object's BGW priority attribute is zero.
-        // - The provided `p_BGWindowPriority` parameter is zero.
-        if (
-            l_OldColorIndex == 0 ||
-            l_Object->m_Attributes.m_Priority == 0 ||
-            (
-                p_BGWindowPriority == 0 &&
-                l_Object->m_Attributes.m_Priority == 0
-            )
-        )
-        {
-            // Is the graphics mode set to CGB mode?
-            if (p_PPU->m_GRPM == 1)
-            {
-                p_RGBAColorValue = TOMBOY_GetObjectColorInternal(
-                    p_PPU,
-                    l_Object->m_Attributes.m_PaletteIndex,
-                    l_ColorIndex,
-                    NULL
-                );
-            }
-
-            // Otherwise, the graphics mode is set to DMG mode.
-            else
-            {
-                // Get the proper two bits from the `OBP0` or `OBP1` register.
-                uint8_t l_BitPair = (l_Object->m_Attributes.m_DMGPalette == 0) ?
-                    (p_PPU->m_OBP0 >> (l_ColorIndex * 2)) & 0b11 :
-                    (p_PPU->m_OBP1 >> (l_ColorIndex * 2)) & 0b11;
-
-                // Get the RGBA color value from the DMG palette.
-                p_RGBAColorValue = TOMBOY_PPU_DMG_PALETTE[l_BitPair];
-            }
-
-            if (p_ColorIndex > 0) { break; }
-        }
-
-    }
-
-    // Return the RGBA color value of the pixel.
-    return p_RGBAColorValue;
-
-}
-
-void TOMBOY_FetchBackgroundTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+void TOMBOY_UpdateDMGColors (TOMBOY_PPU* p_PPU, uint8_t p_Palette, uint8_t p_Value)
 {
 
-    // Determine the relative starting address of the tile map used to render the background layer.
-    uint16_t l_TileMapAddress = (p_PPU->m_LCDC.m_BGTilemapAddress == 0) ? 0x1800 : 0x1C00;
-
-    // Determine the source Y position of the tile.
-    uint8_t l_TileY = p_Fetcher->m_MapY / 8;
-
-    // Use the pixel fetcher's map coordinates to determine the target address offset.
-    uint16_t l_TargetOffset = (l_TileY * 32) + (p_Fetcher->m_MapX / 8);
-    uint16_t l_TargetAddress = l_TileMapAddress + l_TargetOffset;
+    // Each two bits of the palette register select the DMG palette color for one color index.
+    for (uint8_t i = 0; i < TOMBOY_PPU_PALETTE_COLOR_COUNT; ++i)
+    {
+        uint8_t l_Shade = (p_Value >> (i * 2)) & 0b11;
+        p_PPU->m_DMGColors[p_Palette][i] = TOMBOY_EncodeColor(p_PPU, TOMBOY_PPU_DMG_PALETTE[l_Shade],
+            TOMBOY_PPU_INDEXED_DMG_START + l_Shade);
+    }
 
-    // Fetch the tile number and attributes from VRAM banks 0 and 1, respectively.
-    p_Fetcher->m_FetchedBGW.m_TileIndex = p_PPU->m_VRAM0[l_TargetAddress];
-    p_Fetcher->m_FetchedBGW.m_TileAttributes.m_Value = p_PPU->m_VRAM1[l_TargetAddress];
 }
 
-void TOMBOY_FetchWindowTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+void TOMBOY_FillPaletteCaches (TOMBOY_PPU* p_PPU)
 {
 
-    // Only fetch a window tile number if the following conditions are met:
-    // - The window layer is currently enabled and visible.
-    // - The fetcher's next X coordinate is within the bounds of the window layer.
-    // - The `LY` register is within the bounds of the window layer.
-    if (
-        TOMBOY_IsWindowVisible(p_PPU) == true &&
-        p_Fetcher->m_FetchingX + 7 >= p_PPU->m_WX &&
-        p_Fetcher->m_FetchingX + 7 < (p_PPU->m_WX + TOMBOY_PPU_SCREEN_HEIGHT + 14) &&
-        p_PPU->m_LY >= p_PPU->m_WY &&
-        p_PPU->m_LY < p_PPU->m_WY + TOMBOY_PPU_SCREEN_WIDTH
-    )
+    // Fill the palette caches from the Color RAM buffers and DMG palette registers.
+    for (uint8_t i = 0; i < TOMBOY_PPU_CRAM_SIZE; i += 2)
     {
+        TOMBOY_UpdateCRAMColor(p_PPU, false, i);
+        TOMBOY_UpdateCRAMColor(p_PPU, true, i);
+    }
 
-        // Determine the relative starting address of the tile map used to render the window layer.
-        uint16_t l_TileMapAddress = (p_PPU->m_LCDC.m_WindowTilemapAddress == 0) ? 0x1800 : 0x1C00;
-
-        // Determine the source Y position of the tile.
-        uint8_t l_TileY = p_PPU->m_WindowLine / 8;
+    TOMBOY_UpdateDMGColors(p_PPU, 0, p_PPU->m_BGP);
+    TOMBOY_UpdateDMGColors(p_PPU, 1, p_PPU->m_OBP0);
+    TOMBOY_UpdateDMGColors(p_PPU, 2, p_PPU->m_OBP1);
 
-        // Use the pixel fetcher's map coordinates to determine the target address offset.
-        uint16_t l_TargetOffset = (l_TileY * 32) + ((p_Fetcher->m_FetchingX + 7 - p_PPU->m_WX) / 8);
-        uint16_t l_TargetAddress = l_TileMapAddress + l_TargetOffset;
-        
-        // Fetch the tile number and attributes from VRAM banks 0 and 1, respectively.
-        p_Fetcher->m_FetchedBGW.m_TileIndex = p_PPU->m_VRAM0[l_TargetAddress];
-        p_Fetcher->m_FetchedBGW.m_TileAttributes.m_Value = p_PPU->m_VRAM1[l_TargetAddress];
+    // The blank palette's colors are all the lightest DMG shade.
+    for (uint8_t i = 0; i < TOMBOY_PPU_PALETTE_COLOR_COUNT; ++i)
+    {
+        p_PPU->m_BlankColors[i] = TOMBOY_EncodeColor(p_PPU, TOMBOY_PPU_DMG_PALETTE[0],
+            TOMBOY_PPU_INDEXED_DMG_START);
     }
 
 }
 
-void TOMBOY_FetchObjectTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+// Static Functions - Object Scan //////////////////////////////////////////////////////////////////
+
+void TOMBOY_ClearLineObjects (TOMBOY_PPU* p_PPU)
 {
-    // Iterate over the indices of the objects found on the current scanline.
-    for (uint8_t i = 0; i < p_PPU->m_LineObjectCount; ++i)
-    {
+    p_PPU->m_LineObjectCount = 0;
+}
 
-        // Point to the object in the OAM buffer.
-        const TOMBOY_Object* l_Object = &p_PPU->m_OAM[p_PPU->m_LineObjectIndices[i]];
+void TOMBOY_BucketObject (TOMBOY_PPU* p_PPU, uint8_t p_Index, bool p_Add)
+{
 
-        // Calculate the object's scrolling-adjusted X-coordinate.
-        int16_t l_ObjectX = (l_Object->m_X - 8) + (p_PPU->m_SCX % 8);
+    // Objects with an X position of 0 are never found by the object scan.
+    const TOMBOY_Object* l_Object = &p_PPU->m_OAM[p_Index];
+    if (l_Object->m_X == 0)
+    {
+        return;
+    }
 
-        // Ensure that the object's tile data will fit into the pixel fetcher's FIFO.
-        if (
-            (l_ObjectX >= p_Fetcher->m_FetchingX && l_ObjectX < p_Fetcher->m_FetchingX + 8) ||
-            (l_ObjectX + 8 >= p_Fetcher->m_FetchingX && l_ObjectX + 8 < p_Fetcher->m_FetchingX + 8)
-        )
+    // An object resides on scanline `LY` if `Y <= LY + 16 < Y + height`. Add it to, or remove it
+    // from, the masks of those scanlines, for both object heights.
+    uint64_t l_Bit = (uint64_t) 1 << p_Index;
+    for (uint8_t l_Size = 0; l_Size < 2; ++l_Size)
+    {
+        uint8_t l_ObjectHeight = (l_Size == 1) ? 16 : 8;
+        for (uint8_t l_Row = 0; l_Row < l_ObjectHeight; ++l_Row)
         {
-
-            // If it does, then add the object's index to the list of objects whose tile data needs
-            // to be fetched.
-            p_Fetcher->m_FetchedOBJ.m_ObjectIndices[p_Fetcher->m_FetchedOBJ.m_ObjectCount++] = 
-                p_PPU->m_LineObjectIndices[i];
-
-            // Limit 3 objects per pixel.
-            if (p_Fetcher->m_FetchedOBJ.m_ObjectCount >= 3)
+            int16_t l_Line = l_Object->m_Y + l_Row - 16;
+            if (l_Line < 0 || l_Line >= TOMBOY_PPU_SCREEN_HEIGHT)
             {
-                break;
+                continue;
             }
 
+            if (p_Add == true)
+            {
+                p_PPU->m_ObjectLineMasks[l_Size][l_Line] |= l_Bit;
+            }
+            else
+            {
+                p_PPU->m_ObjectLineMasks[l_Size][l_Line] &= ~l_Bit;
+            }
         }
-
     }
+
 }
 
-void TOMBOY_FetchObjectTileData (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher, uint8_t p_Offset)
+void TOMBOY_SortObjectByX (TOMBOY_PPU* p_PPU, uint8_t p_Index)
 {
 
-    // Determine the current object size.
-    uint8_t l_ObjectHeight = (p_PPU->m_LCDC.m_ObjectSize == 1) ? 16 : 8;
-
-    // Iterate over the indices of the objects found on this pixel, whose tile data needs to be fetched.
-    for (uint8_t i = 0; i < p_Fetcher->m_FetchedOBJ.m_ObjectCount; ++i)
+    // Take the object out of the X priority order...
+    uint8_t l_Position = 0;
+    while (p_PPU->m_ObjectsByX[l_Position] != p_Index)
     {
+        l_Position++;
+    }
 
-        // Point to the object in the OAM buffer.
-        const TOMBOY_Object* l_Object = &p_PPU->m_OAM[p_Fetcher->m_FetchedOBJ.m_ObjectIndices[i]];
+    for (; l_Position + 1 < TOMBOY_PPU_OBJECT_COUNT; ++l_Position)
+    {
+        p_PPU->m_ObjectsByX[l_Position] = p_PPU->m_ObjectsByX[l_Position + 1];
+    }
 
-        // Get the object's Y position on the screen. Adjust the position according to the object's
-        // Y-flip attribute.
-        uint8_t l_ObjectY = ((p_PPU->m_LY + 16) - l_Object->m_Y) * 2;
-        if (l_Object->m_Attributes.m_VerticalFlip == 1)
+    // ...then insert it back in, after the objects with smaller X positions, and those with the same
+    // X position but a lower index.
+    uint8_t l_X = p_PPU->m_OAM[p_Index].m_X;
+    l_Position = TOMBOY_PPU_OBJECT_COUNT - 1;
+    while (l_Position > 0)
+    {
+        uint8_t l_Other = p_PPU->m_ObjectsByX[l_Position - 1];
+        if (p_PPU->m_OAM[l_Other].m_X < l_X ||
+            (p_PPU->m_OAM[l_Other].m_X == l_X && l_Other < p_Index))
         {
-            l_ObjectY = ((l_ObjectHeight * 2) - 2) - l_ObjectY;
+            break;
         }
 
-        // Get the object's tile index, with its low bit cleared if tall objects (8x16) are being used.
-        uint8_t l_TileIndex = l_Object->m_TileIndex & ((l_ObjectHeight == 16) ? 0xFE : 0xFF);
-
-        // Calculate the target address of the object's tile data.
-        uint16_t l_TargetAddress = (l_TileIndex * 16) + (l_ObjectY + p_Offset);
-
-        // Fetch the proper tile data (low if `p_Offset` is 0, high if `p_Offset` is non-zero).
-        // The above-calculated address is relative to the start of the VRAM bank, so permission to
-        // access the VRAM bank will be checked for.
-        if (p_Offset == 0)
-        {
-            p_Fetcher->m_FetchedOBJ.m_TileDataLow[i] = p_PPU->m_VRAM[l_TargetAddress];
-        }
-        else
-        {
-            p_Fetcher->m_FetchedOBJ.m_TileDataHigh[i] = p_PPU->m_VRAM[l_TargetAddress];
-        }
-        
+        p_PPU->m_ObjectsByX[l_Position] = l_Other;
+        l_Position--;
     }
 
+    p_PPU->m_ObjectsByX[l_Position] = p_Index;
+
 }
 
-void TOMBOY_FetchTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+void TOMBOY_ResetObjectBuckets (TOMBOY_PPU* p_PPU)
 {
+    memset(p_PPU->m_ObjectLineMasks, 0, sizeof(p_PPU->m_ObjectLineMasks));
+    for (uint8_t i = 0; i < TOMBOY_PPU_OBJECT_COUNT; ++i)
+    {
+        p_PPU->m_ObjectsByX[i] = i;
+    }
 
-    // Clear the fetched object count.
-    p_Fetcher->m_FetchedOBJ.m_ObjectCount = 0;
-
-    // Check the graphics mode to determine the order in which the tile numbers are fetched.
-    if (p_PPU->m_GRPM == 0)
+    for (uint8_t i = 0; i < TOMBOY_PPU_OBJECT_COUNT; ++i)
     {
-        // In DMG mode, if `LCDC` bit 0 is clear, then the background/window layer is not rendered
-        // at all.
-        if (p_PPU->m_LCDC.m_BGWEnableOrPriority == true)
-        {
-            // Fetch the tile number for the background layer.
-            TOMBOY_FetchBackgroundTileNumber(p_PPU, p_Fetcher);
+        TOMBOY_BucketObject(p_PPU, i, true);
+        TOMBOY_SortObjectByX(p_PPU, i);
+    }
+}
 
-            // If the window layer is enabled, then fetch the tile number for the window layer.
-            if (p_PPU->m_LCDC.m_WindowEnable == true)
-            {
-                TOMBOY_FetchWindowTileNumber(p_PPU, p_Fetcher);
-            }
-        }
+void TOMBOY_FindLineObjects (TOMBOY_PPU* p_PPU)
+{
 
-        // If the object layer is enabled, and there are objects on the current scanline, then fetch
-        // the tile number for an object.
-        if (p_PPU->m_LCDC.m_ObjectEnable == true && p_PPU->m_LineObjectCount > 0)
-        {
-            TOMBOY_FetchObjectTileNumber(p_PPU, p_Fetcher);
-        }
+    p_PPU->m_LineObjectCount = 0;
+    if (p_PPU->m_LY >= TOMBOY_PPU_SCREEN_HEIGHT)
+    {
+        return;
     }
-    else
+
+    // Check the `LCDC` register for the current object height, and look up the mask of the objects
+    // residing on the current scanline.
+    uint64_t l_Mask = p_PPU->m_ObjectLineMasks[(p_PPU->m_LCDC.m_ObjectSize == 1) ? 1 : 0][p_PPU->m_LY];
+    if (l_Mask == 0)
     {
-        // In CGB mode, if `LCDC` bit 0 is clear, then the background/window layer does not have
-        // priority over the object layer; all objects are rendered on top of the background/window
-        // layer, provided they are visible on the current scanline and the object layer is enabled.
-        //
-        // Otherwise, the background/window layer may have priority over the object layer.
-        if (p_PPU->m_LCDC.m_BGWEnableOrPriority == false)
-        {
-            // If the object layer is enabled, and there are objects on the current scanline, then fetch
-            // the tile number for an object.
-            if (p_PPU->m_LCDC.m_ObjectEnable == true && p_PPU->m_LineObjectCount > 0)
-            {
-                TOMBOY_FetchObjectTileNumber(p_PPU, p_Fetcher);
-            }
+        return;
+    }
 
-            // Fetch the tile number for the background layer.
-            TOMBOY_FetchBackgroundTileNumber(p_PPU, p_Fetcher);
+    // There is a limit of 10 objects per scanline: the first 10 found, in the order they are stored
+    // in the OAM buffer. Keep only those in the mask.
+    uint64_t l_Selected = 0;
+    for (uint8_t i = 0; i < 10 && l_Mask != 0; ++i)
+    {
+        uint64_t l_Lowest = l_Mask & (~l_Mask + 1);
+        l_Selected |= l_Lowest;
+        l_Mask &= ~l_Lowest;
+    }
 
-            // If the window layer is enabled, then fetch the tile number for the window layer.
-            if (p_PPU->m_LCDC.m_WindowEnable == true)
-            {
-                TOMBOY_FetchWindowTileNumber(p_PPU, p_Fetcher);
-            }
-        }
-        else
+    // If `GRPM` is set to zero (DMG mode), or if `OPRI` is non-zero (priority by X position), then
+    // the objects are listed in the X priority order:
+    // - Objects with smaller X positions have higher priority.
+    // - Objects with the same X position are assigned priority based on their index in the OAM buffer.
+    //
+    // Otherwise, they are listed in the order they are stored in the OAM buffer.
+    bool l_ByX = (p_PPU->m_GRPM == 0 || p_PPU->m_OPRI != 0);
+    for (uint8_t i = 0; i < TOMBOY_PPU_OBJECT_COUNT && l_Selected != 0; ++i)
+    {
+        uint8_t l_ObjectIndex = (l_ByX == true) ? p_PPU->m_ObjectsByX[i] : i;
+        uint64_t l_Bit = (uint64_t) 1 << l_ObjectIndex;
+        if ((l_Selected & l_Bit) != 0)
         {
-            // Fetch the tile number for the background layer.
-            TOMBOY_FetchBackgroundTileNumber(p_PPU, p_Fetcher);
-
-            // If the window layer is enabled, then fetch the tile number for the window layer.
-            if (p_PPU->m_LCDC.m_WindowEnable == true)
-            {
-                TOMBOY_FetchWindowTileNumber(p_PPU, p_Fetcher);
-            }
-
-            // If the object layer is enabled, and there are objects on the current scanline, then fetch
-            // the tile number for an object.
-            if (p_PPU->m_LCDC.m_ObjectEnable == true && p_PPU->m_LineObjectCount > 0)
-            {
-                TOMBOY_FetchObjectTileNumber(p_PPU, p_Fetcher);
-            }
+            p_PPU->m_LineObjectIndices[p_PPU->m_LineObjectCount++] = l_ObjectIndex;
+            l_Selected &= ~l_Bit;
         }
     }
 
-    // Advance the pixel fetcher's X-coordinate by 8 pixels, then move to the next state.
-    p_Fetcher->m_FetchingX += 8;
-    p_Fetcher->m_Mode = TOMBOY_PFM_TILE_DATA_LOW;
-
 }
 
-void TOMBOY_FetchTileDataLow (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+// Static Functions - Pixel Transfer ///////////////////////////////////////////////////////////////
+
+uint32_t TOMBOY_GetBackgroundColorInternal (TOMBOY_PPU* p_PPU, uint8_t p_PaletteIndex, uint8_t p_ColorIndex, TOMBOY_ColorRGB555* p_RGB555)
 {
+    // Correct the palette index to be in the range of 0-7.
+    p_PaletteIndex &= 0b111;
 
-    // Get the index of the tile which needs to be fetched.
-    uint8_t l_TileIndex = p_Fetcher->m_FetchedBGW.m_TileIndex;
+    // Correct the color index to be in the range of 0-3.
+    p_ColorIndex &= 0b11;
 
-    // Determine the target address to begin fetching the tile data from.
-    // Adjust this address, if needed, based on the `LCDC` BGW tile data address bit.
-    uint16_t l_TargetAddress = (l_TileIndex * 16) + p_Fetcher->m_TileDataOffset;
-    if (l_TileIndex < 128 && p_PPU->m_LCDC.m_BGWindowTileDataAddress == 0)
-    {
-        l_TargetAddress += 0x1000;
+    // Determine the start index of the color in the CRAM buffer.
+    uint8_t l_StartIndex = (p_PaletteIndex * TOMBOY_PPU_PALETTE_COLOR_COUNT * 2) + (p_ColorIndex * 2);
+
+    // Get the color data from the CRAM buffer.
+    uint8_t l_ColorData[2] = { p_PPU->m_BgCRAM[l_StartIndex], p_PPU->m_BgCRAM[l_StartIndex + 1] };
+
+    // Extract the RGB555 color data. Remember that the color data is laid out as follows:
+    // `0bRRRRRGGG` `0bGGBBBBB0`
+    uint8_t l_Red   = (l_ColorData[0] & 0b11111000) >> 3;
+    uint8_t l_Green = ((l_ColorData[0] & 0b00000111) << 2) | ((l_ColorData[1] & 0b11000000) >> 6);
+    uint8_t l_Blue  = (l_ColorData[1] & 0b00111110) >> 1;
+    
+    // If a color structure was provided, store the color data in it.
+    if (p_RGB555 != NULL)
+    {
+        p_RGB555->m_Red   = l_Red;
+        p_RGB555->m_Green = l_Green;
+        p_RGB555->m_Blue  = l_Blue;
+    }
+
+    // Return the RGBA color value.
+    return (
+        ((l_Red * 8) << 24) |
+        ((l_Green * 8) << 16) |
+        ((l_Blue * 8) << 8) |
+        0xFF
+    );
+}
+
+uint32_t TOMBOY_GetObjectColorInternal (TOMBOY_PPU* p_PPU, uint8_t p_PaletteIndex, uint8_t p_ColorIndex, TOMBOY_ColorRGB555* p_RGB555)
+{
+    // Correct the palette index to be in the range of 0-7.
+    p_PaletteIndex &= 0b111;
+
+    // Correct the color index to be in the range of 0-3.
+    p_ColorIndex &= 0b11;
+
+    // Determine the start index of the color in the CRAM buffer.
+    uint8_t l_StartIndex = (p_PaletteIndex * TOMBOY_PPU_PALETTE_COLOR_COUNT * 2) + (p_ColorIndex * 2);
+
+    // Get the color data from the CRAM buffer.
+    uint8_t l_ColorData[2] = { p_PPU->m_ObjCRAM[l_StartIndex], p_PPU->m_ObjCRAM[l_StartIndex + 1] };
+
+    // Extract the RGB555 color data. Remember that the color data is laid out as follows:
+    // `0bRRRRRGGG` `0bGGBBBBB0`
+    uint8_t l_Red   = (l_ColorData[0] & 0b11111000) >> 3;
+    uint8_t l_Green = ((l_ColorData[0] & 0b00000111) << 2) | ((l_ColorData[1] & 0b11000000) >> 6);
+    uint8_t l_Blue  = (l_ColorData[1] & 0b00111110) >> 1;
+
+    // If a color structure was provided, store the color data in it.
+    if (p_RGB555 != NULL)
+    {
+        p_RGB555->m_Red   = l_Red;
+        p_RGB555->m_Green = l_Green;
+        p_RGB555->m_Blue  = l_Blue;
+    }
+
+    // Return the RGBA color value.
+    return (
+        ((l_Red * 8) << 24) |
+        ((l_Green * 8) << 16) |
+        ((l_Blue * 8) << 8) |
+        0xFF
+    );
+}
+
+void TOMBOY_PushColor (TOMBOY_PixelFetcher* p_Fetcher, uint32_t p_Color)
+{
+    p_Fetcher->m_PixelFIFO.m_Buffer[p_Fetcher->m_PixelFIFO.m_Tail] = p_Color;
+    p_Fetcher->m_PixelFIFO.m_Tail = (p_Fetcher->m_PixelFIFO.m_Tail + 1) % TOMBOY_PPU_FIFO_SIZE;
+    p_Fetcher->m_PixelFIFO.m_Size++;
+}
+
+void TOMBOY_PopColor (TOMBOY_PixelFetcher* p_Fetcher, uint32_t* p_Color)
+{
+    *p_Color = p_Fetcher->m_PixelFIFO.m_Buffer[p_Fetcher->m_PixelFIFO.m_Head];
+    p_Fetcher->m_PixelFIFO.m_Head = (p_Fetcher->m_PixelFIFO.m_Head + 1) % TOMBOY_PPU_FIFO_SIZE;
+    p_Fetcher->m_PixelFIFO.m_Size--;
+}
+
+const uint32_t* TOMBOY_GetBackgroundPalette (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // If the `GRPM` register is set to 1, then the PPU is in CGB graphics mode. The fetched tile's
+    // attributes select one of the palettes in the background color RAM.
+    if (p_PPU->m_GRPM != 0)
+    {
+        return p_PPU->m_CRAMColors[0][p_Fetcher->m_FetchedBGW.m_TileAttributes.m_PaletteIndex];
+    }
+
+    // If the `GRPM` register is set to 0, then the PPU is in DMG graphics mode. The colors should
+    // not be fetched if `LCDC` bit 0 is clear. Otherwise, use the colors the `BGP` register maps
+    // the color indices to.
+    else if (p_PPU->m_LCDC.m_BGWEnableOrPriority == true)
+    {
+        return p_PPU->m_DMGColors[0];
+    }
+
+    // Otherwise, this is DMG mode where the background/window layer is disabled. Every pixel is
+    // transparent.
+    return p_PPU->m_BlankColors;
+
+}
+
+uint32_t TOMBOY_GetFetchedPixelColor (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher, uint8_t p_Index)
+{
+
+    // Gather the pixel's color index from the fetched row of the decoded tile, which is already
+    // flipped as the tile is, and look up its color in the fetched tile's palette.
+    uint8_t l_ColorIndex = p_Fetcher->m_FetchedBGW.m_TileRow[p_Index];
+    uint32_t l_RGBAColorValue = TOMBOY_GetBackgroundPalette(p_PPU, p_Fetcher)[l_ColorIndex];
+
+    // If the object layer is enabled, and there is at least one object residing on this pixel,
+    // then fetch the object pixel's color.
+    if (p_PPU->m_LCDC.m_ObjectEnable == true)
+    {
+        l_RGBAColorValue = TOMBOY_FetchObjectPixel(
+            p_PPU,
+            p_Fetcher,
+            l_ColorIndex,
+            l_RGBAColorValue,
+            p_PPU->m_LCDC.m_BGWEnableOrPriority
+        );
+    }
+
+    // Return the RGBA color value of the pixel.
+    return l_RGBAColorValue;
+
+}
+
+bool TOMBOY_TryAddPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // The pixel fetcher's FIFO is considered full if it contains more than 8 pixels, enough pixels
+    // to render the current line of the current tile.
+    if (p_Fetcher->m_PixelFIFO.m_Size > 8)
+    {
+        return false;
+    }
+
+    // Offset the pixel fetcher's X-coordinate by the scroll X register. Ensure that the resultant
+    // X-coordinate is within the screen's bounds.
+    int32_t l_OffsetX = p_Fetcher->m_FetchingX - (8 - (p_PPU->m_SCX % 8));
+    if (l_OffsetX < 0) { return true; }
+
+    // Iterate over the eight pixels which need to be shifted into the pixel FIFO.
+    for (uint8_t i = 0; i < 8; ++i)
+    {
+
+        // Shift the pixel into the pixel FIFO.
+        TOMBOY_PushColor(p_Fetcher, TOMBOY_GetFetchedPixelColor(p_PPU, p_Fetcher, i));
+        p_Fetcher->m_QueueX++;
+
+    }
+
+    return true;
+
+}
+
+void TOMBOY_ShiftNextPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // Only shift a pixel from the FIFO if it's full.
+    if (p_Fetcher->m_PixelFIFO.m_Size > 8)
+    {
+
+        // Pop the pixel's color from the FIFO.
+        uint32_t l_RGBAColorValue = 0;
+        TOMBOY_PopColor(p_Fetcher, &l_RGBAColorValue);
+
+        // Ensure that the pixel is within the bounds of the screen buffer.
+        if (p_Fetcher->m_LineX >= (p_PPU->m_SCX % 8))
+        {
+
+            // Determine the index of the pixel in the screen buffer.
+            uint32_t l_ScreenIndex = p_Fetcher->m_PushedX + (p_PPU->m_LY * TOMBOY_PPU_SCREEN_WIDTH);
+
+            // Emplace the pixel into the screen buffer, noting the scanline as changed if the pixel
+            // is. Advance the fetcher's pushed X-coordinate.
+            if (TOMBOY_StorePixel(p_PPU, l_ScreenIndex, l_RGBAColorValue) == true)
+            {
+                TOMBOY_MarkScanlineDirty(p_PPU, p_PPU->m_LY);
+            }
+            p_Fetcher->m_PushedX++;
+
+        }
+
+        // Move the fetcher's X-coordinate to the next pixel.
+        p_Fetcher->m_LineX++;
+
+    }
+
+}
+
+uint32_t TOMBOY_FetchObjectPixel (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher, uint8_t p_ColorIndex, uint32_t p_RGBAColorValue, uint8_t p_BGWindowPriority)
+{
+
+    // The `p_ColorIndex` parameter contains the index of the color used to render a background-
+    // or window-layer tile over which one or more of the objects fetched by the pixel fetcher may
+    // be residing.
+    //
+    // Store that old color index here, as we may need to restore it later.
+    uint8_t l_OldColorIndex = p_ColorIndex;
+
+    // Iterate over the indices of the objects fetched by the pixel fetcher as it was processing the
+    // current pixel.
+    for (uint8_t i = 0; i < p_Fetcher->m_FetchedOBJ.m_ObjectCount; ++i)
+    {
+
+        // Point to the object in the OAM buffer.
+        const TOMBOY_Object* l_Object = &p_PPU->m_OAM[p_Fetcher->m_FetchedOBJ.m_ObjectIndices[i]];
+
+        // Calculate the X-coordinate of the object's left edge on the screen.
+        // Ensure the object is within the bounds of the screen.
+        uint8_t l_ObjectX = (l_Object->m_X - 8) + (p_PPU->m_SCX % 8);
+        if (l_ObjectX + 8 < p_Fetcher->m_QueueX)
+        {
+            continue;
+        }
+
+        // Calculate the offset of the current pixel within the object's tile data.
+        // Ensure the offset is within the bounds of the tile data.
+        int8_t l_Offset = p_Fetcher->m_QueueX - l_ObjectX;
+        if (l_Offset < 0 || l_Offset >= 8)
+        {
+            continue;
+        }
+
+        // Gather the pixel's color index from the fetched row of the object's decoded tile, which
+        // is already flipped as the object is.
+        uint8_t l_ColorIndex = p_Fetcher->m_FetchedOBJ.m_TileRows[i][l_Offset];
+
+        // If the color index is zero, then the pixel is transparent and does not overwrite the
+        // background or window layer.
+        if (l_ColorIndex == 0)
+        {
+            continue;
+        }
+        
+        // Check if one of the following conditions is met:
+        // - The old color index is zero.
+        // - The object's BGW priority attribute is zero.
+        // - The provided `p_BGWindowPriority` parameter is zero.
+        if (
+            l_OldColorIndex == 0 ||
+            l_Object->m_Attributes.m_Priority == 0 ||
+            (
+                p_BGWindowPriority == 0 &&
+                l_Object->m_Attributes.m_Priority == 0
+            )
+        )
+        {
+            // Is the graphics mode set to CGB mode?
+            if (p_PPU->m_GRPM == 1)
+            {
+                p_RGBAColorValue =
+                    p_PPU->m_CRAMColors[1][l_Object->m_Attributes.m_PaletteIndex][l_ColorIndex];
+            }
+
+            // Otherwise, the graphics mode is set to DMG mode. Look up the color the `OBP0` or
+            // `OBP1` register maps the color index to.
+            else
+            {
+                p_RGBAColorValue =
+                    p_PPU->m_DMGColors[1 + l_Object->m_Attributes.m_DMGPalette][l_ColorIndex];
+            }
+
+            if (p_ColorIndex > 0) { break; }
+        }
+
+    }
+
+    // Return the RGBA color value of the pixel.
+    return p_RGBAColorValue;
+
+}
+
+void TOMBOY_FetchBackgroundTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // Determine the relative starting address of the tile map used to render the background layer.
+    uint16_t l_TileMapAddress = (p_PPU->m_LCDC.m_BGTilemapAddress == 0) ? 0x1800 : 0x1C00;
+
+    // Determine the source Y position of the tile.
+    uint8_t l_TileY = p_Fetcher->m_MapY / 8;
+
+    // Use the pixel fetcher's map coordinates to determine the target address offset.
+    uint16_t l_TargetOffset = (l_TileY * 32) + (p_Fetcher->m_MapX / 8);
+    uint16_t l_TargetAddress = l_TileMapAddress + l_TargetOffset;
+
+    // Fetch the tile number and attributes from VRAM banks 0 and 1, respectively.
+    p_Fetcher->m_FetchedBGW.m_TileIndex = p_PPU->m_VRAM0[l_TargetAddress];
+    p_Fetcher->m_FetchedBGW.m_TileAttributes.m_Value = p_PPU->m_VRAM1[l_TargetAddress];
+}
+
+void TOMBOY_FetchWindowTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // Only fetch a window tile number if the following conditions are met:
+    // - The window layer is currently enabled and visible.
+    // - The fetcher's next X coordinate is within the bounds of the window layer.
+    // - The `LY` register is within the bounds of the window layer.
+    if (
+        TOMBOY_IsWindowVisible(p_PPU) == true &&
+        p_Fetcher->m_FetchingX + 7 >= p_PPU->m_WX &&
+        p_Fetcher->m_FetchingX + 7 < (p_PPU->m_WX + TOMBOY_PPU_SCREEN_HEIGHT + 14) &&
+        p_PPU->m_LY >= p_PPU->m_WY &&
+        p_PPU->m_LY < p_PPU->m_WY + TOMBOY_PPU_SCREEN_WIDTH
+    )
+    {
+
+        // Determine the relative starting address of the tile map used to render the window layer.
+        uint16_t l_TileMapAddress = (p_PPU->m_LCDC.m_WindowTilemapAddress == 0) ? 0x1800 : 0x1C00;
+
+        // Determine the source Y position of the tile.
+        uint8_t l_TileY = p_PPU->m_WindowLine / 8;
+
+        // Use the pixel fetcher's map coordinates to determine the target address offset.
+        uint16_t l_TargetOffset = (l_TileY * 32) + ((p_Fetcher->m_FetchingX + 7 - p_PPU->m_WX) / 8);
+        uint16_t l_TargetAddress = l_TileMapAddress + l_TargetOffset;
+        
+        // Fetch the tile number and attributes from VRAM banks 0 and 1, respectively.
+        p_Fetcher->m_FetchedBGW.m_TileIndex = p_PPU->m_VRAM0[l_TargetAddress];
+        p_Fetcher->m_FetchedBGW.m_TileAttributes.m_Value = p_PPU->m_VRAM1[l_TargetAddress];
+    }
+
+}
+
+void TOMBOY_FetchObjectTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+    // Iterate over the indices of the objects found on the current scanline.
+    for (uint8_t i = 0; i < p_PPU->m_LineObjectCount; ++i)
+    {
+
+        // Point to the object in the OAM buffer.
+        const TOMBOY_Object* l_Object = &p_PPU->m_OAM[p_PPU->m_LineObjectIndices[i]];
+
+        // Calculate the object's scrolling-adjusted X-coordinate.
+        int16_t l_ObjectX = (l_Object->m_X - 8) + (p_PPU->m_SCX % 8);
+
+        // Ensure that the object's tile data will fit into the pixel fetcher's FIFO.
+        if (
+            (l_ObjectX >= p_Fetcher->m_FetchingX && l_ObjectX < p_Fetcher->m_FetchingX + 8) ||
+            (l_ObjectX + 8 >= p_Fetcher->m_FetchingX && l_ObjectX + 8 < p_Fetcher->m_FetchingX + 8)
+        )
+        {
+
+            // If it does, then add the object's index to the list of objects whose tile data needs
+            // to be fetched.
+            p_Fetcher->m_FetchedOBJ.m_ObjectIndices[p_Fetcher->m_FetchedOBJ.m_ObjectCount++] = 
+                p_PPU->m_LineObjectIndices[i];
+
+            // Limit 3 objects per pixel.
+            if (p_Fetcher->m_FetchedOBJ.m_ObjectCount >= 3)
+            {
+                break;
+            }
+
+        }
+
+    }
+}
+
+void TOMBOY_FetchObjectTileData (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher, uint8_t p_Offset)
+{
+
+    // Determine the current object size.
+    uint8_t l_ObjectHeight = (p_PPU->m_LCDC.m_ObjectSize == 1) ? 16 : 8;
+
+    // Iterate over the indices of the objects found on this pixel, whose tile data needs to be fetched.
+    for (uint8_t i = 0; i < p_Fetcher->m_FetchedOBJ.m_ObjectCount; ++i)
+    {
+
+        // Point to the object in the OAM buffer.
+        const TOMBOY_Object* l_Object = &p_PPU->m_OAM[p_Fetcher->m_FetchedOBJ.m_ObjectIndices[i]];
+
+        // Get the object's Y position on the screen. Adjust the position according to the object's
+        // Y-flip attribute.
+        uint8_t l_ObjectY = ((p_PPU->m_LY + 16) - l_Object->m_Y) * 2;
+        if (l_Object->m_Attributes.m_VerticalFlip == 1)
+        {
+            l_ObjectY = ((l_ObjectHeight * 2) - 2) - l_ObjectY;
+        }
+
+        // Get the object's tile index, with its low bit cleared if tall objects (8x16) are being used.
+        uint8_t l_TileIndex = l_Object->m_TileIndex & ((l_ObjectHeight == 16) ? 0xFE : 0xFF);
+
+        // Calculate the target address of the object's tile data.
+        uint16_t l_TargetAddress = (l_TileIndex * 16) + (l_ObjectY + p_Offset);
+
+        // Fetch the proper tile data (low if `p_Offset` is 0, high if `p_Offset` is non-zero).
+        // The above-calculated address is relative to the start of the VRAM bank, so permission to
+        // access the VRAM bank will be checked for.
+        if (p_Offset == 0)
+        {
+            p_Fetcher->m_FetchedOBJ.m_TileDataLow[i] = p_PPU->m_VRAM[l_TargetAddress];
+        }
+        else
+        {
+            p_Fetcher->m_FetchedOBJ.m_TileDataHigh[i] = p_PPU->m_VRAM[l_TargetAddress];
+            p_Fetcher->m_FetchedOBJ.m_TileRows[i] = TOMBOY_GetFetchedTileRow(p_PPU, l_TargetAddress,
+                p_Fetcher->m_FetchedOBJ.m_TileDataLow[i], l_Object->m_Attributes.m_HorizontalFlip,
+                p_Fetcher->m_FetchedOBJ.m_RowBuffers[i]);
+        }
+        
+    }
+
+}
+
+void TOMBOY_FetchTileNumber (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // Clear the fetched object count.
+    p_Fetcher->m_FetchedOBJ.m_ObjectCount = 0;
+
+    // Check the graphics mode to determine the order in which the tile numbers are fetched.
+    if (p_PPU->m_GRPM == 0)
+    {
+        // In DMG mode, if `LCDC` bit 0 is clear, then the background/window layer is not rendered
+        // at all.
+        if (p_PPU->m_LCDC.m_BGWEnableOrPriority == true)
+        {
+            // Fetch the tile number for the background layer.
+            TOMBOY_FetchBackgroundTileNumber(p_PPU, p_Fetcher);
+
+            // If the window layer is enabled, then fetch the tile number for the window layer.
+            if (p_PPU->m_LCDC.m_WindowEnable == true)
+            {
+                TOMBOY_FetchWindowTileNumber(p_PPU, p_Fetcher);
+            }
+        }
+
+        // If the object layer is enabled, and there are objects on the current scanline, then fetch
+        // the tile number for an object.
+        if (p_PPU->m_LCDC.m_ObjectEnable == true && p_PPU->m_LineObjectCount > 0)
+        {
+            TOMBOY_FetchObjectTileNumber(p_PPU, p_Fetcher);
+        }
+    }
+    else
+    {
+        // In CGB mode, if `LCDC` bit 0 is clear, then the background/window layer does not have
+        // priority over the object layer; all objects are rendered on top of the background/window
+        // layer, provided they are visible on the current scanline and the object layer is enabled.
+        //
+        // Otherwise, the background/window layer may have priority over the object layer.
+        if (p_PPU->m_LCDC.m_BGWEnableOrPriority == false)
+        {
+            // If the object layer is enabled, and there are objects on the current scanline, then fetch
+            // the tile number for an object.
+            if (p_PPU->m_LCDC.m_ObjectEnable == true && p_PPU->m_LineObjectCount > 0)
+            {
+                TOMBOY_FetchObjectTileNumber(p_PPU, p_Fetcher);
+            }
+
+            // Fetch the tile number for the background layer.
+            TOMBOY_FetchBackgroundTileNumber(p_PPU, p_Fetcher);
+
+            // If the window layer is enabled, then fetch the tile number for the window layer.
+            if (p_PPU->m_LCDC.m_WindowEnable == true)
+            {
+                TOMBOY_FetchWindowTileNumber(p_PPU, p_Fetcher);
+            }
+        }
+        else
+        {
+            // Fetch the tile number for the background layer.
+            TOMBOY_FetchBackgroundTileNumber(p_PPU, p_Fetcher);
+
+            // If the window layer is enabled, then fetch the tile number for the window layer.
+            if (p_PPU->m_LCDC.m_WindowEnable == true)
+            {
+                TOMBOY_FetchWindowTileNumber(p_PPU, p_Fetcher);
+            }
+
+            // If the object layer is enabled, and there are objects on the current scanline, then fetch
+            // the tile number for an object.
+            if (p_PPU->m_LCDC.m_ObjectEnable == true && p_PPU->m_LineObjectCount > 0)
+            {
+                TOMBOY_FetchObjectTileNumber(p_PPU, p_Fetcher);
+            }
+        }
+    }
+
+    // Advance the pixel fetcher's X-coordinate by 8 pixels, then move to the next state.
+    p_Fetcher->m_FetchingX += 8;
+    p_Fetcher->m_Mode = TOMBOY_PFM_TILE_DATA_LOW;
+
+}
+
+void TOMBOY_FetchTileDataLow (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // Get the index of the tile which needs to be fetched.
+    uint8_t l_TileIndex = p_Fetcher->m_FetchedBGW.m_TileIndex;
+
+    // Determine the target address to begin fetching the tile data from.
+    // Adjust this address, if needed, based on the `LCDC` BGW tile data address bit.
+    uint16_t l_TargetAddress = (l_TileIndex * 16) + p_Fetcher->m_TileDataOffset;
+    if (l_TileIndex < 128 && p_PPU->m_LCDC.m_BGWindowTileDataAddress == 0)
+    {
+        l_TargetAddress += 0x1000;
+    }
+
+    // Fetch the low byte of the tile data from the current bank in VRAM.
+    p_Fetcher->m_FetchedBGW.m_TileDataLow = p_PPU->m_VRAM[l_TargetAddress];
+
+    // If there is an object residing on this pixel, fetch that object's tile data as well.
+    TOMBOY_FetchObjectTileData(p_PPU, p_Fetcher, 0);
+
+    // Move to the next state.
+    p_Fetcher->m_Mode = TOMBOY_PFM_TILE_DATA_HIGH;
+
+}
+
+void TOMBOY_FetchTileDataHigh (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // The high byte of the tile data is fetched in the same manner as the low byte.
+    uint8_t l_TileIndex = p_Fetcher->m_FetchedBGW.m_TileIndex;
+    uint16_t l_TargetAddress = (l_TileIndex * 16) + p_Fetcher->m_TileDataOffset + 1;
+    if (l_TileIndex < 128 && p_PPU->m_LCDC.m_BGWindowTileDataAddress == 0)
+    {
+        l_TargetAddress += 0x1000;
+    }
+
+    // Fetch the high byte of the tile data. With both bytes of the row in, fetch its decoded color
+    // indices as well.
+    p_Fetcher->m_FetchedBGW.m_TileDataHigh = p_PPU->m_VRAM[l_TargetAddress];
+    p_Fetcher->m_FetchedBGW.m_TileRow = TOMBOY_GetFetchedTileRow(p_PPU, l_TargetAddress,
+        p_Fetcher->m_FetchedBGW.m_TileDataLow, p_Fetcher->m_FetchedBGW.m_TileAttributes.m_HorizontalFlip,
+        p_Fetcher->m_FetchedBGW.m_RowBuffer);
+
+    // If there is an object residing on this pixel, fetch that object's tile data as well.
+    TOMBOY_FetchObjectTileData(p_PPU, p_Fetcher, 1);
+
+    // Move to the next state.
+    p_Fetcher->m_Mode = TOMBOY_PFM_SLEEP;
+
+}
+
+void TOMBOY_FetchPushPixels (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // In this mode, continuous attempts are made to push a pixel to the pixel FIFO buffer.
+    if (TOMBOY_TryAddPixel(p_PPU, p_Fetcher) == true)
+    {
+        // Once successful, return to the tile number state.
+        p_Fetcher->m_Mode = TOMBOY_PFM_TILE_NUMBER;
+    }
+
+}
+
+void TOMBOY_FetchSleep (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+    // Here, the fetcher sleeps for two dots before pushing the pixels to the screen buffer.
+    p_Fetcher->m_Mode = TOMBOY_PFM_PUSH_PIXELS;
+}
+
+void TOMBOY_TickPixelFetcher (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // Calculate the absolute position of the pixel to be processed, in the 256x256 pixel tilemap.
+    p_Fetcher->m_MapY = p_PPU->m_LY + p_PPU->m_SCY;
+    p_Fetcher->m_MapX = p_Fetcher->m_FetchingX + p_PPU->m_SCX;
+
+    // Calculate the offset address of the tile data to be fetched.
+    p_Fetcher->m_TileDataOffset = (p_Fetcher->m_MapY % 8) * 2;
+
+    // During each even-numbered dot in the pixel transfer mode, the pixel fetcher will work
+    // to keep supplying its pixel FIFO buffer with new pixels to draw to the screen buffer.
+    if (p_PPU->m_CurrentDot % 2 == 0)
+    {
+
+        // Run the appropriate function in the pixel-fetcher's state machine.
+        switch (p_Fetcher->m_Mode)
+        {
+            case TOMBOY_PFM_TILE_NUMBER: TOMBOY_FetchTileNumber(p_PPU, p_Fetcher); break;
+            case TOMBOY_PFM_TILE_DATA_LOW: TOMBOY_FetchTileDataLow(p_PPU, p_Fetcher); break;
+            case TOMBOY_PFM_TILE_DATA_HIGH: TOMBOY_FetchTileDataHigh(p_PPU, p_Fetcher); break;
+            case TOMBOY_PFM_PUSH_PIXELS: TOMBOY_FetchPushPixels(p_PPU, p_Fetcher); break;
+            case TOMBOY_PFM_SLEEP: TOMBOY_FetchSleep(p_PPU, p_Fetcher); break;
+        }
+
+    }
+
+    // In any event, try to shift a pixel from the FIFO buffer into the screen buffer.
+    TOMBOY_ShiftNextPixel(p_PPU, p_Fetcher);
+
+}
+
+void TOMBOY_ResetPixelFetcher (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+{
+
+    // Reset the pixel FIFO buffer.
+    p_Fetcher->m_PixelFIFO.m_Head = 0;
+    p_Fetcher->m_PixelFIFO.m_Tail = 0;
+    p_Fetcher->m_PixelFIFO.m_Size = 0;
+
+}
+
+// Static Functions - Scanline Renderer ///////////////////////////////////////////////////////////
+
+uint16_t TOMBOY_GetPixelTransferEndDot (const TOMBOY_PPU* p_PPU)
+{
+    return 80 + TOMBOY_PPU_PIXEL_TRANSFER_DOTS[p_PPU->m_LineSCX % 8];
+}
+
+void TOMBOY_LatchLineRegisters (TOMBOY_PPU* p_PPU)
+{
+    // Whether a frame is drawn is decided as its first scanline begins, so that no frame is drawn in
+    // part. The scanlines of a skipped frame run in the fast render mode, which keeps the same
+    // timing without running the pixel fetcher.
+    if (p_PPU->m_LY == 0)
+    {
+        p_PPU->m_SkippingFrame = p_PPU->m_FrameSkip;
+    }
+
+    p_PPU->m_LineRenderMode = (p_PPU->m_SkippingFrame == true) ? TOMBOY_RM_FAST : p_PPU->m_RenderMode;
+    p_PPU->m_LineLCDC = p_PPU->m_LCDC;
+    p_PPU->m_LineSCY = p_PPU->m_SCY;
+    p_PPU->m_LineSCX = p_PPU->m_SCX;
+    p_PPU->m_LineWY = p_PPU->m_WY;
+    p_PPU->m_LineWX = p_PPU->m_WX;
+}
+
+void TOMBOY_SwapLineRegisters (TOMBOY_PPU* p_PPU)
+{
+    TOMBOY_DisplayControl l_LCDC = p_PPU->m_LCDC;
+    p_PPU->m_LCDC = p_PPU->m_LineLCDC;
+    p_PPU->m_LineLCDC = l_LCDC;
+
+    uint8_t l_Temp = p_PPU->m_SCY;
+    p_PPU->m_SCY = p_PPU->m_LineSCY;
+    p_PPU->m_LineSCY = l_Temp;
+
+    l_Temp = p_PPU->m_SCX;
+    p_PPU->m_SCX = p_PPU->m_LineSCX;
+    p_PPU->m_LineSCX = l_Temp;
+
+    l_Temp = p_PPU->m_WY;
+    p_PPU->m_WY = p_PPU->m_LineWY;
+    p_PPU->m_LineWY = l_Temp;
+
+    l_Temp = p_PPU->m_WX;
+    p_PPU->m_WX = p_PPU->m_LineWX;
+    p_PPU->m_LineWX = l_Temp;
+}
+
+void TOMBOY_RenderScanline (TOMBOY_PPU* p_PPU)
+{
+
+    // A skipped frame's scanlines are not drawn. Only mark the pixel transfer as complete.
+    if (p_PPU->m_SkippingFrame == true)
+    {
+        p_PPU->m_PixelFetcher.m_PushedX = TOMBOY_PPU_SCREEN_WIDTH;
+        return;
+    }
+
+    // The scanline is drawn with the registers latched as its pixel transfer began, so swap those in
+    // for the registers' current values until it is done.
+    TOMBOY_SwapLineRegisters(p_PPU);
+
+    // The fetcher's steps are run back to back, a tile at a time, exactly as the pixel transfer mode
+    // runs them, but the pixels go straight to the screen buffer instead of through the FIFO. The
+    // FIFO discards the first `SCX % 8` pixels it is given.
+    TOMBOY_PixelFetcher* l_Fetcher = &p_PPU->m_PixelFetcher;
+    uint8_t l_FineX = p_PPU->m_SCX % 8;
+    uint8_t* l_Line = &p_PPU->m_ScreenBuffer[p_PPU->m_LY * p_PPU->m_ScreenPitch];
+    uint8_t l_Size = p_PPU->m_PixelSize;
+
+    l_Fetcher->m_MapY = p_PPU->m_LY + p_PPU->m_SCY;
+    l_Fetcher->m_TileDataOffset = (l_Fetcher->m_MapY % 8) * 2;
+    while (l_Fetcher->m_QueueX < TOMBOY_PPU_SCREEN_WIDTH + l_FineX)
+    {
+        l_Fetcher->m_MapX = l_Fetcher->m_FetchingX + p_PPU->m_SCX;
+        TOMBOY_FetchTileNumber(p_PPU, l_Fetcher);
+        TOMBOY_FetchTileDataLow(p_PPU, l_Fetcher);
+        TOMBOY_FetchTileDataHigh(p_PPU, l_Fetcher);
+
+        // Where no objects were fetched over the tile, its 8 pixels are colored at once. Otherwise,
+        // each pixel is mixed with the objects over it, one at a time.
+        uint32_t l_Colors[8];
+        int16_t l_LineX = (int16_t) l_Fetcher->m_QueueX - l_FineX;
+        if (l_Fetcher->m_FetchedOBJ.m_ObjectCount == 0)
+        {
+            s_Kernels.m_LookupColors(l_Fetcher->m_FetchedBGW.m_TileRow,
+                TOMBOY_GetBackgroundPalette(p_PPU, l_Fetcher), l_Colors);
+            l_Fetcher->m_QueueX += 8;
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 8; ++i)
+            {
+                l_Colors[i] = TOMBOY_GetFetchedPixelColor(p_PPU, l_Fetcher, i);
+                l_Fetcher->m_QueueX++;
+            }
+        }
+
+        // Copy the pixels which land on the screen to the scanline at the pixel format's width,
+        // noting the scanline as changed if any of them are.
+        uint8_t l_Buffer[8 * sizeof(uint32_t)];
+        const uint8_t* l_Pixels = TOMBOY_PackPixels(p_PPU, l_Colors, l_Buffer);
+        int16_t l_First = (l_LineX < 0) ? -l_LineX : 0;
+        int16_t l_Last = (l_LineX + 8 > TOMBOY_PPU_SCREEN_WIDTH) ?
+            TOMBOY_PPU_SCREEN_WIDTH - l_LineX : 8;
+        uint8_t* l_Target = &l_Line[(l_LineX + l_First) * l_Size];
+        size_t l_Count = (l_Last - l_First) * l_Size;
+        if (l_First < l_Last && memcmp(l_Target, &l_Pixels[l_First * l_Size], l_Count) != 0)
+        {
+            memcpy(l_Target, &l_Pixels[l_First * l_Size], l_Count);
+            TOMBOY_MarkScanlineDirty(p_PPU, p_PPU->m_LY);
+        }
+    }
+
+    l_Fetcher->m_PushedX = TOMBOY_PPU_SCREEN_WIDTH;
+
+    // Restore the registers' current values.
+    TOMBOY_SwapLineRegisters(p_PPU);
+
+}
+
+// Static Functions - PPU State Machine ////////////////////////////////////////////////////////////
+
+void TOMBOY_TickHorizontalBlank (TOMBOY_PPU* p_PPU)
+{
+
+    // Increment the current dot.
+    p_PPU->m_CurrentDot++;
+
+    // If the current dot is at least 456, then the horizontal blank is complete.
+    if (p_PPU->m_CurrentDot >= 456)
+    {
+
+        // Increment the LY register.
+        TOMBOY_IncrementLY(p_PPU);
+
+        // If all 144 visible scanlines of the current frame have been rendered, then the vertical
+        // blank period has begun.
+        if (p_PPU->m_LY >= TOMBOY_PPU_SCREEN_HEIGHT)
+        {
+            // Move to the vertical blank state and request the `VBLANK` interrupt.
+            p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_VERTICAL_BLANK;
+            TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_VBLANK);
+
+            // If the `LCD_STAT` interrupt source is enabled for the vertical blank period, then
+            // request the `LCD_STAT` interrupt as well.
+            if (p_PPU->m_STAT.m_VerticalBlankStatSource == true)
+            {
+                TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_LCDSTAT);
+            }
+
+            // If the frame rendered callback is provided, call it here.
+            TOMBOY_DeliverFrame(p_PPU);
+        }
+
+        // If there are still visible scanlines to render, then move to the object scan state.
+        else
+        {
+            p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_OBJECT_SCAN;
+            p_PPU->m_LineObjectCount = 0;
+
+            // If its stat source is set, request the `LCD_STAT` interrupt.
+            if (p_PPU->m_STAT.m_ObjectScanStatSource == true)
+            {
+                TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_LCDSTAT);
+            }
+        }
+
+        // Reset the current dot.
+        p_PPU->m_CurrentDot = 0;
+
+    }
+
+}
+
+void TOMBOY_TickVerticalBlank (TOMBOY_PPU* p_PPU)
+{
+
+    // If the PPU is about to exit the vertical blanking period (the current dot is at least 456
+    // and the LY register is at 154), then check to see if the vertical blank pause register
+    // is non-zero. If it is, then the PPU will remain in VBLANK mode until the pause reigster is
+    // set to zero.
+    //
+    // Otherwise, if the current dot is less than 456, then increment the current dot.
+    if (p_PPU->m_CurrentDot >= 456 && p_PPU->m_LY >= TOMBOY_PPU_SCANLINE_COUNT && p_PPU->m_VBP != 0)
+    {
+        return;
+    }
+    else if (p_PPU->m_CurrentDot < 456)
+    {
+        p_PPU->m_CurrentDot++;
+    }
+
+    // If the current dot is at least 456, then the vertical blank is complete.
+    if (p_PPU->m_CurrentDot >= 456)
+    {
+
+        // Increment the LY register.
+        TOMBOY_IncrementLY(p_PPU);
+
+        // If all 154 scanlines have been processed, but the vertical blank pause register is non-zero,
+        // then the vertical blank period will not be considered complete until the pause register
+        // is set to zero.
+        if (p_PPU->m_LY >= TOMBOY_PPU_SCANLINE_COUNT && p_PPU->m_VBP != 0)
+        {
+            return;
+        }
+
+        // If all 154 scanlines have been processed, then the vertical blank period is complete.
+        if (p_PPU->m_LY >= TOMBOY_PPU_SCANLINE_COUNT)
+        {
+
+            // Reset the LY register and window line counter.
+            p_PPU->m_LY = 0;
+            p_PPU->m_WindowLine = 0;
+
+            // Move to the object scan state and begin processing the next frame.
+            p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_OBJECT_SCAN;
+            p_PPU->m_LineObjectCount = 0;
+
+            // If its stat source is set, request the `LCD_STAT` interrupt.
+            if (p_PPU->m_STAT.m_ObjectScanStatSource == true)
+            {
+                TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_LCDSTAT);
+            }
+
+        }
+
+        // Reset the current dot.
+        p_PPU->m_CurrentDot = 0;
+
+    }
+}
+
+void TOMBOY_TickObjectScan (TOMBOY_PPU* p_PPU)
+{
+
+    // Increment the current dot.
+    p_PPU->m_CurrentDot++;
+
+    // If the incremented dot is at least 80, then the object scan is complete. The objects residing
+    // on the current scanline are looked up from the masks kept as OAM is written. Move to the pixel
+    // transfer state.
+    if (p_PPU->m_CurrentDot >= 80)
+    {
+        p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_PIXEL_TRANSFER;        
+
+        TOMBOY_PixelFetcher* l_Fetcher = &p_PPU->m_PixelFetcher;
+        l_Fetcher->m_Mode = TOMBOY_PFM_TILE_NUMBER;
+        l_Fetcher->m_FetchingX = 0;
+        l_Fetcher->m_QueueX = 0;
+        l_Fetcher->m_LineX = 0;
+        l_Fetcher->m_PushedX = 0;
+
+        // Latch the render mode, and the registers the fast render mode draws the scanline with.
+        // The objects are not needed if the scanline is not drawn.
+        TOMBOY_LatchLineRegisters(p_PPU);
+        if (p_PPU->m_SkippingFrame == false)
+        {
+            TOMBOY_FindLineObjects(p_PPU);
+        }
+    }
+
+}
+
+void TOMBOY_TickPixelTransfer (TOMBOY_PPU* p_PPU)
+{
+
+    // In the fast render mode, the pixel transfer only counts its dots, for as long as the pixel
+    // fetcher would take, then draws the whole scanline at once.
+    if (p_PPU->m_LineRenderMode == TOMBOY_RM_FAST)
+    {
+        if (++p_PPU->m_CurrentDot >= TOMBOY_GetPixelTransferEndDot(p_PPU))
+        {
+            TOMBOY_RenderScanline(p_PPU);
+        }
+    }
+
+    // Otherwise, tick the pixel fetcher, then increment the current dot.
+    else
+    {
+        TOMBOY_TickPixelFetcher(p_PPU, &p_PPU->m_PixelFetcher);
+        p_PPU->m_CurrentDot++;
+    }
+
+    // If the pixel fetcher has pushed enough pixels to the screen buffer to fill a scanline, then
+    // the pixel transfer is complete. Move to the horizontal blank state.
+    if (p_PPU->m_PixelFetcher.m_PushedX >= TOMBOY_PPU_SCREEN_WIDTH)
+    {
+        
+        // Reset the pixel fetcher.
+        TOMBOY_ResetPixelFetcher(p_PPU, &p_PPU->m_PixelFetcher);
+
+        // Move to the horizontal blank state. If its stat source is set, request the `LCD_STAT`
+        // interrupt.
+        p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_HORIZONTAL_BLANK;
+        if (p_PPU->m_STAT.m_HorizontalBlankStatSource == true)
+        {
+            TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_LCDSTAT);
+        }
+
+        // At the start of each H-Blank period, another block of HDMA data is transferred.
+        TOMBOY_TickHDMA(p_PPU);
+
+    }
+
+}
+
+void TOMBOY_TickPPUDot (TOMBOY_PPU* p_PPU, bool p_ODMA)
+{
+    // If the PPU is disabled, then do not tick the state machine.
+    if (p_PPU->m_LCDC.m_DisplayEnable == false)
+    {
+        // Instead, increment the inactive divider. If the inactive divider reaches the number of
+        // dots in a frame, then call the frame rendered callback, if it is set.
+        p_PPU->m_InactiveDivider = (p_PPU->m_InactiveDivider + 1) % TOMBOY_PPU_DOTS_PER_FRAME;
+        if (p_PPU->m_InactiveDivider == 0)
+        {
+            TOMBOY_DeliverFrame(p_PPU);
+        }
+
+        return;
+    }
+
+    // Check the current display mode and tick the appropriate state machine.
+    switch (p_PPU->m_STAT.m_DisplayMode)
+    {
+        case TOMBOY_DM_HORIZONTAL_BLANK: TOMBOY_TickHorizontalBlank(p_PPU); break;
+        case TOMBOY_DM_VERTICAL_BLANK: TOMBOY_TickVerticalBlank(p_PPU); break;
+        case TOMBOY_DM_OBJECT_SCAN: TOMBOY_TickObjectScan(p_PPU); break;
+        case TOMBOY_DM_PIXEL_TRANSFER: TOMBOY_TickPixelTransfer(p_PPU); break;
+    }
+
+    // If the ODMA transfer is active, then tick the ODMA transfer.
+    if (p_ODMA == true)
+    {
+        TOMBOY_TickODMA(p_PPU);
+    }
+}
+
+// Static Functions - HDMA Transfer ////////////////////////////////////////////////////////////////
+
+void TOMBOY_TickODMA (TOMBOY_PPU* p_PPU)
+{
+    // Check to see if the DMA transfer is active.
+    if (p_PPU->m_ODMATicks >= 0xA0)
+    {
+        return;
+    }
+
+    // If the ODMA transfer has been initiated, check to see if there is a delay still before
+    // actually starting the transfer.
+    if (p_PPU->m_ODMADelay > 0)
+    {
+        p_PPU->m_ODMADelay--;
+        return;
+    }
+
+    // If the ODMA transfer is active, then transfer the next byte of data. Each byte is still copied
+    // on its own tick, as the CPU may change the source while the transfer runs, but a source in
+    // plain memory is read straight from the host memory backing it.
+    uint8_t l_Value = (p_PPU->m_ODMAHostSource != NULL) ?
+        p_PPU->m_ODMAHostSource[p_PPU->m_ODMATicks] :
+        TM_ReadByte(TOMBOY_GetCPU(p_PPU->m_ParentEngine), p_PPU->m_ODMASource + p_PPU->m_ODMATicks);
+    TOMBOY_WriteOAMByte(p_PPU, TOMBOY_OAM_START + (p_PPU->m_ODMATicks++), l_Value);
+}
+
+void TOMBOY_TickHDMA (TOMBOY_PPU* p_PPU)
+{
+    if (p_PPU->m_HDMABlocksLeft > 0)
+    {
+        // If the HDMA transfer is active, then decrement the number of blocks left to transfer.
+        p_PPU->m_HDMABlocksLeft--;
+
+        // If the block's source is plain memory, and its destination lies within VRAM, then copy the
+        // block in one go. A tile whose bytes change needs decoding afresh.
+        const uint8_t* l_Source = TOMBOY_GetBusReadPointer(p_PPU->m_ParentEngine,
+            p_PPU->m_HDMASource, 0x10);
+        if (l_Source != NULL && p_PPU->m_HDMADestination + 0x10 <= TOMBOY_PPU_VRAM_BANK_SIZE)
+        {
+            uint8_t* l_Destination = &p_PPU->m_VRAM[p_PPU->m_HDMADestination];
+            if (p_PPU->m_HDMADestination < TOMBOY_PPU_TDATA_PARTITION_SIZE &&
+                memcmp(l_Destination, l_Source, 0x10) != 0)
+            {
+                p_PPU->m_TileCacheValid[TOMBOY_GetVRAMBankIndex(p_PPU)][p_PPU->m_HDMADestination / 16] = false;
+            }
+
+            memcpy(l_Destination, l_Source, 0x10);
+            p_PPU->m_HDMASource += 0x10;
+            p_PPU->m_HDMADestination += 0x10;
+            return;
+        }
+
+        // Otherwise, transfer the next block of data a byte at a time.
+        for (uint8_t i = 0; i < 0x10; i++)
+        {
+            uint8_t l_Value = TM_ReadByte(TOMBOY_GetCPU(p_PPU->m_ParentEngine), p_PPU->m_HDMASource++);
+            TOMBOY_WriteVRAMByte(p_PPU, TOMBOY_VRAM_START + (p_PPU->m_HDMADestination++), l_Value);
+        }
+    }
+}
+
+// Public Functions ////////////////////////////////////////////////////////////////////////////////
+
+TOMBOY_PPU* TOMBOY_CreatePPU (TOMBOY_Engine* p_Engine)
+{
+    // Allocate the GABLE PPU instance.
+    TOMBOY_PPU* l_PPU = TM_calloc(1, TOMBOY_PPU);
+    TM_pexpect(l_PPU != NULL, "Failed to allocate GABLE PPU instance");
+    
+    // Set the parent engine.
+    l_PPU->m_ParentEngine = p_Engine;
+    TOMBOY_ResetPPU(l_PPU);
+
+    // Return the PPU instance.
+    return l_PPU;
+}
+
+void TOMBOY_DestroyPPU (TOMBOY_PPU* p_PPU)
+{
+    if (p_PPU != NULL)
+    {
+        // Free the PPU instance.
+        TM_free(p_PPU);
+    }
+}
+
+void TOMBOY_ResetPPU (TOMBOY_PPU* p_PPU)
+{
+    if (p_PPU == NULL)
+    {
+        TM_error("PPU instance is NULL.");
+        return;
+    }
+
+    // Point to the parent engine, and keep the render mode, frame skip, frame handoff and pixel
+    // format settings the host chose.
+    TOMBOY_Engine* l_Engine = p_PPU->m_ParentEngine;
+    TOMBOY_RenderMode l_RenderMode = p_PPU->m_RenderMode;
+    bool l_FrameSkip = p_PPU->m_FrameSkip;
+    bool l_FrameHandoff = p_PPU->m_FrameHandoff;
+    TOMBOY_PixelFormat l_PixelFormat = p_PPU->m_PixelFormat;
+
+    // Clear the PPU structure's memory.
+    memset(p_PPU, 0, sizeof(TOMBOY_PPU));
+
+    // Re-set the PPU's parent engine, render mode, frame skip, frame handoff and pixel format
+    // settings.
+    p_PPU->m_ParentEngine = l_Engine;
+    p_PPU->m_RenderMode = l_RenderMode;
+    p_PPU->m_FrameSkip = l_FrameSkip;
+    p_PPU->m_FrameHandoff = l_FrameHandoff;
+    p_PPU->m_PixelFormat = l_PixelFormat;
+    p_PPU->m_PixelSize = TOMBOY_PPU_PIXEL_SIZES[l_PixelFormat];
+    p_PPU->m_ScreenPitch = TOMBOY_PPU_SCREEN_WIDTH * p_PPU->m_PixelSize;
+
+    // Draw into the first screen buffer, with the other two pending and acquired. All three are
+    // cleared alike, so none are out of date.
+    p_PPU->m_BackBuffer = 0;
+    atomic_init(&p_PPU->m_PendingBuffer, 1);
+    p_PPU->m_FrontBuffer = 2;
+    p_PPU->m_ScreenBuffer = (uint8_t*) p_PPU->m_ScreenBuffers[0];
+
+    // Set the default values for the PPU registers.
+    /* LCDC     = 0x91 */   p_PPU->m_LCDC.m_Register    = 0x91; // 0b10010001
+    /* STAT     = 0x85 */   p_PPU->m_STAT.m_Register    = 0x85; // 0b10000101
+    /* SCY      = 0x00 */   p_PPU->m_SCY                = 0x00;
+    /* SCX      = 0x00 */   p_PPU->m_SCX                = 0x00;
+    /* LY       = 0x00 */   p_PPU->m_LY                 = 0x00;
+    /* LYC      = 0x00 */   p_PPU->m_LYC                = 0x00;
+    /* BGP      = 0xFC */   p_PPU->m_BGP                = 0b00011011; // Color indices: 0, 1, 2, 3
+    /* OBP0     = 0xFF */   p_PPU->m_OBP0               = 0b00011011; // Color indices: 0, 1, 2, 3
+    /* OBP1     = 0xFF */   p_PPU->m_OBP1               = 0b00011011; // Color indices: 0, 1, 2, 3
+    /* WY       = 0x00 */   p_PPU->m_WY                 = 0x00;
+    /* WX       = 0x00 */   p_PPU->m_WX                 = 0x00;
+    /* DMA3     = 0x00 */   p_PPU->m_DMA3               = 0x00;
+    /* DMA2     = 0x00 */   p_PPU->m_DMA2               = 0x00;
+    /* DMA1     = 0x30 */   p_PPU->m_DMA1               = 0x30;
+    /* DMA      = 0x00 */   p_PPU->m_DMA                = 0xFF;
+    /* VBK      = 0x00 */   p_PPU->m_VBK                = 0x00;
+    /* HDMA1    = 0xFF */   p_PPU->m_HDMA1              = 0xFF;
+    /* HDMA2    = 0xFF */   p_PPU->m_HDMA2              = 0xFF;
+    /* HDMA3    = 0xFF */   p_PPU->m_HDMA3              = 0xFF;
+    /* HDMA4    = 0xFF */   p_PPU->m_HDMA4              = 0xFF;
+    /* HDMA5    = 0xFF */   p_PPU->m_HDMA5              = 0xFF;
+    /* HDMA6    = 0xFF */   p_PPU->m_HDMA6              = 0xFF;
+    /* HDMA7    = 0xFF */   p_PPU->m_HDMA7.m_Register   = 0xFF; // 0b11111111
+    /* BGPI     = 0x00 */   p_PPU->m_BGPI.m_Register    = 0x00;
+    /* OBPI     = 0x00 */   p_PPU->m_OBPI.m_Register    = 0x00;
+    /* OPRI     = 0x00 */   p_PPU->m_OPRI               = 0x00;
+    /* GRPM     = 0x01 */   p_PPU->m_GRPM               = 0x01;
+
+    // Initialize the Color RAM buffers using the DMG palette.
+    for (uint8_t i = 0; i < TOMBOY_PPU_CRAM_SIZE; i += 8)
+    {
+        p_PPU->m_BgCRAM[i + 0] = TOMBOY_PPU_DMG_PALETTE_RGB555[0];
+        p_PPU->m_BgCRAM[i + 1] = TOMBOY_PPU_DMG_PALETTE_RGB555[1];
+        p_PPU->m_BgCRAM[i + 2] = TOMBOY_PPU_DMG_PALETTE_RGB555[2];
+        p_PPU->m_BgCRAM[i + 3] = TOMBOY_PPU_DMG_PALETTE_RGB555[3];
+        p_PPU->m_BgCRAM[i + 4] = TOMBOY_PPU_DMG_PALETTE_RGB555[4];
+        p_PPU->m_BgCRAM[i + 5] = TOMBOY_PPU_DMG_PALETTE_RGB555[5];
+        p_PPU->m_BgCRAM[i + 6] = TOMBOY_PPU_DMG_PALETTE_RGB555[6];
+        p_PPU->m_BgCRAM[i + 7] = TOMBOY_PPU_DMG_PALETTE_RGB555[7];
+
+        p_PPU->m_ObjCRAM[i + 0] = TOMBOY_PPU_DMG_PALETTE_RGB555[0];
+        p_PPU->m_ObjCRAM[i + 1] = TOMBOY_PPU_DMG_PALETTE_RGB555[1];
+        p_PPU->m_ObjCRAM[i + 2] = TOMBOY_PPU_DMG_PALETTE_RGB555[2];
+        p_PPU->m_ObjCRAM[i + 3] = TOMBOY_PPU_DMG_PALETTE_RGB555[3];
+        p_PPU->m_ObjCRAM[i + 4] = TOMBOY_PPU_DMG_PALETTE_RGB555[4];
+        p_PPU->m_ObjCRAM[i + 5] = TOMBOY_PPU_DMG_PALETTE_RGB555[5];
+        p_PPU->m_ObjCRAM[i + 6] = TOMBOY_PPU_DMG_PALETTE_RGB555[6];
+        p_PPU->m_ObjCRAM[i + 7] = TOMBOY_PPU_DMG_PALETTE_RGB555[7];
     }
 
-    // Fetch the low byte of the tile data from the current bank in VRAM.
-    p_Fetcher->m_FetchedBGW.m_TileDataLow = p_PPU->m_VRAM[l_TargetAddress];
+    // Fill the palette caches from the Color RAM buffers and DMG palette registers.
+    TOMBOY_FillPaletteCaches(p_PPU);
 
-    // If there is an object residing on this pixel, fetch that object's tile data as well.
-    TOMBOY_FetchObjectTileData(p_PPU, p_Fetcher, 0);
+    // Point the VRAM pointer to bank 0.
+    p_PPU->m_VRAM = p_PPU->m_VRAM0;
 
-    // Move to the next state.
-    p_Fetcher->m_Mode = TOMBOY_PFM_TILE_DATA_HIGH;
+    // Reset the PPU's internal state.
+    p_PPU->m_CurrentDot = 0;
+    p_PPU->m_ODMATicks = 0xFF;
+    p_PPU->m_ODMADelay = 0;
+    p_PPU->m_ODMASource = 0;
+    p_PPU->m_ODMAHostSource = NULL;
+    p_PPU->m_HDMABlocksLeft = 0;
+    p_PPU->m_HDMASource = 0;
+    p_PPU->m_HDMADestination = 0;
+    p_PPU->m_LineObjectCount = 0;
+    p_PPU->m_InactiveDivider = 0;
+    TOMBOY_ResetObjectBuckets(p_PPU);
 
+    // Reset the PPU's display mode and pixel fetch mode.
+    p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_OBJECT_SCAN;
+    p_PPU->m_PixelFetcher.m_Mode = TOMBOY_PFM_TILE_NUMBER;
 }
 
-void TOMBOY_FetchTileDataHigh (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+void TOMBOY_SetFrameRenderedCallback (TOMBOY_PPU* p_PPU, TOMBOY_FrameRenderedCallback p_Callback)
 {
-
-    // The high byte of the tile data is fetched in the same manner as the low byte.
-    uint8_t l_TileIndex = p_Fetcher->m_FetchedBGW.m_TileIndex;
-    uint16_t l_TargetAddress = (l_TileIndex * 16) + p_Fetcher->m_TileDataOffset + 1;
-    if (l_TileIndex < 128 && p_PPU->m_LCDC.m_BGWindowTileDataAddress == 0)
+    if (p_PPU == NULL)
     {
-        l_TargetAddress += 0x1000;
+        TM_error("PPU instance is NULL.");
+        return;
     }
 
-    // Fetch the high byte of the tile data.
-    p_Fetcher->m_FetchedBGW.m_TileDataHigh = p_PPU->m_VRAM[l_TargetAddress];
-
-    // If there is an object residing on this pixel, fetch that object's tile data as well.
-    TOMBOY_FetchObjectTileData(p_PPU, p_Fetcher, 1);
-
-    // Move to the next state.
-    p_Fetcher->m_Mode = TOMBOY_PFM_SLEEP;
-
+    // Set the frame rendered callback.
+    p_PPU->m_OnFrameRendered = p_Callback;
 }
 
-void TOMBOY_FetchPushPixels (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+void TOMBOY_SetRenderMode (TOMBOY_PPU* p_PPU, TOMBOY_RenderMode p_Mode)
 {
-
-    // In this mode, continuous attempts are made to push a pixel to the pixel FIFO buffer.
-    if (TOMBOY_TryAddPixel(p_PPU, p_Fetcher) == true)
+    if (p_PPU == NULL)
     {
-        // Once successful, return to the tile number state.
-        p_Fetcher->m_Mode = TOMBOY_PFM_TILE_NUMBER;
+        TM_error("PPU instance is NULL.");
+        return;
     }
 
+    // Set the render mode. It takes effect from the next scanline's pixel transfer.
+    p_PPU->m_RenderMode = p_Mode;
 }
 
-void TOMBOY_FetchSleep (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+TOMBOY_RenderMode TOMBOY_GetRenderMode (const TOMBOY_PPU* p_PPU)
 {
-    // Here, the fetcher sleeps for two dots before pushing the pixels to the screen buffer.
-    p_Fetcher->m_Mode = TOMBOY_PFM_PUSH_PIXELS;
+    if (p_PPU == NULL)
+    {
+        TM_error("PPU instance is NULL.");
+        return TOMBOY_RM_ACCURATE;
+    }
+
+    return p_PPU->m_RenderMode;
 }
 
-void TOMBOY_TickPixelFetcher (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+void TOMBOY_SetFrameSkip (TOMBOY_PPU* p_PPU, bool p_Skip)
 {
-
-    // Calculate the absolute position of the pixel to be processed, in the 256x256 pixel tilemap.
-    p_Fetcher->m_MapY = p_PPU->m_LY + p_PPU->m_SCY;
-    p_Fetcher->m_MapX = p_Fetcher->m_FetchingX + p_PPU->m_SCX;
-
-    // Calculate the offset address of the tile data to be fetched.
-    p_Fetcher->m_TileDataOffset = (p_Fetcher->m_MapY % 8) * 2;
-
-    // During each even-numbered dot in the pixel transfer mode, the pixel fetcher will work
-    // to keep supplying its pixel FIFO buffer with new pixels to draw to the screen buffer.
-    if (p_PPU->m_CurrentDot % 2 == 0)
+    if (p_PPU == NULL)
     {
-
-        // Run the appropriate function in the pixel-fetcher's state machine.
-        switch (p_Fetcher->m_Mode)
-        {
-            case TOMBOY_PFM_TILE_NUMBER: TOMBOY_FetchTileNumber(p_PPU, p_Fetcher); break;
-            case TOMBOY_PFM_TILE_DATA_LOW: TOMBOY_FetchTileDataLow(p_PPU, p_Fetcher); break;
-            case TOMBOY_PFM_TILE_DATA_HIGH: TOMBOY_FetchTileDataHigh(p_PPU, p_Fetcher); break;
-            case TOMBOY_PFM_PUSH_PIXELS: TOMBOY_FetchPushPixels(p_PPU, p_Fetcher); break;
-            case TOMBOY_PFM_SLEEP: TOMBOY_FetchSleep(p_PPU, p_Fetcher); break;
-        }
-
+        TM_error("PPU instance is NULL.");
+        return;
     }
 
-    // In any event, try to shift a pixel from the FIFO buffer into the screen buffer.
-    TOMBOY_ShiftNextPixel(p_PPU, p_Fetcher);
-
+    // Set the frame skip setting. It takes effect from the next frame's first scanline.
+    p_PPU->m_FrameSkip = p_Skip;
 }
 
-void TOMBOY_ResetPixelFetcher (TOMBOY_PPU* p_PPU, TOMBOY_PixelFetcher* p_Fetcher)
+bool TOMBOY_GetFrameSkip (const TOMBOY_PPU* p_PPU)
 {
+    if (p_PPU == NULL)
+    {
+        TM_error("PPU instance is NULL.");
+        return false;
+    }
 
-    // Reset the pixel FIFO buffer.
-    p_Fetcher->m_PixelFIFO.m_Head = 0;
-    p_Fetcher->m_PixelFIFO.m_Tail = 0;
-    p_Fetcher->m_PixelFIFO.m_Size = 0;
-
+    return p_PPU->m_FrameSkip;
 }
 
-// Static Functions - PPU State Machine ////////////////////////////////////////////////////////////
-
-void TOMBOY_TickHorizontalBlank (TOMBOY_PPU* p_PPU)
+bool TOMBOY_IsFrameSkipped (const TOMBOY_PPU* p_PPU)
 {
+    if (p_PPU == NULL)
+    {
+        TM_error("PPU instance is NULL.");
+        return false;
+    }
 
-    // Increment the current dot.
-    p_PPU->m_CurrentDot++;
+    return p_PPU->m_SkippingFrame;
+}
 
-    // If the current dot is at least 456, then the horizontal blank is complete.
-    if (p_PPU->m_CurrentDot >= 456)
+void TOMBOY_SetFrameHandoff (TOMBOY_PPU* p_PPU, bool p_Handoff)
+{
+    if (p_PPU == NULL)
     {
+        TM_error("PPU instance is NULL.");
+        return;
+    }
 
-        // Increment the LY register.
-        TOMBOY_IncrementLY(p_PPU);
-
-        // If all 144 visible scanlines of the current frame have been rendered, then the vertical
-        // blank period has begun.
-        if (p_PPU->m_LY >= TOMBOY_PPU_SCREEN_HEIGHT)
+    // When the handoff begins, the other screen buffers may be any number of frames behind the one
+    // being drawn into, so bring them in line with it, and drop any frame left pending.
+    if (p_Handoff == true && p_PPU->m_FrameHandoff == false)
+    {
+        for (uint8_t i = 0; i < TOMBOY_PPU_FRAME_BUFFER_COUNT; ++i)
         {
-            // Move to the vertical blank state and request the `VBLANK` interrupt.
-            p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_VERTICAL_BLANK;
-            TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_VBLANK);
-
-            // If the `LCD_STAT` interrupt source is enabled for the vertical blank period, then
-            // request the `LCD_STAT` interrupt as well.
-            if (p_PPU->m_STAT.m_VerticalBlankStatSource == true)
-            {
-                TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_LCDSTAT);
-            }
-
-            // If the frame rendered callback is provided, call it here.
-            if (p_PPU->m_OnFrameRendered != NULL)
+            if (i != p_PPU->m_BackBuffer)
             {
-                p_PPU->m_OnFrameRendered(p_PPU);
+                memcpy(p_PPU->m_ScreenBuffers[i], p_PPU->m_ScreenBuffer,
+                    p_PPU->m_ScreenPitch * TOMBOY_PPU_SCREEN_HEIGHT);
             }
         }
 
-        // If there are still visible scanlines to render, then move to the object scan state.
-        else
-        {
-            p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_OBJECT_SCAN;
-            p_PPU->m_LineObjectCount = 0;
-
-            // If its stat source is set, request the `LCD_STAT` interrupt.
-            if (p_PPU->m_STAT.m_ObjectScanStatSource == true)
-            {
-                TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_LCDSTAT);
-            }
-        }
+        memset(p_PPU->m_StaleLines, 0, sizeof(p_PPU->m_StaleLines));
+        atomic_fetch_and_explicit(&p_PPU->m_PendingBuffer, (uint8_t) ~TOMBOY_PPU_FRESH_FRAME,
+            memory_order_relaxed);
+    }
 
-        // Reset the current dot.
-        p_PPU->m_CurrentDot = 0;
+    p_PPU->m_FrameHandoff = p_Handoff;
+}
 
+bool TOMBOY_GetFrameHandoff (const TOMBOY_PPU* p_PPU)
+{
+    if (p_PPU == NULL)
+    {
+        TM_error("PPU instance is NULL.");
+        return false;
     }
 
+    return p_PPU->m_FrameHandoff;
 }
 
-void TOMBOY_TickVerticalBlank (TOMBOY_PPU* p_PPU)
+void TOMBOY_SetPixelFormat (TOMBOY_PPU* p_PPU, TOMBOY_PixelFormat p_Format)
 {
-
-    // If the PPU is about to exit the vertical blanking period (the current dot is at least 456
-    // and the LY register is at 154), then check to see if the vertical blank pause register
-    // is non-zero. If it is, then the PPU will remain in VBLANK mode until the pause reigster is
-    // set to zero.
-    //
-    // Otherwise, if the current dot is less than 456, then increment the current dot.
-    if (p_PPU->m_CurrentDot >= 456 && p_PPU->m_LY >= TOMBOY_PPU_SCANLINE_COUNT && p_PPU->m_VBP != 0)
+    if (p_PPU == NULL)
     {
+        TM_error("PPU instance is NULL.");
         return;
     }
-    else if (p_PPU->m_CurrentDot < 456)
+
+    if (p_Format > TOMBOY_PF_INDEXED8)
     {
-        p_PPU->m_CurrentDot++;
+        TM_error("Pixel format %d is not valid.", p_Format);
+        return;
     }
 
-    // If the current dot is at least 456, then the vertical blank is complete.
-    if (p_PPU->m_CurrentDot >= 456)
+    if (p_Format == p_PPU->m_PixelFormat)
     {
+        return;
+    }
 
-        // Increment the LY register.
-        TOMBOY_IncrementLY(p_PPU);
-
-        // If all 154 scanlines have been processed, but the vertical blank pause register is non-zero,
-        // then the vertical blank period will not be considered complete until the pause register
-        // is set to zero.
-        if (p_PPU->m_LY >= TOMBOY_PPU_SCANLINE_COUNT && p_PPU->m_VBP != 0)
-        {
-            return;
-        }
-
-        // If all 154 scanlines have been processed, then the vertical blank period is complete.
-        if (p_PPU->m_LY >= TOMBOY_PPU_SCANLINE_COUNT)
-        {
-
-            // Reset the LY register and window line counter.
-            p_PPU->m_LY = 0;
-            p_PPU->m_WindowLine = 0;
+    // Set the pixel format, and encode the palette caches' colors in it.
+    p_PPU->m_PixelFormat = p_Format;
+    p_PPU->m_PixelSize = TOMBOY_PPU_PIXEL_SIZES[p_Format];
+    p_PPU->m_ScreenPitch = TOMBOY_PPU_SCREEN_WIDTH * p_PPU->m_PixelSize;
+    TOMBOY_FillPaletteCaches(p_PPU);
 
-            // Move to the object scan state and begin processing the next frame.
-            p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_OBJECT_SCAN;
-            p_PPU->m_LineObjectCount = 0;
+    // The pixels already drawn cannot all be carried over to the new format, so clear the screen
+    // buffers alike, and note every scanline as changed.
+    memset(p_PPU->m_ScreenBuffers, 0, sizeof(p_PPU->m_ScreenBuffers));
+    memset(p_PPU->m_StaleLines, 0, sizeof(p_PPU->m_StaleLines));
+    for (uint8_t l_Line = 0; l_Line < TOMBOY_PPU_SCREEN_HEIGHT; ++l_Line)
+    {
+        TOMBOY_MarkScanlineDirty(p_PPU, l_Line);
+    }
+}
 
-            // If its stat source is set, request the `LCD_STAT` interrupt.
-            if (p_PPU->m_STAT.m_ObjectScanStatSource == true)
-            {
-                TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_LCDSTAT);
-            }
+TOMBOY_PixelFormat TOMBOY_GetPixelFormat (const TOMBOY_PPU* p_PPU)
+{
+    if (p_PPU == NULL)
+    {
+        TM_error("PPU instance is NULL.");
+        return TOMBOY_PF_RGBA8888;
+    }
 
-        }
+    return p_PPU->m_PixelFormat;
+}
 
-        // Reset the current dot.
-        p_PPU->m_CurrentDot = 0;
+bool TOMBOY_DecodeTileWithKernel (TOMBOY_PPUKernelSet p_Set, const uint8_t* p_Data,
+    TOMBOY_DecodedTile* p_Tile)
+{
+    if (p_Data == NULL || p_Tile == NULL)
+    {
+        TM_error("Tile data or decoded tile is NULL.");
+        return false;
+    }
 
+    if (
+        p_Set >= TOMBOY_PKS_COUNT ||
+        s_KernelSets[p_Set].m_DecodeTile == NULL ||
+        TOMBOY_IsKernelSetSupported(p_Set) == false
+    )
+    {
+        return false;
     }
+
+    s_KernelSets[p_Set].m_DecodeTile(p_Data, p_Tile);
+    return true;
 }
 
-void TOMBOY_TickObjectScan (TOMBOY_PPU* p_PPU)
+bool TOMBOY_LookupColorsWithKernel (TOMBOY_PPUKernelSet p_Set, const uint8_t* p_Row,
+    const uint32_t* p_Palette, uint32_t* p_Colors)
 {
-
-    // Increment the current dot. Save the old dot tick.
-    uint16_t l_Dot = p_PPU->m_CurrentDot++;
-
-    // If the incremented dot is at least 80, then the object scan is complete. Move to the pixel
-    // transfer state.
-    if (p_PPU->m_CurrentDot >= 80)
+    if (p_Row == NULL || p_Palette == NULL || p_Colors == NULL)
     {
-        p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_PIXEL_TRANSFER;        
+        TM_error("Color indices, palette or colors are NULL.");
+        return false;
+    }
 
-        TOMBOY_PixelFetcher* l_Fetcher = &p_PPU->m_PixelFetcher;
-        l_Fetcher->m_Mode = TOMBOY_PFM_TILE_NUMBER;
-        l_Fetcher->m_FetchingX = 0;
-        l_Fetcher->m_QueueX = 0;
-        l_Fetcher->m_LineX = 0;
-        l_Fetcher->m_PushedX = 0;
+    if (
+        p_Set >= TOMBOY_PKS_COUNT ||
+        s_KernelSets[p_Set].m_LookupColors == NULL ||
+        TOMBOY_IsKernelSetSupported(p_Set) == false
+    )
+    {
+        return false;
     }
-    else if (l_Dot % 2 == 0)
+
+    s_KernelSets[p_Set].m_LookupColors(p_Row, p_Palette, p_Colors);
+    return true;
+}
+
+void TOMBOY_TickPPU (TOMBOY_PPU* p_PPU, bool p_ODMA)
+{
+    if (p_PPU == NULL)
     {
-        // Find the next object on the current scanline.
-        TOMBOY_FindLineObject(p_PPU);
+        TM_error("PPU instance is NULL.");
+        return;
     }
 
+    TOMBOY_TickPPUDot(p_PPU, p_ODMA);
 }
 
-void TOMBOY_TickPixelTransfer (TOMBOY_PPU* p_PPU)
+void TOMBOY_AdvancePPU (TOMBOY_PPU* p_PPU, uint64_t p_Cycle, uint32_t p_Ticks, uint8_t p_ODMAPeriod)
 {
+    if (p_PPU == NULL)
+    {
+        TM_error("PPU instance is NULL.");
+        return;
+    }
 
-    // Tick the pixel fetcher.
-    TOMBOY_TickPixelFetcher(p_PPU, &p_PPU->m_PixelFetcher);
+    while (p_Ticks > 0)
+    {
+        uint32_t l_Skip = 0;
 
-    // Increment the current dot.
-    p_PPU->m_CurrentDot++;
+        // While the PPU is disabled, only its inactive divider counts, up to the point where it wraps
+        // around and the frame rendered callback is called. The OAM DMA transfer does not run.
+        if (p_PPU->m_LCDC.m_DisplayEnable == false)
+        {
+            l_Skip = TOMBOY_PPU_DOTS_PER_FRAME - p_PPU->m_InactiveDivider;
+            if (l_Skip > p_Ticks)
+            {
+                l_Skip = p_Ticks;
+            }
 
-    // If the pixel fetcher has pushed enough pixels to the screen buffer to fill a scanline, then
-    // the pixel transfer is complete. Move to the horizontal blank state.
-    if (p_PPU->m_PixelFetcher.m_PushedX >= TOMBOY_PPU_SCREEN_WIDTH)
-    {
-        
-        // Reset the pixel fetcher.
-        TOMBOY_ResetPixelFetcher(p_PPU, &p_PPU->m_PixelFetcher);
+            p_PPU->m_InactiveDivider = (p_PPU->m_InactiveDivider + l_Skip) % TOMBOY_PPU_DOTS_PER_FRAME;
+            if (p_PPU->m_InactiveDivider == 0)
+            {
+                TOMBOY_DeliverFrame(p_PPU);
+            }
+        }
 
-        // Move to the horizontal blank state. If its stat source is set, request the `LCD_STAT`
-        // interrupt.
-        p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_HORIZONTAL_BLANK;
-        if (p_PPU->m_STAT.m_HorizontalBlankStatSource == true)
+        // Otherwise, in the blanking periods, and without an OAM DMA transfer to tick, the dots
+        // before the end of the scanline only count up; a vertical blank held by the pause register
+        // does not even do that.
+        else if (
+            (p_PPU->m_STAT.m_DisplayMode == TOMBOY_DM_HORIZONTAL_BLANK ||
+                p_PPU->m_STAT.m_DisplayMode == TOMBOY_DM_VERTICAL_BLANK) &&
+            p_PPU->m_ODMATicks >= 0xA0
+        )
         {
-            TOMBOY_RequestInterrupt(p_PPU->m_ParentEngine, TOMBOY_IT_LCDSTAT);
+            if (p_PPU->m_CurrentDot < 455)
+            {
+                l_Skip = 455 - p_PPU->m_CurrentDot;
+                if (l_Skip > p_Ticks)
+                {
+                    l_Skip = p_Ticks;
+                }
+
+                p_PPU->m_CurrentDot += l_Skip;
+            }
+            else if (p_PPU->m_STAT.m_DisplayMode == TOMBOY_DM_VERTICAL_BLANK &&
+                p_PPU->m_CurrentDot >= 456 && p_PPU->m_LY >= TOMBOY_PPU_SCANLINE_COUNT &&
+                p_PPU->m_VBP != 0)
+            {
+                return;
+            }
         }
 
-        // At the start of each H-Blank period, another block of HDMA data is transferred.
-        TOMBOY_TickHDMA(p_PPU);
+        // The object scan looks up the scanline's objects all at once, as it ends, so its dots also
+        // only count up until its last.
+        else if (
+            p_PPU->m_STAT.m_DisplayMode == TOMBOY_DM_OBJECT_SCAN &&
+            p_PPU->m_ODMATicks >= 0xA0 &&
+            p_PPU->m_CurrentDot + 1 < 80
+        )
+        {
+            l_Skip = 79 - p_PPU->m_CurrentDot;
+            if (l_Skip > p_Ticks)
+            {
+                l_Skip = p_Ticks;
+            }
 
-    }
+            p_PPU->m_CurrentDot += l_Skip;
+        }
 
-}
+        // In the fast render mode, the pixel transfer also only counts up until its last dot.
+        else if (
+            p_PPU->m_STAT.m_DisplayMode == TOMBOY_DM_PIXEL_TRANSFER &&
+            p_PPU->m_LineRenderMode == TOMBOY_RM_FAST &&
+            p_PPU->m_ODMATicks >= 0xA0 &&
+            p_PPU->m_CurrentDot + 1 < TOMBOY_GetPixelTransferEndDot(p_PPU)
+        )
+        {
+            l_Skip = TOMBOY_GetPixelTransferEndDot(p_PPU) - 1 - p_PPU->m_CurrentDot;
+            if (l_Skip > p_Ticks)
+            {
+                l_Skip = p_Ticks;
+            }
 
-// Static Functions - HDMA Transfer ////////////////////////////////////////////////////////////////
+            p_PPU->m_CurrentDot += l_Skip;
+        }
 
-void TOMBOY_TickODMA (TOMBOY_PPU* p_PPU)
-{
-    // Check to see if the DMA transfer is active.
-    if (p_PPU->m_ODMATicks >= 0xA0)
-    {
-        return;
-    }
+        // Anything else is ticked a dot at a time.
+        if (l_Skip == 0)
+        {
+            l_Skip = 1;
+            TOMBOY_TickPPUDot(p_PPU, ((p_Cycle + 1) % p_ODMAPeriod) == 0);
+        }
 
-    // If the ODMA transfer has been initiated, check to see if there is a delay still before
-    // actually starting the transfer.
-    if (p_PPU->m_ODMADelay > 0)
-    {
-        p_PPU->m_ODMADelay--;
-        return;
+        p_Cycle += l_Skip;
+        p_Ticks -= l_Skip;
     }
-
-    // If the ODMA transfer is active, then transfer the next byte of data.
-    uint8_t l_Value = TM_ReadByte(TOMBOY_GetCPU(p_PPU->m_ParentEngine), p_PPU->m_ODMASource + p_PPU->m_ODMATicks);
-    TOMBOY_WriteOAMByte(p_PPU, TOMBOY_OAM_START + (p_PPU->m_ODMATicks++), l_Value);
 }
 
-void TOMBOY_TickHDMA (TOMBOY_PPU* p_PPU)
+uint32_t TOMBOY_GetTicksUntilPPUEvent (const TOMBOY_PPU* p_PPU)
 {
-    if (p_PPU->m_HDMABlocksLeft > 0)
+    if (p_PPU == NULL)
     {
-        // If the HDMA transfer is active, then decrement the number of blocks left to transfer.
-        p_PPU->m_HDMABlocksLeft--;
-
-        // Transfer the next block of data
-        for (uint8_t i = 0; i < 0x10; i++)
-        {
-            uint8_t l_Value = TM_ReadByte(TOMBOY_GetCPU(p_PPU->m_ParentEngine), p_PPU->m_HDMASource++);
-            TOMBOY_WriteVRAMByte(p_PPU, TOMBOY_VRAM_START + (p_PPU->m_HDMADestination++), l_Value);
-        }
+        TM_error("PPU instance is NULL.");
+        return 1;
     }
-}
 
-// Public Functions ////////////////////////////////////////////////////////////////////////////////
+    // If the PPU is disabled, then its only event is the frame rendered callback, made each time the
+    // inactive divider wraps around.
+    if (p_PPU->m_LCDC.m_DisplayEnable == false)
+    {
+        return TOMBOY_PPU_DOTS_PER_FRAME - p_PPU->m_InactiveDivider;
+    }
 
-TOMBOY_PPU* TOMBOY_CreatePPU (TOMBOY_Engine* p_Engine)
-{
-    // Allocate the GABLE PPU instance.
-    TOMBOY_PPU* l_PPU = TM_calloc(1, TOMBOY_PPU);
-    TM_pexpect(l_PPU != NULL, "Failed to allocate GABLE PPU instance");
-    
-    // Set the parent engine.
-    l_PPU->m_ParentEngine = p_Engine;
-    TOMBOY_ResetPPU(l_PPU);
+    switch (p_PPU->m_STAT.m_DisplayMode)
+    {
+        // In the blanking periods, the next event is the end of the scanline, when `LY` changes. A
+        // vertical blank held by the pause register does not end until it is written.
+        case TOMBOY_DM_HORIZONTAL_BLANK:
+            return (p_PPU->m_CurrentDot < 456) ? (456 - p_PPU->m_CurrentDot) : 1;
+        case TOMBOY_DM_VERTICAL_BLANK:
+            if (p_PPU->m_CurrentDot >= 456 && p_PPU->m_LY >= TOMBOY_PPU_SCANLINE_COUNT &&
+                p_PPU->m_VBP != 0)
+            {
+                return UINT32_MAX;
+            }
+            return (p_PPU->m_CurrentDot < 456) ? (456 - p_PPU->m_CurrentDot) : 1;
+
+        // The pixel transfer pushes at most one pixel per dot, so the horizontal blank which follows
+        // it cannot begin before the rest of the scanline's pixels have been pushed.
+        case TOMBOY_DM_OBJECT_SCAN:
+            return (p_PPU->m_CurrentDot < 80) ?
+                (80 - p_PPU->m_CurrentDot) + TOMBOY_PPU_SCREEN_WIDTH : 1;
+        case TOMBOY_DM_PIXEL_TRANSFER:
+            if (p_PPU->m_LineRenderMode == TOMBOY_RM_FAST)
+            {
+                return (p_PPU->m_CurrentDot < TOMBOY_GetPixelTransferEndDot(p_PPU)) ?
+                    TOMBOY_GetPixelTransferEndDot(p_PPU) - p_PPU->m_CurrentDot : 1;
+            }
+            return (p_PPU->m_PixelFetcher.m_PushedX < TOMBOY_PPU_SCREEN_WIDTH) ?
+                TOMBOY_PPU_SCREEN_WIDTH - p_PPU->m_PixelFetcher.m_PushedX : 1;
+    }
 
-    // Return the PPU instance.
-    return l_PPU;
+    return 1;
 }
 
-void TOMBOY_DestroyPPU (TOMBOY_PPU* p_PPU)
+bool TOMBOY_IsODMAActive (const TOMBOY_PPU* p_PPU)
 {
-    if (p_PPU != NULL)
+    if (p_PPU == NULL)
     {
-        // Free the PPU instance.
-        TM_free(p_PPU);
+        TM_error("PPU instance is NULL.");
+        return false;
     }
+
+    return p_PPU->m_ODMATicks < 0xA0;
 }
 
-void TOMBOY_ResetPPU (TOMBOY_PPU* p_PPU)
+const void* TOMBOY_GetScreenBuffer (const TOMBOY_PPU* p_PPU)
 {
     if (p_PPU == NULL)
     {
         TM_error("PPU instance is NULL.");
-        return;
+        return NULL;
     }
 
-    // Point to the parent engine.
-    TOMBOY_Engine* l_Engine = p_PPU->m_ParentEngine;
-
-    // Clear the PPU structure's memory.
-    memset(p_PPU, 0, sizeof(TOMBOY_PPU));
-
-    // Re-set the PPU's parent engine.
-    p_PPU->m_ParentEngine = l_Engine;
-
-    // Set the default values for the PPU registers.
-    /* LCDC     = 0x91 */   p_PPU->m_LCDC.m_Register    = 0x91; // 0b10010001
-    /* STAT     = 0x85 */   p_PPU->m_STAT.m_Register    = 0x85; // 0b10000101
-    /* SCY      = 0x00 */   p_PPU->m_SCY                = 0x00;
-    /* SCX      = 0x00 */   p_PPU->m_SCX                = 0x00;
-    /* LY       = 0x00 */   p_PPU->m_LY                 = 0x00;
-    /* LYC      = 0x00 */   p_PPU->m_LYC                = 0x00;
-    /* BGP      = 0xFC */   p_PPU->m_BGP                = 0b00011011; // Color indices: 0, 1, 2, 3
-    /* OBP0     = 0xFF */   p_PPU->m_OBP0               = 0b00011011; // Color indices: 0, 1, 2, 3
-    /* OBP1     = 0xFF */   p_PPU->m_OBP1               = 0b00011011; // Color indices: 0, 1, 2, 3
-    /* WY       = 0x00 */   p_PPU->m_WY                 = 0x00;
-    /* WX       = 0x00 */   p_PPU->m_WX                 = 0x00;
-    /* DMA3     = 0x00 */   p_PPU->m_DMA3               = 0x00;
-    /* DMA2     = 0x00 */   p_PPU->m_DMA2               = 0x00;
-    /* DMA1     = 0x30 */   p_PPU->m_DMA1               = 0x30;
-    /* DMA      = 0x00 */   p_PPU->m_DMA                = 0xFF;
-    /* VBK      = 0x00 */   p_PPU->m_VBK                = 0x00;
-    /* HDMA1    = 0xFF */   p_PPU->m_HDMA1              = 0xFF;
-    /* HDMA2    = 0xFF */   p_PPU->m_HDMA2              = 0xFF;
-    /* HDMA3    = 0xFF */   p_PPU->m_HDMA3              = 0xFF;
-    /* HDMA4    = 0xFF */   p_PPU->m_HDMA4              = 0xFF;
-    /* HDMA5    = 0xFF */   p_PPU->m_HDMA5              = 0xFF;
-    /* HDMA6    = 0xFF */   p_PPU->m_HDMA6              = 0xFF;
-    /* HDMA7    = 0xFF */   p_PPU->m_HDMA7.m_Register   = 0xFF; // 0b11111111
-    /* BGPI     = 0x00 */   p_PPU->m_BGPI.m_Register    = 0x00;
-    /* OBPI     = 0x00 */   p_PPU->m_OBPI.m_Register    = 0x00;
-    /* OPRI     = 0x00 */   p_PPU->m_OPRI               = 0x00;
-    /* GRPM     = 0x01 */   p_PPU->m_GRPM               = 0x01;
+    // Return the screen buffer.
+    return p_PPU->m_ScreenBuffer;
+}
 
-    // Initialize the Color RAM buffers using the DMG palette.
-    for (uint8_t i = 0; i < TOMBOY_PPU_CRAM_SIZE; i += 8)
+size_t TOMBOY_GetScreenPitch (const TOMBOY_PPU* p_PPU)
+{
+    if (p_PPU == NULL)
     {
-        p_PPU->m_BgCRAM[i + 0] = TOMBOY_PPU_DMG_PALETTE_RGB555[0];
-        p_PPU->m_BgCRAM[i + 1] = TOMBOY_PPU_DMG_PALETTE_RGB555[1];
-        p_PPU->m_BgCRAM[i + 2] = TOMBOY_PPU_DMG_PALETTE_RGB555[2];
-        p_PPU->m_BgCRAM[i + 3] = TOMBOY_PPU_DMG_PALETTE_RGB555[3];
-        p_PPU->m_BgCRAM[i + 4] = TOMBOY_PPU_DMG_PALETTE_RGB555[4];
-        p_PPU->m_BgCRAM[i + 5] = TOMBOY_PPU_DMG_PALETTE_RGB555[5];
-        p_PPU->m_BgCRAM[i + 6] = TOMBOY_PPU_DMG_PALETTE_RGB555[6];
-        p_PPU->m_BgCRAM[i + 7] = TOMBOY_PPU_DMG_PALETTE_RGB555[7];
-
-        p_PPU->m_ObjCRAM[i + 0] = TOMBOY_PPU_DMG_PALETTE_RGB555[0];
-        p_PPU->m_ObjCRAM[i + 1] = TOMBOY_PPU_DMG_PALETTE_RGB555[1];
-        p_PPU->m_ObjCRAM[i + 2] = TOMBOY_PPU_DMG_PALETTE_RGB555[2];
-        p_PPU->m_ObjCRAM[i + 3] = TOMBOY_PPU_DMG_PALETTE_RGB555[3];
-        p_PPU->m_ObjCRAM[i + 4] = TOMBOY_PPU_DMG_PALETTE_RGB555[4];
-        p_PPU->m_ObjCRAM[i + 5] = TOMBOY_PPU_DMG_PALETTE_RGB555[5];
-        p_PPU->m_ObjCRAM[i + 6] = TOMBOY_PPU_DMG_PALETTE_RGB555[6];
-        p_PPU->m_ObjCRAM[i + 7] = TOMBOY_PPU_DMG_PALETTE_RGB555[7];
+        TM_error("PPU instance is NULL.");
+        return 0;
     }
 
-    // Point the VRAM pointer to bank 0.
-    p_PPU->m_VRAM = p_PPU->m_VRAM0;
-
-    // Reset the PPU's internal state.
-    p_PPU->m_CurrentDot = 0;
-    p_PPU->m_ODMATicks = 0xFF;
-    p_PPU->m_ODMADelay = 0;
-    p_PPU->m_ODMASource = 0;
-    p_PPU->m_HDMABlocksLeft = 0;
-    p_PPU->m_HDMASource = 0;
-    p_PPU->m_HDMADestination = 0;
-    p_PPU->m_LineObjectCount = 0;
-    p_PPU->m_InactiveDivider = 0;
-
-    // Reset the PPU's display mode and pixel fetch mode.
-    p_PPU->m_STAT.m_DisplayMode = TOMBOY_DM_OBJECT_SCAN;
-    p_PPU->m_PixelFetcher.m_Mode = TOMBOY_PFM_TILE_NUMBER;
+    return p_PPU->m_ScreenPitch;
 }
 
-void TOMBOY_SetFrameRenderedCallback (TOMBOY_PPU* p_PPU, TOMBOY_FrameRenderedCallback p_Callback)
+void TOMBOY_GetIndexedPalette (const TOMBOY_PPU* p_PPU, uint32_t* p_Colors)
 {
     if (p_PPU == NULL)
     {
@@ -1202,58 +2449,80 @@ void TOMBOY_SetFrameRenderedCallback (TOMBOY_PPU* p_PPU, TOMBOY_FrameRenderedCal
         return;
     }
 
-    // Set the frame rendered callback.
-    p_PPU->m_OnFrameRendered = p_Callback;
+    if (p_Colors == NULL)
+    {
+        TM_error("Indexed palette color array is NULL.");
+        return;
+    }
+
+    // The background CRAM's colors come first, then the object CRAM's, then the DMG shades.
+    for (uint8_t i = 0; i < TOMBOY_PPU_PALETTE_COUNT * TOMBOY_PPU_PALETTE_COLOR_COUNT; ++i)
+    {
+        p_Colors[i] = TOMBOY_GetBackgroundColorInternal((TOMBOY_PPU*) p_PPU,
+            i / TOMBOY_PPU_PALETTE_COLOR_COUNT, i % TOMBOY_PPU_PALETTE_COLOR_COUNT, NULL);
+        p_Colors[TOMBOY_PPU_INDEXED_OBJ_START + i] = TOMBOY_GetObjectColorInternal((TOMBOY_PPU*) p_PPU,
+            i / TOMBOY_PPU_PALETTE_COLOR_COUNT, i % TOMBOY_PPU_PALETTE_COLOR_COUNT, NULL);
+    }
+
+    for (uint8_t i = 0; i < 4; ++i)
+    {
+        p_Colors[TOMBOY_PPU_INDEXED_DMG_START + i] = TOMBOY_PPU_DMG_PALETTE[i];
+    }
 }
 
-void TOMBOY_TickPPU (TOMBOY_PPU* p_PPU, bool p_ODMA)
+const void* TOMBOY_AcquireFrame (TOMBOY_PPU* p_PPU, bool* p_IsNew)
 {
     if (p_PPU == NULL)
     {
         TM_error("PPU instance is NULL.");
-        return;
+        return NULL;
     }
 
-    // If the PPU is disabled, then do not tick the state machine.
-    if (p_PPU->m_LCDC.m_DisplayEnable == false)
+    bool l_IsNew = false;
+    if (p_PPU->m_FrameHandoff == false)
     {
-        // Instead, increment the inactive divider. If the inactive divider reaches the number of
-        // dots in a frame, then call the frame rendered callback, if it is set.
-        p_PPU->m_InactiveDivider = (p_PPU->m_InactiveDivider + 1) % TOMBOY_PPU_DOTS_PER_FRAME;
-        if (p_PPU->m_InactiveDivider == 0 && p_PPU->m_OnFrameRendered != NULL)
-        {
-            p_PPU->m_OnFrameRendered(p_PPU);
-        }
-
-        return;
+        if (p_IsNew != NULL) { *p_IsNew = false; }
+        return p_PPU->m_ScreenBuffer;
     }
 
-    // Check the current display mode and tick the appropriate state machine.
-    switch (p_PPU->m_STAT.m_DisplayMode)
+    // If the pending buffer holds a frame not yet acquired, swap it for the one acquired last. Only
+    // this thread clears the fresh flag, so it cannot go away between the check and the swap.
+    if (atomic_load_explicit(&p_PPU->m_PendingBuffer, memory_order_relaxed) & TOMBOY_PPU_FRESH_FRAME)
     {
-        case TOMBOY_DM_HORIZONTAL_BLANK: TOMBOY_TickHorizontalBlank(p_PPU); break;
-        case TOMBOY_DM_VERTICAL_BLANK: TOMBOY_TickVerticalBlank(p_PPU); break;
-        case TOMBOY_DM_OBJECT_SCAN: TOMBOY_TickObjectScan(p_PPU); break;
-        case TOMBOY_DM_PIXEL_TRANSFER: TOMBOY_TickPixelTransfer(p_PPU); break;
+        p_PPU->m_FrontBuffer = atomic_exchange_explicit(&p_PPU->m_PendingBuffer,
+            p_PPU->m_FrontBuffer, memory_order_acq_rel) & ~TOMBOY_PPU_FRESH_FRAME;
+        l_IsNew = true;
     }
 
-    // If the ODMA transfer is active, then tick the ODMA transfer.
-    if (p_ODMA == true)
+    if (p_IsNew != NULL) { *p_IsNew = l_IsNew; }
+    return p_PPU->m_ScreenBuffers[p_PPU->m_FrontBuffer];
+}
+
+const uint64_t* TOMBOY_GetDirtyScanlines (const TOMBOY_PPU* p_PPU)
+{
+    if (p_PPU == NULL)
     {
-        TOMBOY_TickODMA(p_PPU);
+        TM_error("PPU instance is NULL.");
+        return NULL;
     }
+
+    return p_PPU->m_DirtyLines;
 }
 
-const uint32_t* TOMBOY_GetScreenBuffer (const TOMBOY_PPU* p_PPU)
+bool TOMBOY_IsScanlineDirty (const TOMBOY_PPU* p_PPU, uint8_t p_Line)
 {
     if (p_PPU == NULL)
     {
         TM_error("PPU instance is NULL.");
-        return NULL;
+        return false;
     }
 
-    // Return the screen buffer.
-    return p_PPU->m_ScreenBuffer;
+    if (p_Line >= TOMBOY_PPU_SCREEN_HEIGHT)
+    {
+        return false;
+    }
+
+    return (p_PPU->m_DirtyLines[p_Line / 64] & ((uint64_t) 1 << (p_Line % 64))) != 0;
 }
 
 // Public Functions - Memory Access ////////////////////////////////////////////////////////////////
@@ -1446,6 +2715,13 @@ void TOMBOY_WriteVRAMByte (TOMBOY_PPU* p_PPU, uint32_t p_Address, uint8_t p_Valu
         return;
     }
 
+    // If the byte changes a tile in the tile data area, then that tile needs decoding afresh. HDMA
+    // transfers write to VRAM through here as well.
+    if (p_Address < TOMBOY_PPU_TDATA_PARTITION_SIZE && p_PPU->m_VRAM[p_Address] != p_Value)
+    {
+        p_PPU->m_TileCacheValid[TOMBOY_GetVRAMBankIndex(p_PPU)][p_Address / 16] = false;
+    }
+
     // Write the byte at the specified address in the VRAM bank.
     p_PPU->m_VRAM[p_Address] = p_Value;
 }
@@ -1495,8 +2771,26 @@ void TOMBOY_WriteOAMByte (TOMBOY_PPU* p_PPU, uint32_t p_Address, uint8_t p_Value
         return;
     }
 
-    // Write the byte at the specified address in the OAM buffer.
+    // An object's Y and X positions, its first two bytes, decide which scanlines it resides on, and
+    // its X position decides its place in the X priority order. If either changes, take the object
+    // out of its old scanlines' masks, and put it in its new ones.
     uint8_t* l_OAM = (uint8_t*) p_PPU->m_OAM;
+    uint8_t l_ObjectIndex = p_Address / 4;
+    uint8_t l_ObjectByte = p_Address % 4;
+    if (l_ObjectByte < 2 && l_OAM[p_Address] != p_Value)
+    {
+        TOMBOY_BucketObject(p_PPU, l_ObjectIndex, false);
+        l_OAM[p_Address] = p_Value;
+        TOMBOY_BucketObject(p_PPU, l_ObjectIndex, true);
+        if (l_ObjectByte == 1)
+        {
+            TOMBOY_SortObjectByX(p_PPU, l_ObjectIndex);
+        }
+
+        return;
+    }
+
+    // Write the byte at the specified address in the OAM buffer.
     l_OAM[p_Address] = p_Value;
 }
 
@@ -1546,10 +2840,12 @@ void TOMBOY_WriteCRAMByte (TOMBOY_PPU* p_PPU, uint32_t p_Address, uint8_t p_Valu
     if (p_Address < 0x40)
     {
         p_PPU->m_BgCRAM[p_Address] = p_Value;
+        TOMBOY_UpdateCRAMColor(p_PPU, false, p_Address);
     }
     else
     {
         p_PPU->m_ObjCRAM[p_Address - 0x40] = p_Value;
+        TOMBOY_UpdateCRAMColor(p_PPU, true, p_Address - 0x40);
     }
 }
 
@@ -1561,7 +2857,7 @@ uint8_t TOMBOY_ReadScreenByte (const TOMBOY_PPU* p_PPU, uint32_t p_Address)
         return 0xFF;
     }
 
-    if (p_Address >= TOMBOY_PPU_SCREEN_BUFFER_SIZE)
+    if (p_Address >= (uint32_t) p_PPU->m_ScreenPitch * TOMBOY_PPU_SCREEN_HEIGHT)
     {
         TM_error("Screen buffer read address $%08X is out of bounds.", p_Address);
         return 0xFF;
@@ -1580,8 +2876,7 @@ uint8_t TOMBOY_ReadScreenByte (const TOMBOY_PPU* p_PPU, uint32_t p_Address)
     }
 
     // Return the byte at the specified address in the screen buffer.
-    const uint8_t* l_Screen = (const uint8_t*) p_PPU->m_ScreenBuffer;
-    return l_Screen[p_Address];
+    return p_PPU->m_ScreenBuffer[p_Address];
 }
 
 void TOMBOY_WriteScreenByte (TOMBOY_PPU* p_PPU, uint32_t p_Address, uint8_t p_Value)
@@ -1592,7 +2887,7 @@ void TOMBOY_WriteScreenByte (TOMBOY_PPU* p_PPU, uint32_t p_Address, uint8_t p_Va
         return;
     }
 
-    if (p_Address >= TOMBOY_PPU_SCREEN_BUFFER_SIZE)
+    if (p_Address >= (uint32_t) p_PPU->m_ScreenPitch * TOMBOY_PPU_SCREEN_HEIGHT)
     {
         TM_error("Screen buffer write address $%08X is out of bounds.", p_Address);
         return;
@@ -1610,9 +2905,13 @@ void TOMBOY_WriteScreenByte (TOMBOY_PPU* p_PPU, uint32_t p_Address, uint8_t p_Va
         return;
     }
 
-    // Write the byte at the specified address in the screen buffer.
-    uint8_t* l_Screen = (uint8_t*) p_PPU->m_ScreenBuffer;
-    l_Screen[p_Address] = p_Value;
+    // Write the byte at the specified address in the screen buffer, noting its scanline as changed
+    // if the byte is.
+    if (p_PPU->m_ScreenBuffer[p_Address] != p_Value)
+    {
+        p_PPU->m_ScreenBuffer[p_Address] = p_Value;
+        TOMBOY_MarkScanlineDirty(p_PPU, p_Address / p_PPU->m_ScreenPitch);
+    }
 }
 
 // Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
@@ -2032,6 +3331,11 @@ void TOMBOY_WriteDMA (TOMBOY_PPU* p_PPU, uint8_t p_Value)
         (((uint32_t) p_PPU->m_DMA2) << 16) |
         (((uint32_t) p_PPU->m_DMA3) << 8) |
         0x00;
+
+    // The transfer's 160 bytes never cross a bus page, so if its source is plain memory, it can be
+    // read straight from the host memory backing it.
+    p_PPU->m_ODMAHostSource = TOMBOY_GetBusReadPointer(p_PPU->m_ParentEngine,
+        p_PPU->m_ODMASource, TOMBOY_PPU_OAM_SIZE);
 }
 
 void TOMBOY_WriteBGP (TOMBOY_PPU* p_PPU, uint8_t p_Value)
@@ -2042,8 +3346,9 @@ void TOMBOY_WriteBGP (TOMBOY_PPU* p_PPU, uint8_t p_Value)
         return;
     }
 
-    // Set the BGP register.
+    // Set the BGP register, and the colors it maps each color index to.
     p_PPU->m_BGP = p_Value;
+    TOMBOY_UpdateDMGColors(p_PPU, 0, p_Value);
 }
 
 void TOMBOY_WriteOBP0 (TOMBOY_PPU* p_PPU, uint8_t p_Value)
@@ -2054,8 +3359,9 @@ void TOMBOY_WriteOBP0 (TOMBOY_PPU* p_PPU, uint8_t p_Value)
         return;
     }
 
-    // Set the OBP0 register.
+    // Set the OBP0 register, and the colors it maps each color index to.
     p_PPU->m_OBP0 = p_Value;
+    TOMBOY_UpdateDMGColors(p_PPU, 1, p_Value);
 }
 
 void TOMBOY_WriteOBP1 (TOMBOY_PPU* p_PPU, uint8_t p_Value)
@@ -2066,8 +3372,9 @@ void TOMBOY_WriteOBP1 (TOMBOY_PPU* p_PPU, uint8_t p_Value)
         return;
     }
 
-    // Set the OBP1 register.
+    // Set the OBP1 register, and the colors it maps each color index to.
     p_PPU->m_OBP1 = p_Value;
+    TOMBOY_UpdateDMGColors(p_PPU, 2, p_Value);
 }
 
 void TOMBOY_WriteWY (TOMBOY_PPU* p_PPU, uint8_t p_Value)
@@ -2268,6 +3575,7 @@ void TOMBOY_WriteBGPD (TOMBOY_PPU* p_PPU, uint8_t p_Value)
     )
     {
         p_PPU->m_BgCRAM[p_PPU->m_BGPI.m_ByteIndex] = p_Value;
+        TOMBOY_UpdateCRAMColor(p_PPU, false, p_PPU->m_BGPI.m_ByteIndex);
     }
 
     // Regardless, if the BGPI register's auto-increment bit is set, then increment the index.
@@ -2294,6 +3602,7 @@ void TOMBOY_WriteOBPD (TOMBOY_PPU* p_PPU, uint8_t p_Value)
     )
     {
         p_PPU->m_ObjCRAM[p_PPU->m_OBPI.m_ByteIndex] = p_Value;
+        TOMBOY_UpdateCRAMColor(p_PPU, true, p_PPU->m_OBPI.m_ByteIndex);
     }
 
     // Regardless, if the OBPI register's auto-increment bit is set, then increment the index.
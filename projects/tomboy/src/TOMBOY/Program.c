@@ -212,6 +212,22 @@ uint8_t TOMBOY_ReadProgramByte (const TOMBOY_Program* p_Program, uint32_t p_Addr
     return p_Program->m_Data[p_Address];
 }
 
+const uint8_t* TOMBOY_GetProgramData (const TOMBOY_Program* p_Program, uint32_t* p_Size)
+{
+    if (p_Program == NULL)
+    {
+        TM_error("TOMBOY program is NULL.");
+        return NULL;
+    }
+
+    if (p_Size != NULL)
+    {
+        *p_Size = p_Program->m_Size;
+    }
+
+    return p_Program->m_Data;
+}
+
 uint32_t TOMBOY_GetRequestedSRAMSize (const TOMBOY_Program* p_Program)
 {
     if (p_Program == NULL)
@@ -446,3 +446,41 @@ void TOMBOY_WriteCallStackByte (TOMBOY_RAM* p_RAM, uint32_t p_Address, uint8_t p
 
     p_RAM->m_CallStack[p_Address] = p_Value;
 }
+
+// Public Functions - Direct Access ////////////////////////////////////////////////////////////////
+
+uint8_t* TOMBOY_GetRAMBuffer (TOMBOY_RAM* p_RAM, TOMBOY_RAMRegion p_Region, uint32_t* p_Size)
+{
+    if (p_RAM == NULL)
+    {
+        TM_error("RAM context is NULL.");
+        return NULL;
+    }
+
+    uint8_t* l_Buffer = NULL;
+    uint32_t l_Size = 0;
+    switch (p_Region)
+    {
+        case TOMBOY_RR_WRAM:   l_Buffer = p_RAM->m_WRAM;      l_Size = p_RAM->m_WRAMSize; break;
+        case TOMBOY_RR_SRAM:   l_Buffer = p_RAM->m_SRAM;      l_Size = p_RAM->m_SRAMSize; break;
+        case TOMBOY_RR_XRAM:   l_Buffer = p_RAM->m_XRAM;      l_Size = p_RAM->m_XRAMSize; break;
+        case TOMBOY_RR_QRAM:   l_Buffer = p_RAM->m_QRAM;      l_Size = 0x10000; break;
+        case TOMBOY_RR_DSTACK: l_Buffer = p_RAM->m_DataStack; l_Size = 0x10000; break;
+        case TOMBOY_RR_CSTACK: l_Buffer = p_RAM->m_CallStack; l_Size = 0x10000; break;
+        default:
+            TM_error("Invalid RAM region %d.", p_Region);
+            break;
+    }
+
+    if (l_Buffer == NULL)
+    {
+        l_Size = 0;
+    }
+
+    if (p_Size != NULL)
+    {
+        *p_Size = l_Size;
+    }
+
+    return l_Buffer;
+}
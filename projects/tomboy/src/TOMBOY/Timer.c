@@ -17,6 +17,22 @@ typedef struct TOMBOY_Timer
     TOMBOY_TimerControl m_TAC;           ///< @brief The 8-bit timer control register.
 } TOMBOY_Timer;
 
+// Private Functions ///////////////////////////////////////////////////////////////////////////////
+
+static uint8_t TOMBOY_GetTimerClockBit (const TOMBOY_Timer* p_Timer)
+{
+    // Depending on the timer's clock speed, determine which divider bit needs to be checked.
+    switch (p_Timer->m_TAC.m_ClockSpeed)
+    {
+        case TOMBOY_TCS_4096_HZ:     return 9;
+        case TOMBOY_TCS_262144_HZ:   return 3;
+        case TOMBOY_TCS_65536_HZ:    return 5;
+        case TOMBOY_TCS_16384_HZ:    return 7;
+    }
+
+    return 0;
+}
+
 // Public Functions ////////////////////////////////////////////////////////////////////////////////
 
 TOMBOY_Timer* TOMBOY_CreateTimer (TOMBOY_Engine* p_Engine)
@@ -87,17 +103,8 @@ bool TOMBOY_TickTimer (TOMBOY_Timer* p_Timer)
         return true;
     }
 
-    // Depending on the timer's clock speed, determine which divider bit needs to be checked.
-    uint8_t l_Bit = 0;
-    switch (p_Timer->m_TAC.m_ClockSpeed)
-    {
-        case TOMBOY_TCS_4096_HZ:     l_Bit = 9; break;
-        case TOMBOY_TCS_262144_HZ:   l_Bit = 3; break;
-        case TOMBOY_TCS_65536_HZ:    l_Bit = 5; break;
-        case TOMBOY_TCS_16384_HZ:    l_Bit = 7; break;
-    }
-
-    // Check if the divider bit has transitioned from high to low.
+    // Check if the divider bit selected by the timer's clock speed has transitioned from high to low.
+    uint8_t l_Bit = TOMBOY_GetTimerClockBit(p_Timer);
     bool l_TimerNeedsTick = TOMBOY_TestTimerDividerBit(p_Timer, l_Bit);
     if (l_TimerNeedsTick == true && ++p_Timer->m_TIMA == 0)
     {
@@ -111,6 +118,55 @@ bool TOMBOY_TickTimer (TOMBOY_Timer* p_Timer)
     return true;
 }
 
+bool TOMBOY_AdvanceTimer (TOMBOY_Timer* p_Timer, uint32_t p_Ticks)
+{
+    // Validate the timer instance.
+    if (p_Timer == NULL)
+    {
+        TM_error("Timer context is NULL!");
+        return false;
+    }
+
+    if (p_Ticks == 0)
+    {
+        return true;
+    }
+
+    // Advance the DIV register, keeping its value from the last of the ticks as the old value.
+    uint64_t l_Start = p_Timer->m_DIV;
+    uint64_t l_End = l_Start + p_Ticks;
+    p_Timer->m_OldDIV = (uint16_t) (l_End - 1);
+    p_Timer->m_DIV = (uint16_t) l_End;
+
+    // Check if the timer is enabled.
+    if (p_Timer->m_TAC.m_Enable == false)
+    {
+        return true;
+    }
+
+    // The selected divider bit falls once each time the divider passes a multiple of twice the
+    // bit's value, incrementing the TIMA register each time.
+    uint8_t l_Bit = TOMBOY_GetTimerClockBit(p_Timer);
+    uint64_t l_Increments = (l_End >> (l_Bit + 1)) - (l_Start >> (l_Bit + 1));
+    while (l_Increments > 0)
+    {
+        uint32_t l_Room = 256 - p_Timer->m_TIMA;
+        if (l_Increments < l_Room)
+        {
+            p_Timer->m_TIMA += l_Increments;
+            break;
+        }
+
+        // The TIMA register overflows. Reset it to the TMA register value and request a timer
+        // interrupt.
+        l_Increments -= l_Room;
+        p_Timer->m_TIMA = p_Timer->m_TMA;
+        TOMBOY_RequestInterrupt(p_Timer->m_ParentEngine, TOMBOY_IT_TIMER);
+    }
+
+    return true;
+}
+
 bool TOMBOY_TestTimerDividerBit (const TOMBOY_Timer* p_Timer, uint8_t p_Bit)
 {
     // Validate the timer instance.
@@ -126,6 +182,42 @@ bool TOMBOY_TestTimerDividerBit (const TOMBOY_Timer* p_Timer, uint8_t p_Bit)
     return (l_OldBit == true && l_NewBit == false);
 }
 
+uint32_t TOMBOY_GetTicksUntilDividerFall (const TOMBOY_Timer* p_Timer, uint8_t p_Bit)
+{
+    // Validate the timer instance.
+    if (p_Timer == NULL)
+    {
+        TM_error("Timer context is NULL!");
+        return 1;
+    }
+
+    // The bit falls whenever the divider register reaches a multiple of twice the bit's value.
+    uint32_t l_Period = 1u << (p_Bit + 1);
+    return l_Period - (p_Timer->m_DIV & (l_Period - 1));
+}
+
+uint32_t TOMBOY_GetTicksUntilTimerInterrupt (const TOMBOY_Timer* p_Timer)
+{
+    // Validate the timer instance.
+    if (p_Timer == NULL)
+    {
+        TM_error("Timer context is NULL!");
+        return 1;
+    }
+
+    // A disabled timer never requests an interrupt.
+    if (p_Timer->m_TAC.m_Enable == false)
+    {
+        return UINT32_MAX;
+    }
+
+    // The `TIMA` register increments on the next fall of the clock bit, then once every period
+    // after that. It overflows, requesting the interrupt, on its increment past 255.
+    uint8_t l_Bit = TOMBOY_GetTimerClockBit(p_Timer);
+    uint32_t l_Period = 1u << (l_Bit + 1);
+    return TOMBOY_GetTicksUntilDividerFall(p_Timer, l_Bit) + ((255 - p_Timer->m_TIMA) * l_Period);
+}
+
 // Public Functions - Hardware Register Getters ////////////////////////////////////////////////////
 
 uint8_t TOMBOY_ReadDIV (const TOMBOY_Timer* p_Timer)